@@ -32,6 +32,12 @@
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include <limits.h>
+#include <time.h>
+
+#ifdef _OPENMP
+    #include <omp.h>
+#endif
 
 
 #define STRING_BUFFER_SIZE 256
@@ -50,6 +56,47 @@
 #define DUPLICATED_NODE_DEFAULT_LABEL_PREFIX "duplicated_node_"
 #define DEFAULT_LABEL_CARTESIAN_PRODUCT "cartesian_product_edge"
 #define DEFAULT_WEIGHT_CARTESIAN_PRODUCT 0
+#define ERROR_INDEX -1
+#define GRAPH_DIST_INF LONG_MAX
+#define GRAPH_MATRIX_INF (INT_MAX / 2)
+#define FLOYD_WARSHALL_TILE_SIZE 64
+#define LANDMARKS_FILE_HEADER "landmarks"
+#define CH_WITNESS_SETTLE_LIMIT 500
+#define CH_BENCHMARK_CHECK_COUNT 100
+#define DIAL_MAX_WEIGHT 1024
+#define SSSP_BENCHMARK_MST_MAX_NODES 1000
+#define DELTA_STEPPING_BUCKET_SIZE 64
+#define DELTA_STEPPING_MAX_SLOTS 4096
+#define RMAT_MAX_SCALE 30
+#define RMAT_A 0.57
+#define RMAT_B 0.19
+#define RMAT_C 0.19
+#define RMAT_EDGE_DEFAULT_LABEL "rmat_edge"
+#define RADIX_HEAP_BUCKETS ((int)sizeof(long int) * CHAR_BIT + 1)
+#define PAGERANK_DAMPING 0.85f
+#define PAGERANK_TOLERANCE 1e-6f
+#define PAGERANK_MAX_ITERATIONS 100
+#define PPR_EPSILON 1e-6f
+#define BETWEENNESS_BENCHMARK_TOP 10
+#define TRIANGLE_GALLOP_RATIO 32
+#define LAYERED_SOURCE_LABEL "source"
+#define LAYERED_SINK_LABEL "sink"
+#define LAYERED_EDGE_DEFAULT_LABEL "layered_edge"
+#define BIPARTITE_EDGE_DEFAULT_LABEL "bipartite_edge"
+#define ASSIGNMENT_MAX_CELLS (1 << 25)
+#define LOUVAIN_MAX_SWEEPS 32
+#define LABEL_PROPAGATION_MAX_ITERATIONS 100
+#define CLIQUE_BITSET_MAX_NODES 1024
+#define MATCH_INDUCED 1
+#define MATCH_NODE_LABELS 2
+#define MATCH_EDGE_LABELS 4
+#define MATCH_EDGE_WEIGHTS 8
+#define PATTERN_NODE_LABEL "pattern_node"
+#define PATTERN_EDGE_LABEL "pattern_edge"
+#define REACHABILITY_FILE_HEADER "reachability"
+#define REACHABILITY_CLOSURE_MAX_COMPONENTS 4096
+#define REACHABILITY_BENCHMARK_CHECK_COUNT 100
+#define SERIES_PARALLEL_EDGE_DEFAULT_LABEL "series_parallel_edge"
 
 #define ENABLE_DIJKSTRA_DEBUG
 
@@ -144,6 +191,444 @@ typedef struct graph
 graph_t;
 
 
+/* 
+ *  Compact Graph Definition (Compressed Sparse Row view)
+ *  
+ *  Nodes are given a dense index (0 .. node_count - 1) following the order of the graph list,
+ *  and the outward edges of the node with index i are stored in the positions
+ *  offsets[i] .. offsets[i + 1] - 1 of the edge arrays
+ */
+typedef struct graph_csr
+{
+    int node_count;
+    int edge_count;
+    id_t max_node_id;
+    id_t *node_ids;             /* Node index -> NID */
+    int *index_of;              /* NID -> node index (ERROR_INDEX if the NID isn't in the graph) */
+    graph_node_t **nodes;       /* Node index -> node stored in the graph list */
+    int *offsets;               /* Node index -> position of its first outward edge */
+    int *sources;               /* Edge index -> beginning node index */
+    int *targets;               /* Edge index -> destination node index */
+    int *weights;               /* Edge index -> edge weight */
+    graph_edge_t **edges;       /* Edge index -> edge stored in the graph list */
+    int min_weight;             /* Lightest edge weight (0 if there are no edges) */
+    int max_weight;             /* Heaviest edge weight (0 if there are no edges) */
+}
+graph_csr_t;
+
+
+/* 
+ *  Single-Source Shortest Paths (SSSP) Workspace Definition
+ * 
+ *  The workspace holds all the state of a search, so the graph and its compact view are 
+ *  only read and many searches can run at the same time, one workspace per thread.
+ *  Each search increases the epoch, and a node's entries are only valid if its stamp is 
+ *  equal to the current epoch: this way a workspace can be reused by another search 
+ *  without resetting the entries of the nodes the previous one has reached
+ */
+typedef struct graph_sssp
+{
+    int node_count;
+    unsigned int epoch;         /* Current search number */
+    unsigned int *stamp;        /* Node index -> epoch of the last search that reached the node */
+    int src;                    /* Index of the source node */
+    int cycle_node;             /* Index of a node reached through a negative cycle (ERROR_INDEX if none) */
+    long int *dist;             /* Node index -> distance from the source (GRAPH_DIST_INF if unreachable) */
+    int *prev_edge;             /* Node index -> edge index used to reach the node (ERROR_INDEX if none) */
+    int *path_len;              /* Node index -> amount of edges in the current shortest path */
+    int *queue;                 /* Scratch: circular node deque (Bellman-Ford), binary heap or next node of a bucket (Dijkstra) */
+    bool_t *in_queue;           /* Scratch: deque, heap or bucket membership flags */
+    int *heap_pos;              /* Scratch: node index -> position inside the binary heap, or previous node of a bucket */
+    long int *heap_key;         /* Scratch: node index -> priority inside the binary heap */
+    int heap_size;
+}
+graph_sssp_t;
+
+
+/* 
+ *  A* Heuristic Definition
+ * 
+ *  Returns an estimate of the distance from the node with index 'node' to the node with 
+ *  index 'dest' of the compact view, which must never be greater than the real one
+ *  (GRAPH_DIST_INF can be returned if 'dest' is certainly unreachable from 'node'). 
+ *  The last parameter is the user data given to astar_search()
+ */
+typedef long int (*graph_heuristic_t)(graph_csr_t*, int, int, void*);
+
+
+/* 
+ *  Landmarks Table Definition (for the ALT heuristic)
+ * 
+ *  Stores the distances from and to each landmark node, grouped by node index so that the 
+ *  distances of a single node are contiguous: the distances of node v with landmark l are 
+ *  stored at position (v * landmark_count + l)
+ */
+typedef struct graph_landmarks
+{
+    int node_count;
+    int landmark_count;
+    int *landmarks;             /* Landmark -> node index */
+    long int *dist_from;        /* Distance from the landmark to the node */
+    long int *dist_to;          /* Distance from the node to the landmark */
+}
+graph_landmarks_t;
+
+
+/* 
+ *  Contraction Hierarchy Definition
+ * 
+ *  Every edge of the hierarchy is either an edge of the compact view or a shortcut, which 
+ *  replaces the path of two edges (children) through a node contracted before its endpoints.
+ *  The upward graph lists for each node the edges leading to higher ranked nodes, while the 
+ *  downward graph lists for each node the edges coming from higher ranked nodes
+ */
+typedef struct graph_ch
+{
+    int node_count;
+    int edge_count;             /* Edges of the compact view + shortcuts */
+    int shortcut_count;
+    int *rank;                  /* Node index -> contraction order */
+    int *sources;               /* Edge -> source node index */
+    int *targets;               /* Edge -> target node index */
+    long int *weights;
+    int *children;              /* Edge -> the two replaced edges (ERROR_INDEX for the edges of the view) */
+    int *csr_edges;             /* Edge -> edge index inside the compact view (ERROR_INDEX for shortcuts) */
+    int *up_offsets;
+    int *up_edges;
+    int *down_offsets;
+    int *down_edges;
+}
+graph_ch_t;
+
+
+/* 
+ *  Bitset Definition
+ * 
+ *  A set of small integers (node or edge indices) stored one bit per element, 
+ *  allocated as an array of BITSET_WORDS(n) words initialized to 0
+ */
+typedef unsigned long int bitset_word_t;
+
+#define BITSET_WORD_BITS ((int)sizeof(bitset_word_t) * CHAR_BIT)
+#define BITSET_WORDS(n) (((n) + BITSET_WORD_BITS - 1) / BITSET_WORD_BITS)
+#define BITSET_GET(set, i) (((set)[(i) / BITSET_WORD_BITS] >> ((i) % BITSET_WORD_BITS)) & 1UL)
+#define BITSET_SET(set, i) ((set)[(i) / BITSET_WORD_BITS] |= (1UL << ((i) % BITSET_WORD_BITS)))
+#define BITSET_CLEAR(set, i) ((set)[(i) / BITSET_WORD_BITS] &= ~(1UL << ((i) % BITSET_WORD_BITS)))
+
+
+/* 
+ *  Path Set Definition
+ * 
+ *  Stores a set of paths between the same two nodes, 
+ *  each one as a list of edge IDs (EIDs) with its length
+ */
+typedef struct graph_paths
+{
+    int count;
+    id_list_t **paths;
+    long int *dists;
+}
+graph_paths_t;
+
+
+/* 
+ *  Triangle Counts Definition
+ * 
+ *  Stores the triangles of a graph whose edges are taken without direction,
+ *  with the per-node values indexed by node index (see count_triangles())
+ */
+typedef struct graph_triangles
+{
+    int node_count;
+    long int total;             /* Amount of triangles of the graph */
+    double transitivity;        /* Global clustering coefficient: 3 * triangles / connected triples */
+    int *degrees;               /* Node index -> amount of distinct neighbours (self loops excluded) */
+    long int *triangles;        /* Node index -> amount of triangles the node belongs to */
+    double *clustering;         /* Node index -> local clustering coefficient */
+}
+graph_triangles_t;
+
+
+/* 
+ *  Flow Network Definition
+ * 
+ *  Residual network used by the maximum flow algorithms: every edge of the compact view
+ *  becomes a forward arc and a reverse arc, and the arcs leaving the node with index u
+ *  are stored in the positions offsets[u] .. offsets[u + 1] - 1 of the arc arrays
+ */
+typedef struct graph_flow_network
+{
+    int node_count;
+    int arc_count;
+    int *offsets;               /* Node index -> position of its first arc */
+    int *heads;                 /* Arc index -> destination node index */
+    int *reverse;               /* Arc index -> index of the opposite arc */
+    int *edge_arc;              /* Edge index -> index of its forward arc */
+    long int *capacity;         /* Arc index -> residual capacity */
+}
+graph_flow_network_t;
+
+
+/* 
+ *  Maximum Flow Definition
+ * 
+ *  Stores a maximum flow between two nodes, with the flow of every edge
+ *  (indexed by edge index) and the corresponding minimum cut
+ */
+typedef struct graph_flow
+{
+    int node_count;
+    int edge_count;
+    long int value;             /* Value of the flow, equal to the capacity of the minimum cut */
+    long int *flow;             /* Edge index -> flow through the edge */
+    bool_t *source_side;        /* Node index -> true if the node is on the source side of the cut */
+    id_list_t *cut;             /* EIDs of the edges from the source side to the sink side */
+}
+graph_flow_t;
+
+
+/* 
+ *  Cut Definition
+ * 
+ *  Stores a cut of a graph whose edges are taken without direction: 
+ *  the nodes on one of its sides (by node index) and the edges crossing it
+ */
+typedef struct graph_cut
+{
+    int node_count;
+    long int value;             /* Total weight of the edges crossing the cut */
+    bool_t *side;               /* Node index -> true if the node is on the side of the cut */
+    id_list_t *cut;             /* EIDs of the edges crossing the cut, in either direction */
+}
+graph_cut_t;
+
+
+/* 
+ *  Matching Definition
+ * 
+ *  Stores a matching of a bipartite graph: the mate of every node (by node index)
+ *  and, for every matched pair, the lightest edge that links the two nodes
+ */
+typedef struct graph_matching
+{
+    int node_count;
+    int size;                   /* Amount of matched pairs */
+    long int cost;              /* Total weight of the matched edges */
+    int *mate;                  /* Node index -> index of its mate (ERROR_INDEX if unmatched) */
+    id_list_t *edges;           /* EIDs of the matched edges */
+}
+graph_matching_t;
+
+
+/* Coloring Order Definition */
+typedef enum coloring_order
+{
+    NATURAL_ORDER,              /* Order of the nodes in the graph */
+    LARGEST_FIRST_ORDER,        /* Decreasing degree */
+    SMALLEST_LAST_ORDER         /* Reverse removal order by smallest degree */
+}
+coloring_order_t;
+
+
+/* 
+ *  Community Level Definition
+ * 
+ *  Stores a weighted graph whose edges are taken without direction, as used by the
+ *  community detection: an edge u - v of weight w is stored as w in the rows of both
+ *  nodes, and a self loop as 2w in the row of its node, so that the strength of a node 
+ *  is the sum of its row. Each level of the Louvain Method has one of these
+ */
+typedef struct graph_community_level
+{
+    int node_count;
+    int *offsets;               /* Node -> position of its first entry */
+    int *targets;               /* Entry -> neighbour node */
+    long int *weights;          /* Entry -> weight */
+    long int *strength;         /* Node -> sum of the weights of its row */
+    long int total;             /* Sum of all the strengths (twice the total edge weight) */
+}
+graph_community_level_t;
+
+
+/* 
+ *  Communities Definition
+ * 
+ *  Stores the community of every node (by node index), numbered from 0 to count - 1
+ */
+typedef struct graph_communities
+{
+    int node_count;
+    int count;                  /* Amount of communities */
+    int rounds;                 /* Levels of the Louvain Method, or sweeps of Label Propagation */
+    double modularity;
+    int *community;             /* Node index -> community */
+}
+graph_communities_t;
+
+
+/* 
+ *  Clique Callback Definition
+ * 
+ *  Receives a maximal clique found by maximal_cliques(): the node indexes of its 'size'
+ *  nodes in the compact view. The array is reused after the call returns. The last 
+ *  parameter is the user data given to maximal_cliques()
+ */
+typedef void (*graph_clique_callback_t)(graph_csr_t*, const int*, int, void*);
+
+
+/* 
+ *  Clique Search Definition
+ * 
+ *  Workspace of a thread of maximal_cliques(): the neighbourhood of the node that starts
+ *  a search is renumbered as local nodes (0, 1, ...), whose adjacency is a bitset matrix
+ *  of 'words' words per row, and the candidate (P) and excluded (X) sets of every depth 
+ *  are stored one after the other
+ */
+typedef struct graph_clique_search
+{
+    graph_csr_t *csr;
+    const int *offsets;         /* Node index -> position of its first distinct neighbour */
+    const int *neighbours;      /* Sorted distinct neighbours of every node */
+    int min_size;
+    graph_clique_callback_t callback;
+    void *data;
+    int words;
+    int *local;                 /* Local node -> node index */
+    int *local_of;              /* Node index -> local node (ERROR_INDEX if not local) */
+    bitset_word_t *adjacency;   /* Local node -> bitset of its local neighbours */
+    bitset_word_t *candidates;  /* Depth -> bitset of P */
+    bitset_word_t *excluded;    /* Depth -> bitset of X */
+    int *clique;                /* Node indexes of the current clique */
+    int *sorted;                /* P and X of the neighbourhoods too large for the bitsets */
+    long int count;             /* Amount of cliques reported */
+    bool_t failed;
+}
+graph_clique_search_t;
+
+
+/* 
+ *  Match Callback Definition
+ * 
+ *  Receives a match found by subgraph_isomorphisms(): the compact views of the pattern 
+ *  and of the target, and the target node index of every pattern node index. The array 
+ *  is reused after the call returns. The last parameter is the user data given to 
+ *  subgraph_isomorphisms(). Returns true to go on with the search, false to stop it
+ */
+typedef bool_t (*graph_match_callback_t)(graph_csr_t*, graph_csr_t*, const int*, void*);
+
+
+/* 
+ *  Matching View Definition
+ * 
+ *  Stores a graph for the pattern matching, with interned labels: the outward and inward
+ *  edges of every node (by node index) are rows of entries (other endpoint and label) 
+ *  sorted by endpoint, then by label, so that an edge can be found with a binary search
+ */
+typedef struct graph_match_graph
+{
+    graph_csr_t *csr;
+    int *node_labels;           /* Node index -> label ID */
+    int *out_offsets;           /* Node index -> position of its first outward entry */
+    int *out_heads;             /* Outward entry -> destination node index */
+    int *out_labels;            /* Outward entry -> edge label ID */
+    int *in_offsets;            /* Node index -> position of its first inward entry */
+    int *in_heads;              /* Inward entry -> beginning node index */
+    int *in_labels;             /* Inward entry -> edge label ID */
+    int *out_degrees;           /* Node index -> amount of distinct outward neighbours */
+    int *in_degrees;            /* Node index -> amount of distinct inward neighbours */
+}
+graph_match_graph_t;
+
+
+/* 
+ *  Reachability Index Definition
+ * 
+ *  Answers whether a node can be reached from another one. The nodes are grouped by strongly
+ *  connected component, numbered in topological order, and the index is built on the acyclic
+ *  condensation: either its transitive closure, one bitset row of component_count bits per
+ *  component (small graphs), or the interval labels of a depth-first search together with a
+ *  2-hop labeling, where b is reachable from a if and only if the out-hubs of a and the
+ *  in-hubs of b (sorted) have a hub in common (large graphs)
+ */
+typedef struct graph_reachability
+{
+    int node_count;
+    int component_count;
+    int *component;             /* Node index -> strongly connected component */
+    bitset_word_t *closure;     /* Component -> bitset of the reachable components (NULL if labeled) */
+    int *pre;                   /* Component -> preorder number in the depth-first search */
+    int *post;                  /* Component -> postorder number in the depth-first search */
+    int *low;                   /* Component -> lowest postorder number among the reachable components */
+    int *out_offsets;
+    int *out_hubs;
+    int *in_offsets;
+    int *in_hubs;
+}
+graph_reachability_t;
+
+
+/* Series-Parallel Decomposition Node Type Definition */
+typedef enum sp_node_type
+{
+    SP_LEAF,                    /* A single edge */
+    SP_SERIES,                  /* The sink of the left child is merged with the source of the right child */
+    SP_PARALLEL                 /* The sources and the sinks of the two children are merged */
+}
+sp_node_type_t;
+
+
+/* 
+ *  Series-Parallel Decomposition Tree Definition
+ * 
+ *  Every tree node is a two-terminal subgraph: a leaf is an edge of the compact view, and
+ *  the other nodes are the series or parallel composition of their two children. The 
+ *  children always have lower numbers than their parent, so the tree can be processed 
+ *  bottom-up with a simple loop. The terminals of an undirected subgraph can be stored in
+ *  either order, and those of the children may be swapped with respect to their parent
+ */
+typedef struct graph_sp_tree
+{
+    int size;                   /* Amount of tree nodes */
+    int root;
+    sp_node_type_t *types;
+    int *left;                  /* Tree node -> first child (ERROR_INDEX for leaves) */
+    int *right;                 /* Tree node -> second child (ERROR_INDEX for leaves) */
+    int *edges;                 /* Tree node -> edge index of a leaf (ERROR_INDEX for the others) */
+    int *sources;               /* Tree node -> node index of its source terminal */
+    int *sinks;                 /* Tree node -> node index of its sink terminal */
+}
+graph_sp_tree_t;
+
+
+/* 
+ *  Series-Parallel Reduction Definition
+ * 
+ *  Workspace of series_parallel_decomposition(): the current edges (records) are kept in
+ *  the doubly linked incidence lists of their endpoints, one incidence per endpoint 
+ *  (2 * record + side), and in a hash table by endpoints, so that parallel edges are 
+ *  found as soon as they're created
+ */
+typedef struct graph_sp_reduction
+{
+    bool_t undirected;
+    int record_count;
+    int *ends;                  /* Record -> its two endpoints (source, sink) */
+    int *tree_nodes;            /* Record -> tree node of its subgraph (ERROR_INDEX once removed) */
+    int *next;                  /* Incidence -> next incidence of the same node */
+    int *prev;                  /* Incidence -> previous incidence of the same node */
+    int *heads;                 /* Node index -> first incidence */
+    int *in_degrees;
+    int *out_degrees;           /* Node index -> outward degree (total degree if undirected) */
+    int *buckets;               /* Hash -> first record of the bucket */
+    int *chains;                /* Record -> next record of the same bucket */
+    int mask;
+    int *queue;                 /* Nodes that can be reduced in series */
+    bool_t *queued;
+    int queue_size;
+}
+graph_sp_reduction_t;
+
+
 /* ==== Global Variables ==== */
 
 
@@ -165,6 +650,42 @@ void                print_dijkstra(graph_t*, id_t);
 void                print_dijkstra_input(graph_t*);
 void                print_graph_matrix(graph_t*);
 void                print_all_node_ids(graph_t*);
+void                print_id_list(id_list_t*);
+void                print_bellman_ford(graph_t*, id_t);
+void                print_bellman_ford_input(graph_t*);
+void                print_bellman_ford_benchmark(graph_t*, id_t);
+void                print_floyd_warshall(graph_t*);
+void                print_apsp_benchmark(graph_t*);
+void                print_shortest_path(graph_t*, id_t, id_t);
+void                print_shortest_path_input(graph_t*);
+void                print_k_shortest_paths(graph_t*, id_t, id_t, int);
+void                print_k_shortest_paths_input(graph_t*);
+void                print_ch_benchmark(graph_t*, int);
+void                print_sssp_benchmark(graph_t*, id_t);
+void                print_delta_stepping_benchmark(graph_t*, id_t, int);
+void                print_pagerank(graph_t*);
+void                print_personalized_pagerank(graph_t*, id_t);
+void                print_personalized_pagerank_input(graph_t*);
+void                print_betweenness(graph_t*, bool_t);
+void                print_betweenness_benchmark(graph_t*, bool_t, int);
+void                print_triangles(graph_t*);
+void                print_core_numbers(graph_t*);
+void                print_max_flow(graph_t*, id_t, id_t);
+void                print_max_flow_input(graph_t*);
+void                print_max_flow_benchmark(graph_t*, id_t, id_t);
+void                print_min_cut(graph_t*);
+void                print_matching(graph_t*, bool_t);
+void                print_matching_benchmark(graph_t*);
+void                print_coloring(graph_t*);
+void                print_communities(graph_t*);
+void                print_maximal_cliques(graph_t*, int);
+void                print_maximal_cliques_input(graph_t*);
+void                print_subgraph_isomorphisms(graph_t*, graph_t*, int);
+void                print_subgraph_benchmark(graph_t*);
+void                print_isomorphism(graph_t*, graph_t*, int);
+void                print_reachability_benchmark(graph_t*, int);
+void                print_eulerian_path(graph_t*, bool_t);
+void                print_series_parallel(graph_t*, bool_t);
 graph_edge_list_t * input_edge_list(id_t);
 graph_node_t        input_node(void);
 graph_t *           input_graph(void);
@@ -172,8 +693,12 @@ void *              safe_input(const type_t, const unsigned long int, char*);
 
 
 /* File Operations */
-graph_t * load_graph(char*);
-void      save_graph(graph_t*, char*);
+graph_t *              load_graph(char*);
+void                   save_graph(graph_t*, char*);
+graph_landmarks_t *    load_landmarks(char*);
+void                   save_landmarks(graph_landmarks_t*, char*);
+graph_reachability_t * load_reachability(char*);
+void                   save_reachability(graph_reachability_t*, char*);
 
 
 /* Actions */
@@ -200,6 +725,11 @@ int    graph_dim_R(graph_t*);
 int    edge_list_dim(graph_edge_list_t*);
 int    edge_list_dim_R(graph_edge_list_t*);
 int *  create_graph_matrix(graph_t*);
+int *  create_graph_weight_matrix(graph_t*);
+int    get_thread_count(void);
+int    get_team_size(void);
+int    get_thread_id(void);
+double get_wall_time(void);
 int    autoloop_count(graph_edge_list_t*);
 char * filter(char*, char);
 char * int_to_string(long int);
@@ -229,6 +759,7 @@ id_list_t * append_revoked_id(id_list_t*, id_t);
 id_list_t * delete_revoked_id(id_list_t*, id_t);
 id_list_t * delete_all_revoked_id(id_list_t*);
 id_list_t * pop_front_revoked_id(id_list_t*, id_t*);
+id_list_t * push_id(id_list_t*, id_t);
 bool_t      find_revoked_id(id_list_t*, id_t);
 bool_t      find_revoked_id_R(id_list_t*, id_t);
 
@@ -250,6 +781,130 @@ graph_t * series_graph_composition(graph_t*, graph_t*, id_t, id_t);
 graph_t * series_graph_composition_input(graph_t*, graph_t*);
 
 
+/* Graph Generators */
+graph_t * create_rmat_graph(int, int, int, unsigned int);
+graph_t * create_layered_graph(int, int, int, int, unsigned int);
+graph_t * create_bipartite_graph(int, int, int, int, unsigned int);
+graph_t * create_series_parallel_graph(int, int, unsigned int);
+
+
+/* Compact Graph Views */
+graph_csr_t * create_graph_csr(graph_t*);
+graph_csr_t * create_graph_csr_transpose(graph_csr_t*);
+graph_csr_t * delete_graph_csr(graph_csr_t*);
+int           get_csr_index_from_id(graph_csr_t*, id_t);
+
+
+/* Shortest Paths */
+graph_sssp_t *  create_sssp(int);
+graph_sssp_t *  delete_sssp(graph_sssp_t*);
+bool_t          bellman_ford_sssp(graph_csr_t*, id_t, graph_sssp_t*);
+id_list_t *     bellman_ford_negative_cycle(graph_csr_t*, graph_sssp_t*);
+id_list_t *     get_sssp_path(graph_csr_t*, graph_sssp_t*, id_t);
+long int        get_sssp_dist(graph_csr_t*, graph_sssp_t*, id_t);
+bool_t          floyd_warshall_apsp(int*, int);
+bool_t          dijkstra_sssp(graph_csr_t*, id_t, graph_sssp_t*);
+bool_t          binary_heap_sssp(graph_csr_t*, id_t, graph_sssp_t*);
+bool_t          dial_sssp(graph_csr_t*, id_t, graph_sssp_t*);
+bool_t          radix_heap_sssp(graph_csr_t*, id_t, graph_sssp_t*);
+bool_t          delta_stepping_sssp(graph_csr_t*, id_t, graph_sssp_t*, int);
+long int *      johnson_apsp(graph_csr_t*);
+id_list_t *     bidirectional_dijkstra(graph_csr_t*, graph_csr_t*, id_t, id_t, graph_sssp_t*, graph_sssp_t*, long int*);
+id_list_t *     astar_search(graph_csr_t*, id_t, id_t, graph_heuristic_t, void*, graph_sssp_t*, long int*);
+graph_paths_t * yen_k_shortest_paths(graph_csr_t*, id_t, id_t, int, graph_sssp_t*);
+graph_paths_t * delete_graph_paths(graph_paths_t*);
+
+
+/* Landmarks (ALT) */
+graph_landmarks_t * create_landmarks(graph_csr_t*, int);
+graph_landmarks_t * delete_landmarks(graph_landmarks_t*);
+long int            landmark_heuristic(graph_csr_t*, int, int, void*);
+
+
+/* Contraction Hierarchies */
+graph_ch_t * create_graph_ch(graph_csr_t*);
+graph_ch_t * delete_graph_ch(graph_ch_t*);
+id_list_t *  ch_query(graph_csr_t*, graph_ch_t*, id_t, id_t, graph_sssp_t*, graph_sssp_t*, long int*);
+
+
+/* Centrality */
+float *  pagerank(graph_csr_t*, float, float, int, bool_t);
+float *  personalized_pagerank(graph_csr_t*, id_t, float, float);
+double * betweenness_centrality(graph_csr_t*, bool_t, int, unsigned int);
+
+
+/* Triangles and Clustering */
+graph_triangles_t * count_triangles(graph_csr_t*);
+graph_triangles_t * delete_graph_triangles(graph_triangles_t*);
+
+
+/* k-Core Decomposition */
+int *     core_numbers(graph_csr_t*);
+graph_t * extract_k_core(graph_t*, int);
+graph_t * extract_k_core_input(graph_t*);
+
+
+/* Maximum Flow */
+graph_flow_t * dinic_max_flow(graph_csr_t*, id_t, id_t);
+graph_flow_t * push_relabel_max_flow(graph_csr_t*, id_t, id_t);
+graph_flow_t * delete_graph_flow(graph_flow_t*);
+
+
+/* Global Minimum Cut */
+graph_cut_t * stoer_wagner_min_cut(graph_csr_t*);
+graph_cut_t * delete_graph_cut(graph_cut_t*);
+
+
+/* Bipartite Matching */
+bool_t             is_bipartite(graph_csr_t*, int*);
+graph_matching_t * hopcroft_karp_matching(graph_csr_t*);
+graph_matching_t * hungarian_assignment(graph_csr_t*);
+graph_matching_t * delete_graph_matching(graph_matching_t*);
+
+
+/* Graph Coloring */
+int * greedy_coloring(graph_csr_t*, coloring_order_t);
+int * dsatur_coloring(graph_csr_t*);
+int * jones_plassmann_coloring(graph_csr_t*, unsigned int);
+
+
+/* Community Detection */
+graph_communities_t * louvain_communities(graph_csr_t*);
+graph_communities_t * label_propagation_communities(graph_csr_t*, unsigned int);
+graph_communities_t * delete_graph_communities(graph_communities_t*);
+
+
+/* Maximal Cliques */
+long int maximal_cliques(graph_csr_t*, int, graph_clique_callback_t, void*);
+
+
+/* Subgraph Isomorphism */
+long int subgraph_isomorphisms(graph_t*, graph_t*, int, graph_match_callback_t, void*);
+
+
+/* Graph Isomorphism */
+unsigned long int graph_fingerprint(graph_t*, int);
+bool_t            are_isomorphic(graph_t*, graph_t*, int);
+
+
+/* Reachability */
+int                    strongly_connected_components(graph_csr_t*, int*);
+graph_reachability_t * create_reachability(graph_csr_t*, int);
+graph_reachability_t * delete_reachability(graph_reachability_t*);
+bool_t                 is_reachable(graph_csr_t*, graph_reachability_t*, id_t, id_t);
+
+
+/* Eulerian Paths */
+id_list_t * eulerian_path(graph_csr_t*, bool_t);
+
+
+/* Series-Parallel Graphs */
+graph_sp_tree_t * series_parallel_decomposition(graph_csr_t*, bool_t);
+graph_sp_tree_t * delete_sp_tree(graph_sp_tree_t*);
+int               sp_max_independent_set(graph_sp_tree_t*);
+long int          sp_longest_path(graph_csr_t*, graph_sp_tree_t*);
+
+
 /* ==== MAIN (ONLY FOR TESTING) ==== */
 
 
@@ -531,1181 +1186,1474 @@ void print_all_node_ids(graph_t *graph)
 
 
 /*
- *  Creates an edge list based on user input and returns 
- *  the list head pointer
+ *  Prints to terminal all the IDs stored in the given ID list,
+ *  in the same order as they appear in the list
  */
-graph_edge_list_t * input_edge_list(id_t node_id)
+void print_id_list(id_list_t *list)
 {
-    graph_edge_list_t *edges;
-    int weight; 
-    char *label;
-    id_t endpoint_ids[2];
-    int quantity;
-    int i;
-
-
-    edges = NULL;
-    i = 0;
-
-    /* Asking for the quantity of edges to insert next */
-    quantity = *((int*)safe_input(INT, STRING_BUFFER_SIZE, "Insert amount of edges to input: "));
-    
-    while (i < quantity)
-    {   
-        /* Weight input */
-        printf("Insert edge #%d weight: ", i + 1);
-        weight = *((int*)safe_input(INT, STRING_BUFFER_SIZE, NULL));
-
-        /* Label input */
-        do
+    if (list)
+    {
+        while (list)
         {
-            label = (char*)safe_input(STRING, STRING_BUFFER_SIZE, "Insert edge label: ");
-        } 
-        while (strlen(label) == 0);
+            printf("[%u]", list->id);
 
-        /* Endpoint IDs input */
-        printf("Insert edge #%d final endpoint ID (SELF_NID=%d): ", i + 1, node_id);
+            if (list->next)
+            {
+                printf(" -> ");
+            }
 
-        endpoint_ids[0] = node_id;
-        endpoint_ids[1] = *((id_t*)safe_input(U_INT, STRING_BUFFER_SIZE, NULL));        
+            list = list->next;
+        }
 
-        edges = append_edge(edges, create_new_edge(weight, label, endpoint_ids));
-        i++;
+        printf("\n");
+    }
+    else
+    {
+        printf("[EMPTY LIST]\n");
     }
-
-    return edges;
 }
 
 
 /*
- *  Creates a node based on user input and returns
- *  a node element
+ *  Prints to terminal the shortest path distances from the source node ID (src_nid),
+ *  computed with the Bellman-Ford (SPFA) algorithm, together with the edge IDs (EIDs)
+ *  of each path. If a negative cycle is reachable from the source, only the cycle is printed
  */
-graph_node_t input_node(void)
+void print_bellman_ford(graph_t *graph, id_t src_nid)
 {
-    graph_node_t node;
-    char *label;
-    
+    graph_csr_t *csr;
+    graph_sssp_t *sssp;
+    id_list_t *path;
+    int i, src;
 
-    printf("\n[NODE]\n");
 
-    /* Label input */
-    do
+    if (graph)
     {
-        label = (char*)safe_input(STRING, STRING_BUFFER_SIZE, "Insert node label: ");
-    } 
-    while (strlen(label) == 0); 
-
-    /* New node creation */
-    node = create_new_node(label);
-    
-    node.edges = input_edge_list(get_id_from_node(&node));
-
-    return node;
-}   
+        csr = create_graph_csr(graph);
+        sssp = NULL;
+        src = get_csr_index_from_id(csr, src_nid);
 
+        if (src != ERROR_INDEX && ( sssp = create_sssp(csr->node_count) ))
+        {
+            printf("\n[Bellman-Ford] Shortest Paths from Source Node [%s]:\n", csr->nodes[src]->label);
 
-/*
- *  Creates a graph based on user input and returns
- *  the list head pointer
- */
-graph_t * input_graph(void)
-{
-    graph_t *graph;
-    int graph_dim, i;
+            if (bellman_ford_sssp(csr, src_nid, sssp))
+            {
+                for (i = 0; i < csr->node_count; i++)
+                {
+                    if (get_sssp_dist(csr, sssp, csr->node_ids[i]) == GRAPH_DIST_INF)
+                    {
+                        printf("\n\t[%s] (NID=%u) -> UNREACHABLE\n", csr->nodes[i]->label, csr->node_ids[i]);
+                    }
+                    else
+                    {
+                        printf("\n\t[%s] (NID=%u) -> DIST=%ld\n", csr->nodes[i]->label, csr->node_ids[i], get_sssp_dist(csr, sssp, csr->node_ids[i]));
+                        printf("\t   EIDs: ");
 
+                        path = get_sssp_path(csr, sssp, csr->node_ids[i]);
+                        print_id_list(path);
+                        path = delete_all_revoked_id(path);
+                    }
+                }
 
-    graph = NULL;
+                printf("\n");
+            }
+            else
+            {
+                printf("\n\t[NEGATIVE CYCLE FOUND]\n\t   EIDs: ");
 
-    /* Input of graph dimension */
-    do
-    {
-        graph_dim = *((int*)safe_input(INT, STRING_BUFFER_SIZE, "Insert graph size: "));
-    } 
-    while (graph_dim < 0);
+                path = bellman_ford_negative_cycle(csr, sssp);
+                print_id_list(path);
+                path = delete_all_revoked_id(path);
 
-    /* Creating the graph */
-    for (i = 0; i < graph_dim; i++)
+                printf("\n");
+            }
+        }
+
+        sssp = delete_sssp(sssp);
+        csr = delete_graph_csr(csr);
+    }
+    else
     {
-        graph = append_node(graph, input_node());
+        printf("\n\t[EMPTY GRAPH]\n");
     }
-
-    return graph;
 }
 
 
-/*
- *  Safe input method that can get an user input in different 
- *  data types (see the "enum type" for the complete list) by
- *  first acquiring user input in a buffer and then formatting it
- *  as specified by the function parameters. Then the function
- *  returns a void pointer that needs to be formatted afterwards
- *  into the correct type
+/* 
+ *  Prints to terminal the shortest path distances computed with the Bellman-Ford (SPFA) 
+ *  algorithm, where the src_nid is asked to the user at runtime
  */
-void * safe_input(const type_t type_selector, const unsigned long int bufsize, char *message)
+void print_bellman_ford_input(graph_t *graph)
 {
-    void *result;
-    char *buf, *format, *filtered_buf;
-    bool_t acquired_input;
+    id_t src_nid;
 
 
-    if (bufsize > 0)
+    if (graph)
     {
-        switch (type_selector)
-        {
-            case SHORT_INT:     format = "%hd";
-                                result = (short*)malloc(sizeof(short int));
-                                break;
-            
-            case U_SHORT_INT:   format = "%hu";
-                                result = (unsigned short int*)malloc(sizeof(unsigned short int));
-                                break;
-
-            case INT:           format = "%d";
-                                result = (int*)malloc(sizeof(int));
-                                break;
-            
-            case U_INT:         format = "%u";
-                                result = (unsigned int*)malloc(sizeof(unsigned int));
-                                break;
+        printf("\n[CURRENT OPERATION]\n - Calculating the Shortest Paths using the Bellman-Ford Algorithm (SPFA)\n");
 
-            case LONG_INT:      format = "%ld";
-                                result = (long int*)malloc(sizeof(long int));
-                                break;
-            
-            case U_LONG_INT:    format = "%lu";
-                                result = (unsigned long int*)malloc(sizeof(unsigned long int));
-                                break;
+        src_nid = select_node_id(graph, 
+            "\nAvailable node IDs (NIDs):\n",
+            "Insert source node ID: "
+        );
 
-            case FLOAT:         format = "%f";
-                                result = (float*)malloc(sizeof(float));
-                                break;
+        print_bellman_ford(graph, src_nid);
+    }
+}
 
-            case DOUBLE:        format = "%lf";
-                                result = (double*)malloc(sizeof(double));
-                                break;
 
-            case CHAR:          format = "%c";
-                                result = (char*)malloc(sizeof(char));
-                                break;
+/*
+ *  Compares bellman_ford_sssp() with the Dijkstra engines on the given graph, starting from
+ *  the node with ID 'src_nid': dijkstra_sssp(), whose distances are checked against the
+ *  Bellman-Ford ones, and dijkstra_mst(), which is only timed on graphs with at most
+ *  SSSP_BENCHMARK_MST_MAX_NODES nodes since its cost grows quadratically. Both are skipped
+ *  if the graph has negative edge weights, since Dijkstra's Algorithm can't handle them
+ */
+void print_bellman_ford_benchmark(graph_t *graph, id_t src_nid)
+{
+    graph_csr_t *csr;
+    graph_sssp_t *bellman_ford, *dijkstra;
+    int v, mismatches;
+    double start;
 
-            case STRING:        format = "%s";
-                                result = (char*)malloc(sizeof(char) * (bufsize + 1));
-                                break;
 
-            default:            format = STRING_EMPTY_PLACEHOLDER;
-                                result = NULL;
-        }
+    if (graph)
+    {
+        csr = create_graph_csr(graph);
+        bellman_ford = NULL;
+        dijkstra = NULL;
 
-        if (result)
+        if (
+            csr
+            && ( bellman_ford = create_sssp(csr->node_count) )
+            && ( dijkstra = create_sssp(csr->node_count) )
+        )
         {
-            if (( buf = (char*)malloc(sizeof(char) * (bufsize + 1)) ))
+            printf("\n[Bellman-Ford Benchmark] %d nodes, %d edges, weights in [%d, %d]\n", csr->node_count, csr->edge_count, csr->min_weight, csr->max_weight);
+
+            start = get_wall_time();
+
+            if (bellman_ford_sssp(csr, src_nid, bellman_ford))
             {
-                acquired_input = false;
-                fflush(stdin);
+                printf("\n\tbellman_ford_sssp(): %.3f ms", 1000 * (get_wall_time() - start));
 
-                do
+                if (csr->min_weight >= 0)
                 {
-                    if (message)
+                    start = get_wall_time();
+                    dijkstra_sssp(csr, src_nid, dijkstra);
+                    printf("\n\tdijkstra_sssp(): %.3f ms", 1000 * (get_wall_time() - start));
+
+                    for (v = 0, mismatches = 0; v < csr->node_count; v++)
                     {
-                        printf("%s", message);
+                        mismatches += (get_sssp_dist(csr, bellman_ford, csr->node_ids[v]) != get_sssp_dist(csr, dijkstra, csr->node_ids[v]));
                     }
 
-                    /* 
-                     *  NOTE: 
-                     *  -   fgets() puts an END_OF_STRING ('\0') character at the 
-                     *      end of the buffer if no errors occur during input
-                     */
-                    if (fgets(buf, bufsize + 1, stdin))
+                    if (csr->node_count <= SSSP_BENCHMARK_MST_MAX_NODES)
                     {
-                        if (type_selector != STRING)
-                        {
-                            if (1 == sscanf(buf, format, result))
-                            {
-                                acquired_input = true;
-                            }
-                        }
-                        else
-                        {
-                            filtered_buf = filter(buf, NEWLINE_CHAR);
-                            memcpy(result, filtered_buf, strlen(filtered_buf));
-
-                            acquired_input = true;
-                        }
+                        start = get_wall_time();
+                        dijkstra_mst(graph, src_nid);
+                        printf("\n\tdijkstra_mst(): %.3f ms", 1000 * (get_wall_time() - start));
+                    }
+                    else
+                    {
+                        printf("\n\tdijkstra_mst(): skipped (more than %d nodes)", SSSP_BENCHMARK_MST_MAX_NODES);
                     }
-                }
-                while ( !acquired_input );
 
-                free(buf);
+                    printf("\n\tDistance mismatches: %d\n", mismatches);
+                }
+                else
+                {
+                    printf("\n\tdijkstra_sssp(), dijkstra_mst(): skipped (negative edge weights)\n");
+                }
             }
             else
             {
-                printf("[safe_input()] ERROR: Memory allocation was unsuccessful\n");
+                printf("\n\tbellman_ford_sssp(): %.3f ms\n\t[NEGATIVE CYCLE FOUND]\n", 1000 * (get_wall_time() - start));
             }
         }
         else
         {
-            if (strcmp(format, STRING_EMPTY_PLACEHOLDER) == 0)
-            {
-                printf("[safe_input()] ERROR: Memory allocation was unsuccessful\n");
-            }
-            else
-            {
-                printf("[safe_input()] ERROR: The selected type does not exist in the list of specified ones\n");
-            }
+            printf("[print_bellman_ford_benchmark()] ERROR: Memory allocation was unsuccessful\n");
         }
+
+        bellman_ford = delete_sssp(bellman_ford);
+        dijkstra = delete_sssp(dijkstra);
+        csr = delete_graph_csr(csr);
     }
     else
     {
-        result = NULL;
-        printf("[safe_input()] ERROR: The give buffer size can only be greater than zero\n");
+        printf("\n\t[EMPTY GRAPH]\n");
     }
-
-    return result;
 }
 
 
 /*
- *  Given a file pointer containing the graph description, creates the 
- *  graph from such description
+ *  Prints the shortest distance between every pair of nodes of the given graph,
+ *  computed with the Floyd-Warshall Algorithm, as a matrix (rows are the source nodes)
  */
-graph_t * load_graph(char *filename)
+void print_floyd_warshall(graph_t *graph)
 {
-    FILE *src;
-    graph_t *graph, *ptr;
-    char *buf;
-    char *src_node_label, *dest_node_label, *edge_label;
-    id_t endpoints[2];
-    int label_len, edge_count, weight;
-
+    graph_t *ptr;
+    int i, j, dim;
+    int *mat;
 
-    graph = NULL;
-    ptr = NULL;
 
-    if (( buf = (char*)malloc(sizeof(char) * (STRING_BUFFER_SIZE + 1)) ))
+    if (graph && ( mat = create_graph_weight_matrix(graph) ))
     {
-        if (( src = fopen(filename, "r") ))
+        dim = graph_dim(graph);
+
+        if ( !floyd_warshall_apsp(mat, dim) )
         {
-            while (1 == fscanf(src, "%s", buf))
-            {
-                label_len = strlen(buf);
-                *(buf + label_len) = END_OF_STRING;
+            printf("\n[Floyd-Warshall] WARNING: The graph contains a negative cycle, distances are not reliable\n");
+        }
 
-                if (( src_node_label = (char*)malloc(sizeof(char) * (label_len + 1)) ))
-                {   
-                    strcpy(src_node_label, buf);
+        printf("\n[Floyd-Warshall] All-Pairs Shortest Paths:\n\n");
+
+        printf("[NID] ");
+        for (ptr = graph; ptr != NULL; ptr = ptr->next)
+        {
+            printf("[%u]", ptr->node.id);
+        }
+        printf("\n");
+
+        i = 0;
+
+        for (ptr = graph; ptr != NULL; ptr = ptr->next)
+        {
+            printf(" [%u]  ", ptr->node.id);
+
+            for (j = 0; j < dim; j++)
+            {
+                if (*(mat + j + (i * dim)) == GRAPH_MATRIX_INF)
+                {
+                    printf(" INF ");
                 }
                 else
                 {
-                    printf("[load_graph()] ERROR: Memory allocation was unsuccessful\n");
-                    strcpy(src_node_label, STRING_EMPTY_PLACEHOLDER);
+                    printf(" %d ", *(mat + j + (i * dim)));
                 }
+            }
 
-                graph = append_node(
-                    graph, 
-                    create_new_node(src_node_label)
-                );
+            printf("\n");
+            i++;
+        }
 
-                fscanf(src, "%[^\n]", buf);
-            }
+        printf("\n");
+        free(mat);
+    }
+    else if (graph == NULL)
+    {
+        printf("\n\t[EMPTY GRAPH]\n");
+    }
+}
 
-            rewind(src);
 
-            while (1 == fscanf(src, "%s", buf))
+/*
+ *  Compares the all-pairs shortest path implementations on the given graph:
+ *  floyd_warshall_apsp() on the weight matrix, johnson_apsp() and one single-source search
+ *  from every node (dijkstra_sssp(), or bellman_ford_sssp() if some weights are negative).
+ *  The distances of the last two are checked against the Floyd-Warshall ones. The matrices
+ *  take node_count x node_count cells, so the graph should be small (a few thousand nodes)
+ */
+void print_apsp_benchmark(graph_t *graph)
+{
+    graph_csr_t *csr;
+    graph_sssp_t *sssp;
+    int *mat;
+    long int *dist;
+    int n, i, j, mismatches;
+    long int expected;
+    double start, elapsed;
+
+
+    if (graph)
+    {
+        csr = create_graph_csr(graph);
+        sssp = NULL;
+        mat = NULL;
+        dist = NULL;
+
+        if (
+            csr
+            && ( sssp = create_sssp(csr->node_count) )
+            && ( mat = create_graph_weight_matrix(graph) )
+        )
+        {
+            n = csr->node_count;
+            printf("\n[APSP Benchmark] %d nodes, %d edges, weights in [%d, %d]\n", n, csr->edge_count, csr->min_weight, csr->max_weight);
+
+            start = get_wall_time();
+
+            if (floyd_warshall_apsp(mat, n))
             {
-                label_len = strlen(buf);
-                *(buf + label_len) = END_OF_STRING;
+                printf("\n\tfloyd_warshall_apsp(): %.3f ms", 1000 * (get_wall_time() - start));
 
-                if (1 != fscanf(src, " (%d)", &edge_count))
-                {
-                    edge_count = 0;
-                }
+                start = get_wall_time();
+                dist = johnson_apsp(csr);
+                printf("\n\tjohnson_apsp(): %.3f ms", 1000 * (get_wall_time() - start));
 
-                if (ptr == NULL)
+                for (i = 0, mismatches = 0; i < n * n && dist; i++)
                 {
-                    ptr = graph;
+                    expected = (mat[i] == GRAPH_MATRIX_INF) ? GRAPH_DIST_INF : mat[i];
+                    mismatches += (dist[i] != expected);
                 }
-                else
-                {
-                    ptr = ptr->next;
-                }  
-  
-                if (
-                    (1 == fscanf(src, "%s", buf)) 
-                    && (0 == strcmp(buf, FILE_NODE_EDGE_SEP_STRING))
-                )
+
+                elapsed = 0;
+
+                for (i = 0; i < n; i++)
                 {
-                    endpoints[0] = ptr->node.id;
+                    start = get_wall_time();
 
-                    while (edge_count)
+                    if (csr->min_weight >= 0)
                     {
-                        if (
-                            ( dest_node_label = (char*)malloc(sizeof(char) * (STRING_BUFFER_SIZE + 1)) )
-                            && ( edge_label = (char*)malloc(sizeof(char) * (STRING_BUFFER_SIZE + 1)) )
-                        )
-                        {
-                            fscanf(src, " %[^(]", dest_node_label);
-                            *(dest_node_label + STRING_BUFFER_SIZE) = END_OF_STRING;
-
-                            fscanf(src, "(%[^,]", edge_label);
-                            *(edge_label + STRING_BUFFER_SIZE) = END_OF_STRING;                            
-
-                            fscanf(src, ", %[^),]", buf);
-                            weight = *(buf) - ZERO_CHAR;
-
-                            if (edge_count > 1)
-                            {
-                                fscanf(src, "%[^ \n]", buf);
-                            }
-
-                            endpoints[1] = get_id_from_node_label(graph, dest_node_label);
+                        dijkstra_sssp(csr, csr->node_ids[i], sssp);
+                    }
+                    else
+                    {
+                        bellman_ford_sssp(csr, csr->node_ids[i], sssp);
+                    }
 
-                            ptr->node.edges = append_edge(
-                                ptr->node.edges,
-                                create_new_edge(
-                                    weight,
-                                    edge_label,
-                                    endpoints
-                                )
-                            );
-                        }
-                        else
-                        {
-                            printf("[load_graph()] ERROR: Memory allocation was unsuccessful\n");
-                        }
+                    elapsed += get_wall_time() - start;
 
-                        edge_count--;
+                    for (j = 0; j < n; j++)
+                    {
+                        expected = (mat[j + (i * n)] == GRAPH_MATRIX_INF) ? GRAPH_DIST_INF : mat[j + (i * n)];
+                        mismatches += (get_sssp_dist(csr, sssp, csr->node_ids[j]) != expected);
                     }
+                }
 
-                    fscanf(src, "%[^\n]", buf);
-                }                     
+                printf("\n\t%d x %s: %.3f ms", n, (csr->min_weight >= 0) ? "dijkstra_sssp()" : "bellman_ford_sssp()", 1000 * elapsed);
+                printf("\n\tDistance mismatches: %d\n", mismatches);
+            }
+            else
+            {
+                printf("\n\tfloyd_warshall_apsp(): %.3f ms\n\t[NEGATIVE CYCLE FOUND]\n", 1000 * (get_wall_time() - start));
             }
-
-            fclose(src);
         }
         else
         {
-            printf("[load_graph()] ERROR: The given file '%s' does not exist\n", filename);
+            printf("[print_apsp_benchmark()] ERROR: The compact view or the weight matrix couldn't be created\n");
         }
+
+        free(dist);
+        free(mat);
+        sssp = delete_sssp(sssp);
+        csr = delete_graph_csr(csr);
     }
     else
     {
-        printf("[load_graph()] ERROR: Memory allocation was unsuccessful\n");
+        printf("\n\t[EMPTY GRAPH]\n");
     }
-
-    return graph;
 }
 
 
 /*
- *  Given a graph and a filename, the function saves the graph as follows:
- *      
- *      "src_node_label (src_node_edges_count) -> dest_node_label(edge_label, edge_weight), "
- * 
- *  NOTE:
- *   - If a node has more that one edge, they are saved concatenated on the same line
- * 
- *   - If the provided filename is of an unexisting file, fopen() creates a new file
- *     thus there'll be always a savefile, either already existing or newly created
+ *  Prints to terminal the shortest path from the node with ID 'src_nid' to the node
+ *  with ID 'dest_nid', computed with the Bidirectional Dijkstra's Algorithm
  */
-void save_graph(graph_t *graph, char *filename)
+void print_shortest_path(graph_t *graph, id_t src_nid, id_t dest_nid)
 {
-    FILE *f;
-    graph_t *ptr;
-    graph_edge_list_t *ptr2;
-    char  *buf;
-    long int edge_count;
-    id_t dest_node_id;
+    graph_csr_t *csr, *reverse;
+    graph_sssp_t *forward, *backward;
+    id_list_t *path;
+    long int dist;
 
 
-    if (( buf = (char*)malloc(sizeof(char) * (4 * STRING_BUFFER_SIZE + 1))))
+    if (graph)
     {
-        if (( f = fopen(filename, "w") ))
+        csr = create_graph_csr(graph);
+        reverse = create_graph_csr_transpose(csr);
+        forward = NULL;
+        backward = NULL;
+
+        if (
+            reverse
+            && ( forward = create_sssp(csr->node_count) )
+            && ( backward = create_sssp(csr->node_count) )
+        )
         {
-            ptr = graph;
+            path = bidirectional_dijkstra(csr, reverse, src_nid, dest_nid, forward, backward, &dist);
 
-            while (ptr)
+            if (dist == GRAPH_DIST_INF)
             {
-                strcat(buf, ptr->node.label);
-
-                ptr2 = ptr->node.edges;
-                edge_count = 0;
-                
-                while (ptr2)
-                {
-                    edge_count++;
-                    ptr2 = ptr2->next;
-                }
-
-                strcat(buf, " (");
-                strcat(buf, int_to_string(edge_count));
-                strcat(buf, ")");
-                strcat(buf, " "FILE_NODE_EDGE_SEP_STRING" ");
-
-                ptr2 = ptr->node.edges;
-
-                while (ptr2)
-                {
-                    dest_node_id = ptr2->edge.endpoint_ids[1];
-
-                    if (dest_node_id != ERROR_ID)
-                    {
-                        strcat(buf, (get_node_from_id(graph, dest_node_id))->label);
-                        strcat(buf, "(");
-                        strcat(buf, ptr2->edge.label);
-                        strcat(buf, ", ");
-                        strcat(buf, int_to_string(ptr2->edge.weight));
-                        strcat(buf, "), ");
-                    }
-                    
-                    ptr2 = ptr2->next;
-                }
-
-                strcat(buf, "\n");
-                *(buf + 4 * STRING_BUFFER_SIZE) = END_OF_STRING;
-
-                fputs(buf, f);
-                *(buf) = END_OF_STRING;
-                
-                ptr = ptr->next;
+                printf("\n[Bidirectional Dijkstra] Node (NID=%u) is UNREACHABLE from node (NID=%u)\n", dest_nid, src_nid);
             }
-            
-            fclose(f);
-        }
-        else
-        {
-            printf("[save_graph()] ERROR: The given file '%s' does not exist\n", filename);
+            else
+            {
+                printf("\n[Bidirectional Dijkstra] Shortest Path from (NID=%u) to (NID=%u):\n", src_nid, dest_nid);
+                printf("\n\tDIST=%ld\n\tEIDs: ", dist);
+                print_id_list(path);
+                printf("\n");
+            }
+
+            path = delete_all_revoked_id(path);
         }
-        
-        free(buf);
+
+        forward = delete_sssp(forward);
+        backward = delete_sssp(backward);
+        reverse = delete_graph_csr(reverse);
+        csr = delete_graph_csr(csr);
     }
     else
     {
-        printf("[save_file()] ERROR: Memory allocation was unsuccessful\n");
+        printf("\n\t[EMPTY GRAPH]\n");
     }
 }
 
 
-/* 
- *  Creates a standalone node (meaning that it has 0 edges at time of creation)
- *  with an additional label 
- * 
- *  (+) Prioritizes the use of revoked_node_ids to initialize the
- *      new node instead of straight up using a new node ID
+/*
+ *  Prints to terminal the shortest path between two nodes computed with the Bidirectional 
+ *  Dijkstra's Algorithm, where both node IDs are asked to the user at runtime
  */
-graph_node_t create_new_node(char *label)
+void print_shortest_path_input(graph_t *graph)
 {
-    graph_node_t new_node;
+    id_t src_nid, dest_nid;
 
 
-    new_node.label = label;
-    new_node.edges = NULL;
-
-    if (revoked_node_ids)
-    {
-        revoked_node_ids = pop_front_revoked_id(revoked_node_ids, &(new_node.id));
-    }
-    else
+    if (graph)
     {
-        new_node.id = set_node_id();
-    }
+        printf("\n[CURRENT OPERATION]\n - Calculating the Shortest Path between two nodes using the Bidirectional Dijkstra's Algorithm\n");
 
-    return new_node;
+        src_nid = select_node_id(graph, 
+            "\nAvailable node IDs (NIDs):\n",
+            "Insert source node ID: "
+        );
+
+        dest_nid = select_node_id(graph, 
+            "\nAvailable node IDs (NIDs):\n",
+            "Insert destination node ID: "
+        );
+
+        print_shortest_path(graph, src_nid, dest_nid);
+    }
 }
 
 
 /*
- *  Creates a new standalone edge element with all its properties 
- *  set with the given parameters
- * 
- *  (+) Prioritizes the use of revoked_edge_ids to initialize the
- *      new edge instead of straight up using a new edge ID
+ *  Prints to terminal the 'k' shortest loopless paths between two nodes, computed with
+ *  Yen's Algorithm
  */
-graph_edge_t create_new_edge(int weight, char *label, id_t endpoint_ids[2])
+void print_k_shortest_paths(graph_t *graph, id_t src_nid, id_t dest_nid, int k)
 {
-    graph_edge_t new_edge;
-    char *new_label;
-    int len, i;
+    graph_csr_t *csr;
+    graph_sssp_t *sssp;
+    graph_paths_t *paths;
+    int i;
 
 
-    len = strlen(label);
+    if (graph)
+    {
+        csr = create_graph_csr(graph);
+        sssp = NULL;
 
-    new_edge.weight = weight;
-    new_edge.endpoint_ids[0] = endpoint_ids[0];
-    new_edge.endpoint_ids[1] = endpoint_ids[1];
+        if (csr && ( sssp = create_sssp(csr->node_count) ))
+        {
+            paths = yen_k_shortest_paths(csr, src_nid, dest_nid, k, sssp);
 
-    if (revoked_edge_ids)
-    {
-        revoked_edge_ids = pop_front_revoked_id(revoked_edge_ids, &(new_edge.id));
+            if (paths)
+            {
+                printf("\n[Yen's Algorithm] %d Shortest Paths from (NID=%u) to (NID=%u):\n", paths->count, src_nid, dest_nid);
+
+                for (i = 0; i < paths->count; i++)
+                {
+                    printf("\n\t(%d) DIST=%ld\n\tEIDs: ", i + 1, paths->dists[i]);
+                    print_id_list(paths->paths[i]);
+                }
+
+                printf("\n");
+            }
+            else
+            {
+                printf("\n[Yen's Algorithm] Node (NID=%u) is UNREACHABLE from node (NID=%u)\n", dest_nid, src_nid);
+            }
+
+            paths = delete_graph_paths(paths);
+        }
+
+        sssp = delete_sssp(sssp);
+        csr = delete_graph_csr(csr);
     }
     else
     {
-        new_edge.id = set_edge_id();
+        printf("\n\t[EMPTY GRAPH]\n");
     }
+}
 
-    if (( new_label =  (char*)malloc(sizeof(char) * (len + 1)) ))
-    {
-        for (i = 0; i < len; i++)
-        {
-            *(new_label + i) = *(label + i);
-        }
-        *(new_label + len) = END_OF_STRING;
 
-        new_edge.label = new_label;
-    }
-    else
+/*
+ *  Prints to terminal the k shortest loopless paths between two nodes computed with 
+ *  Yen's Algorithm, where both node IDs and k are asked to the user at runtime
+ */
+void print_k_shortest_paths_input(graph_t *graph)
+{
+    id_t src_nid, dest_nid;
+    int k;
+
+
+    if (graph)
     {
-        printf("[create_new_edge()] ERROR: Memory allocation was unsuccessful\n");
-        new_edge.label = NULL;
-    }    
+        printf("\n[CURRENT OPERATION]\n - Calculating the K Shortest Paths between two nodes using Yen's Algorithm\n");
 
-    return new_edge;
+        src_nid = select_node_id(graph, 
+            "\nAvailable node IDs (NIDs):\n",
+            "Insert source node ID: "
+        );
+
+        dest_nid = select_node_id(graph, 
+            "\nAvailable node IDs (NIDs):\n",
+            "Insert destination node ID: "
+        );
+
+        k = *((int*)safe_input(INT, STRING_BUFFER_SIZE, "Insert amount of paths: "));
+
+        print_k_shortest_paths(graph, src_nid, dest_nid, k);
+    }
 }
 
 
-/* 
- *  Given a graph, it returns a new graph that has the same nodes
- *  and edges but with newly attributed node and edge IDs
+/*
+ *  Measures the query throughput of the Contraction Hierarchies on the given graph: after 
+ *  the preprocessing (see create_graph_ch()), it answers 'query_count' shortest path queries 
+ *  between random pairs of nodes, and prints the preprocessing time, the average latency and 
+ *  the queries per second. The first CH_BENCHMARK_CHECK_COUNT queries are also answered
+ *  with the Bidirectional Dijkstra's Algorithm, to compare the latencies and check the
+ *  distances. The same seed is used on every call, so the benchmark is repeatable
  */
-graph_t * create_graph_copy(graph_t *old_graph)
+void print_ch_benchmark(graph_t *graph, int query_count)
 {
-    graph_t *graph, *ptr, *ptr2;
-    graph_t *old_ptr, *old_ptr2;
-    graph_node_t *node;
-    graph_edge_list_t *ptr3;
-    id_t endpoints[2];
-    bool_t found;
-    int i, j, dim;
-    int *old_mat;
+    graph_csr_t *csr, *reverse;
+    graph_ch_t *ch;
+    graph_sssp_t *forward, *backward;
+    id_list_t *path;
+    id_t *pairs;
+    int i, n, checks, mismatches;
+    long int dist, check_dist;
+    double start, preprocessing, ch_time, dijkstra_time;
 
 
-    graph = NULL;
-
-    if (old_graph)
+    if (graph && query_count > 0)
     {
-        old_mat = create_graph_matrix(old_graph);
-        ptr = old_graph;
+        csr = create_graph_csr(graph);
+        reverse = create_graph_csr_transpose(csr);
+        forward = NULL;
+        backward = NULL;
+        pairs = NULL;
+        ch = NULL;
 
-        while (ptr)
-        {       
-            graph = append_node(
-                graph,
-                create_new_node(
-                    ptr->node.label
-                )
-            );
+        if (
+            reverse
+            && ( forward = create_sssp(csr->node_count) )
+            && ( backward = create_sssp(csr->node_count) )
+            && ( pairs = (id_t*)malloc(sizeof(id_t) * 2 * query_count) )
+        )
+        {
+            n = csr->node_count;
+            srand(1);
 
-            ptr = ptr->next;
-        }
+            for (i = 0; i < 2 * query_count; i++)
+            {
+                pairs[i] = csr->node_ids[((unsigned long int)rand() * ((unsigned long int)RAND_MAX + 1) + rand()) % n];
+            }
 
-        dim = graph_dim(old_graph);
-        ptr = graph;
-        old_ptr = old_graph;
-        i = 0;
+            start = get_wall_time();
+            ch = create_graph_ch(csr);
+            preprocessing = get_wall_time() - start;
+        }
 
-        while (ptr && old_ptr)
+        if (ch)
         {
-            endpoints[0] = ptr->node.id;
-            ptr2 = graph;
-            old_ptr2 = old_graph;
-            j = 0;
+            start = get_wall_time();
 
-            while (ptr2 && old_ptr2)
+            for (i = 0; i < query_count; i++)
             {
-                if (*(old_mat + j + (i * dim)) == 1)
-                {
-                    endpoints[1] = ptr2->node.id;
+                path = ch_query(csr, ch, pairs[2 * i], pairs[2 * i + 1], forward, backward, &dist);
+                path = delete_all_revoked_id(path);
+            }
 
-                    node = get_node_from_id(old_graph, old_ptr->node.id);
-                    ptr3 = node->edges;
-                    found = false;
+            ch_time = get_wall_time() - start;
+            checks = (query_count < CH_BENCHMARK_CHECK_COUNT) ? query_count : CH_BENCHMARK_CHECK_COUNT;
+            mismatches = 0;
+            dijkstra_time = 0;
 
-                    while (ptr3 && !found)
-                    {
-                        if (ptr3->edge.endpoint_ids[1] == old_ptr2->node.id)
-                        {
-                            found = true;
-                        }
-                        else
-                        {
-                            ptr3 = ptr3->next;
-                        }
-                    }
+            for (i = 0; i < checks; i++)
+            {
+                start = get_wall_time();
+                path = bidirectional_dijkstra(csr, reverse, pairs[2 * i], pairs[2 * i + 1], forward, backward, &check_dist);
+                dijkstra_time += get_wall_time() - start;
+                path = delete_all_revoked_id(path);
 
-                    if (found)
-                    {
-                        ptr->node.edges = append_edge(
-                            ptr->node.edges,
-                            create_new_edge(
-                                ptr3->edge.weight,
-                                ptr3->edge.label,
-                                endpoints
-                            )
-                        );
-                    }
-                    else
-                    {
-                        ptr->node.edges = append_edge(
-                            ptr->node.edges,
-                            create_new_edge(
-                                DEFAULT_COPIED_EDGE_WEIGHT,
-                                DEFAULT_COPIED_EDGE_LABEL,
-                                endpoints
-                            )
-                        );
-                    }
-                }
+                path = ch_query(csr, ch, pairs[2 * i], pairs[2 * i + 1], forward, backward, &dist);
+                path = delete_all_revoked_id(path);
 
-                ptr2 = ptr2->next;
-                old_ptr2 = old_ptr2->next;
-                j++;
+                if (dist != check_dist)
+                {
+                    mismatches++;
+                }
             }
 
-            ptr = ptr->next;
-            old_ptr = old_ptr->next;
-            i++;
+            printf("\n[Contraction Hierarchies Benchmark] %d nodes, %d edges\n", csr->node_count, csr->edge_count);
+            printf("\n\tPreprocessing: %.3f s (%d shortcuts)", preprocessing, ch->shortcut_count);
+            printf("\n\tCH queries: %d in %.3f s -> %.3f ms/query, %.0f queries/s", 
+                query_count, ch_time, 1000 * ch_time / query_count, (ch_time > 0) ? query_count / ch_time : 0
+            );
+            printf("\n\tBidirectional Dijkstra: %.3f ms/query (on %d queries)", 1000 * dijkstra_time / checks, checks);
+            printf("\n\tDistance mismatches: %d\n", mismatches);
+        }
+        else
+        {
+            printf("[print_ch_benchmark()] ERROR: Preprocessing was unsuccessful\n");
         }
 
-        /*
-        while (ptr)
+        free(pairs);
+        ch = delete_graph_ch(ch);
+        forward = delete_sssp(forward);
+        backward = delete_sssp(backward);
+        reverse = delete_graph_csr(reverse);
+        csr = delete_graph_csr(csr);
+    }
+    else
+    {
+        printf("\n\t[EMPTY GRAPH]\n");
+    }
+}
+
+
+/*
+ *  Compares the single-source shortest path implementations on the given graph, starting
+ *  from the node with ID 'src_nid': the binary heap, Dial's buckets (only if the maximum weight
+ *  is at most DIAL_MAX_WEIGHT) and the radix heap, whose distances are also checked against
+ *  each other, and dijkstra_mst(), which is only timed on graphs with at most 
+ *  SSSP_BENCHMARK_MST_MAX_NODES nodes since its cost grows quadratically
+ */
+void print_sssp_benchmark(graph_t *graph, id_t src_nid)
+{
+    graph_csr_t *csr;
+    graph_sssp_t *heap, *buckets;
+    int v, mismatches;
+    double start;
+
+
+    if (graph)
+    {
+        csr = create_graph_csr(graph);
+        heap = NULL;
+        buckets = NULL;
+
+        if (
+            csr
+            && ( heap = create_sssp(csr->node_count) )
+            && ( buckets = create_sssp(csr->node_count) )
+        )
         {
-            endpoints[0] = ptr->node.id;
-            ptr2 = graph;
-            j = 0;
+            printf("\n[SSSP Benchmark] %d nodes, %d edges, weights in [%d, %d]\n", csr->node_count, csr->edge_count, csr->min_weight, csr->max_weight);
 
-            while (ptr2)
+            start = get_wall_time();
+
+            if (binary_heap_sssp(csr, src_nid, heap))
             {
-                if (*(old_mat + j + (i * dim)) == 1)
+                printf("\n\tBinary heap: %.3f ms", 1000 * (get_wall_time() - start));
+
+                if (csr->max_weight <= DIAL_MAX_WEIGHT)
                 {
-                    endpoints[1] = ptr2->node.id;
-                    ptr3 = old_graph;
-                    k = 0;
+                    start = get_wall_time();
+                    dial_sssp(csr, src_nid, buckets);
+                    printf("\n\tDial's buckets: %.3f ms", 1000 * (get_wall_time() - start));
+                }
+                else
+                {
+                    printf("\n\tDial's buckets: skipped (max weight > %d)", DIAL_MAX_WEIGHT);
+                }
 
-                    while (ptr3->next && k < i)
-                    {
-                        ptr3 = ptr3->next;
-                        k++;
-                    }
+                for (v = 0, mismatches = 0; v < csr->node_count && csr->max_weight <= DIAL_MAX_WEIGHT; v++)
+                {
+                    mismatches += (get_sssp_dist(csr, heap, csr->node_ids[v]) != get_sssp_dist(csr, buckets, csr->node_ids[v]));
+                }
 
-                    k = 0;
-                    ptr4 = ptr3->node.edges;
+                start = get_wall_time();
+                radix_heap_sssp(csr, src_nid, buckets);
+                printf("\n\tRadix heap: %.3f ms", 1000 * (get_wall_time() - start));
 
-                    while (ptr4->next && k < j)
-                    {
-                        ptr4 = ptr4->next;
-                        k++;
-                    }
+                for (v = 0; v < csr->node_count; v++)
+                {
+                    mismatches += (get_sssp_dist(csr, heap, csr->node_ids[v]) != get_sssp_dist(csr, buckets, csr->node_ids[v]));
+                }
 
-                    ptr->node.edges = append_edge(
-                        ptr->node.edges,
-                        create_new_edge(
-                            ptr4->edge.weight,
-                            ptr4->edge.label,
-                            endpoints
-                        )
-                    );
+                if (csr->node_count <= SSSP_BENCHMARK_MST_MAX_NODES)
+                {
+                    start = get_wall_time();
+                    dijkstra_mst(graph, src_nid);
+                    printf("\n\tdijkstra_mst(): %.3f ms", 1000 * (get_wall_time() - start));
+                }
+                else
+                {
+                    printf("\n\tdijkstra_mst(): skipped (more than %d nodes)", SSSP_BENCHMARK_MST_MAX_NODES);
                 }
 
-                ptr2 = ptr2->next;
-                j++;
+                printf("\n\tDistance mismatches: %d\n", mismatches);
             }
-
-            ptr = ptr->next;
-            i++;
         }
-        */
-    }
+        else
+        {
+            printf("[print_sssp_benchmark()] ERROR: Memory allocation was unsuccessful\n");
+        }
 
-    return graph;
+        heap = delete_sssp(heap);
+        buckets = delete_sssp(buckets);
+        csr = delete_graph_csr(csr);
+    }
+    else
+    {
+        printf("\n\t[EMPTY GRAPH]\n");
+    }
 }
 
 
 /*
- *  Returns a pointer to the node with the given id if
- *  it is found in the graph, NULL otherwise
+ *  Measures the strong scaling of delta_stepping_sssp() on the given graph, starting from the
+ *  node with ID 'src_nid': the same search is timed with 1, 2, 4, ... threads up to
+ *  get_thread_count(), printing the speedup over a single thread and checking the distances 
+ *  against dijkstra_sssp(), which is also timed as the sequential reference
  */
-graph_node_t * get_node_from_id(graph_t *graph, id_t id)
+void print_delta_stepping_benchmark(graph_t *graph, id_t src_nid, int delta)
 {
-    graph_t *ptr;
-
+    graph_csr_t *csr;
+    graph_sssp_t *reference, *sssp;
+    int threads, max_threads, v, mismatches;
+    double start, elapsed, single;
 
-    ptr = graph;
 
-    while (ptr && ptr->node.id != id)
+    if (graph)
     {
-        ptr = ptr->next;
-    }
+        csr = create_graph_csr(graph);
+        reference = NULL;
+        sssp = NULL;
 
-    return &(ptr->node);
-}
+        if (
+            csr
+            && ( reference = create_sssp(csr->node_count) )
+            && ( sssp = create_sssp(csr->node_count) )
+        )
+        {
+            printf("\n[Delta-Stepping Benchmark] %d nodes, %d edges, weights in [%d, %d]\n", csr->node_count, csr->edge_count, csr->min_weight, csr->max_weight);
 
+            start = get_wall_time();
 
-/*
- *  Returns the given node's ID if it exists, 0 (ERROR_ID) otherwise
- */
-id_t get_id_from_node(graph_node_t *node)
-{
-    if (node)
-    {
-        return node->id;
+            if (dijkstra_sssp(csr, src_nid, reference))
+            {
+                printf("\n\tdijkstra_sssp(): %.3f ms\n", 1000 * (get_wall_time() - start));
+
+                max_threads = get_thread_count();
+                single = 0;
+
+                for (threads = 1; threads <= max_threads; threads = (threads < max_threads && 2 * threads > max_threads) ? max_threads : 2 * threads)
+                {
+                    #ifdef _OPENMP
+                        omp_set_num_threads(threads);
+                    #endif
+
+                    start = get_wall_time();
+                    delta_stepping_sssp(csr, src_nid, sssp, delta);
+                    elapsed = get_wall_time() - start;
+                    single = (threads == 1) ? elapsed : single;
+
+                    for (v = 0, mismatches = 0; v < csr->node_count; v++)
+                    {
+                        mismatches += (get_sssp_dist(csr, reference, csr->node_ids[v]) != get_sssp_dist(csr, sssp, csr->node_ids[v]));
+                    }
+
+                    printf("\n\t%2d threads: %.3f ms (speedup %.2fx, %d distance mismatches)", threads, 1000 * elapsed, (elapsed > 0) ? single / elapsed : 0, mismatches);
+                }
+
+                #ifdef _OPENMP
+                    omp_set_num_threads(max_threads);
+                #endif
+
+                printf("\n");
+            }
+        }
+        else
+        {
+            printf("[print_delta_stepping_benchmark()] ERROR: Memory allocation was unsuccessful\n");
+        }
+
+        reference = delete_sssp(reference);
+        sssp = delete_sssp(sssp);
+        csr = delete_graph_csr(csr);
     }
     else
     {
-        return ERROR_ID;
+        printf("\n\t[EMPTY GRAPH]\n");
     }
 }
 
 
 /*
- *  Given a node label belonging to a node of the given graph,
- *  it returns the corresponding node ID
- * 
- *  In case there's duplicated labels, it returns the ID of the
- *  first node found in the graph
+ *  Prints to terminal the PageRank of every node of the graph (see pagerank()), 
+ *  together with the residual and the time of every iteration
  */
-id_t get_id_from_node_label(graph_t *graph, char *label)
+void print_pagerank(graph_t *graph)
 {
-    id_t node_id;
-    bool_t found;
-
+    graph_csr_t *csr;
+    float *rank;
+    int v;
 
-    node_id = ERROR_ID;
-    found = false;
 
-    while (graph && !found)
+    if (graph)
     {
-        if (strcmp(graph->node.label, label) == 0)
+        csr = create_graph_csr(graph);
+
+        if (csr)
         {
-            node_id = graph->node.id;
-            found = true;
+            printf("\n[PageRank] Power iteration (damping=%.2f):\n", PAGERANK_DAMPING);
+
+            rank = pagerank(csr, PAGERANK_DAMPING, PAGERANK_TOLERANCE, PAGERANK_MAX_ITERATIONS, true);
+
+            if (rank)
+            {
+                printf("\n");
+
+                for (v = 0; v < csr->node_count; v++)
+                {
+                    printf("\t[%s] (NID=%u): %.6f\n", csr->nodes[v]->label, csr->node_ids[v], rank[v]);
+                }
+            }
+
+            free(rank);
         }
 
-        graph = graph->next;
+        csr = delete_graph_csr(csr);
+    }
+    else
+    {
+        printf("\n\t[EMPTY GRAPH]\n");
     }
-
-    return node_id;
 }
 
 
 /*
- *  Searches the graph for the node with ID 'node_id' and, if it's found, 
- *  adds to the edges list the new edges contained in the new_edges list
+ *  Prints to terminal the personalized PageRank of the nodes reached from the given 
+ *  seed node (see personalized_pagerank())
  */
-void add_new_edges_to_node(graph_t *graph, id_t node_id, graph_edge_list_t *new_edges)
+void print_personalized_pagerank(graph_t *graph, id_t seed_nid)
 {
-    while (graph && (graph->node.id != node_id))
-    {
-        graph = graph->next;
-    }
+    graph_csr_t *csr;
+    float *rank;
+    int v;
+
 
     if (graph)
     {
-        while (new_edges)
+        csr = create_graph_csr(graph);
+        rank = personalized_pagerank(csr, seed_nid, PAGERANK_DAMPING, PPR_EPSILON);
+
+        if (rank)
         {
-            graph->node.edges = append_edge(graph->node.edges, new_edges->edge);
-            new_edges = new_edges->next;
+            printf("\n[Personalized PageRank] Seed Node (NID=%u), damping=%.2f:\n\n", seed_nid, PAGERANK_DAMPING);
+
+            for (v = 0; v < csr->node_count; v++)
+            {
+                if (rank[v] > 0)
+                {
+                    printf("\t[%s] (NID=%u): %.6f\n", csr->nodes[v]->label, csr->node_ids[v], rank[v]);
+                }
+            }
         }
+
+        free(rank);
+        csr = delete_graph_csr(csr);
+    }
+    else
+    {
+        printf("\n\t[EMPTY GRAPH]\n");
     }
 }
 
 
 /*
- *  Searches the graph for the node with ID 'node_id' and, if it's found, 
- *  then it proceeds to change the node's label with the new_label string
+ *  Prints to terminal the personalized PageRank of the nodes reached from 
+ *  a seed node, whose ID is asked to the user at runtime
  */
-void change_node_label(graph_t *graph, id_t node_id, char *new_label)
+void print_personalized_pagerank_input(graph_t *graph)
 {
-    while (graph && (graph->node.id != node_id))
-    {
-        graph = graph->next;
-    }
+    id_t seed_nid;
+
 
     if (graph)
     {
-        if (graph->node.label)
-        {
-            free(graph->node.label);
-        }
+        printf("\n[CURRENT OPERATION]\n - Calculating the Personalized PageRank from a seed node\n");
 
-        graph->node.label = new_label;
+        seed_nid = select_node_id(graph, 
+            "\nAvailable node IDs (NIDs):\n",
+            "Insert seed node ID: "
+        );
+
+        print_personalized_pagerank(graph, seed_nid);
     }
 }
 
 
 /*
- *  Searches for each node in the graph the edge with ID 'edge_id' and, if it's 
- *  found, then it proceeds to change the edge's label with the new_label string
+ *  Prints to terminal the betweenness centrality of every node of the graph (see 
+ *  betweenness_centrality()), on the edge weights if 'weighted' is true
  */
-void change_edge_label(graph_t *graph, id_t edge_id, char *new_label)
+void print_betweenness(graph_t *graph, bool_t weighted)
 {
-    bool_t changed;
-
+    graph_csr_t *csr;
+    double *scores;
+    int v;
 
-    changed = false;
 
-    while (graph && !changed)
+    if (graph)
     {
-        while (graph->node.edges && !changed)
+        csr = create_graph_csr(graph);
+        scores = csr ? betweenness_centrality(csr, weighted, 0, 0) : NULL;
+
+        if (scores)
         {
-            if (graph->node.edges->edge.id == edge_id)
-            {
-                if (graph->node.edges->edge.label)
-                {
-                    free(graph->node.edges->edge.label);
-                }
-                graph->node.edges->edge.label = new_label;
+            printf("\n[Brandes' Algorithm] Betweenness Centrality (%s):\n\n", weighted ? "weighted" : "unweighted");
 
-                changed = true;
-            }
-            else
+            for (v = 0; v < csr->node_count; v++)
             {
-                graph->node.edges = graph->node.edges->next;
+                printf("\t[%s] (NID=%u): %.3f\n", csr->nodes[v]->label, csr->node_ids[v], scores[v]);
             }
         }
 
-        graph = graph->next;
+        free(scores);
+        csr = delete_graph_csr(csr);
+    }
+    else
+    {
+        printf("\n\t[EMPTY GRAPH]\n");
     }
 }
 
 
 /*
- *  Given a graph, it finds each duplicated node label  
- *  and substitutes it with an unique label 
- *  (Achieved through the use of the ID as a 'hash' for the node label)
+ *  Helper function that stores in 'top' the indexes of the 'k' highest scores, from the 
+ *  highest one (ties are broken by index). Each step selects the best score that comes
+ *  after the previous one, in O(k n), which is fine for the few nodes of a ranking
  */
-graph_t * change_duplicated_node_labels(graph_t *graph, char *substitute)
+static void select_top_scores(const double *scores, int n, int k, int *top)
 {
-    graph_t *ptr, *ptr2;
+    int i, v, best;
 
 
-    ptr = graph;
-
-    while (ptr)
+    for (i = 0; i < k; i++)
     {
-        ptr2 = graph;
+        best = ERROR_INDEX;
 
-        while (ptr2)
+        for (v = 0; v < n; v++)
         {
-            if ((ptr != ptr2) && strcmp(ptr->node.label, ptr2->node.label) == 0)
+            if (
+                ( i == 0 || scores[v] < scores[top[i - 1]] || (scores[v] == scores[top[i - 1]] && v > top[i - 1]) )
+                && ( best == ERROR_INDEX || scores[v] > scores[best] )
+            )
             {
-                if (ptr2->node.label)
-                {
-                    free(ptr2->node.label);
-                }
-
-                ptr2->node.label = strconcat(substitute, int_to_string(ptr2->node.id));
+                best = v;
             }
-
-            ptr2 = ptr2->next;
         }
 
-        ptr = ptr->next;
-    }
-
-    return graph;
-}
-
-
-/*
- *  Searches the graph for the node with ID 'node_id' and, if it's found, then
- *  it searches its edges for the edge with edge ID 'edge_id' and, if it's found,
- *  then proceeds to deleting that edge from the edges list of the node
- */
-void delete_edge_from_node(graph_t *graph, id_t node_id, id_t edge_id)
-{
-    while (graph && (graph->node.id != node_id))
-    {
-        graph = graph->next;
-    }
-
-    if (graph)
-    {
-        graph->node.edges = delete_edge(graph->node.edges, edge_id);
+        top[i] = best;
     }
 }
 
 
 /*
- *  Given a graph, it removes any duplicated edge in each node
- *  A duplicated edge is defined as having the same endpoint NIDs
+ *  Compares the exact betweenness centrality of the graph with the estimate computed from
+ *  'samples' random sources (see betweenness_centrality()), printing the time of both, the 
+ *  largest error (relative to the highest exact score) and how many of the 
+ *  BETWEENNESS_BENCHMARK_TOP most central nodes are found by the estimate
  */
-graph_t * delete_all_duplicate_edges(graph_t *graph)
+void print_betweenness_benchmark(graph_t *graph, bool_t weighted, int samples)
 {
-    graph_t *ptr;
-    graph_edge_list_t *edges, *edges2, *del;
+    graph_csr_t *csr;
+    double *exact, *sampled;
+    int *exact_top, *sampled_top;
+    int i, j, k, hits;
+    double start, exact_time, sampled_time, max_error;
 
 
     if (graph)
     {
-        ptr = graph;
+        csr = create_graph_csr(graph);
+        exact = NULL;
+        sampled = NULL;
+        exact_top = NULL;
+        sampled_top = NULL;
 
-        while (ptr)
+        if (
+            csr
+            && ( exact_top = (int*)malloc(sizeof(int) * BETWEENNESS_BENCHMARK_TOP) )
+            && ( sampled_top = (int*)malloc(sizeof(int) * BETWEENNESS_BENCHMARK_TOP) )
+        )
         {
-            edges = ptr->node.edges;
+            start = get_wall_time();
+            exact = betweenness_centrality(csr, weighted, 0, 0);
+            exact_time = get_wall_time() - start;
 
-            while (edges)
+            start = get_wall_time();
+            sampled = betweenness_centrality(csr, weighted, samples, 1);
+            sampled_time = get_wall_time() - start;
+
+            if (exact && sampled)
             {
-                edges2 = ptr->node.edges;
+                k = (csr->node_count < BETWEENNESS_BENCHMARK_TOP) ? csr->node_count : BETWEENNESS_BENCHMARK_TOP;
+                select_top_scores(exact, csr->node_count, k, exact_top);
+                select_top_scores(sampled, csr->node_count, k, sampled_top);
 
-                while (edges2)
+                max_error = 0;
+                hits = 0;
+
+                for (i = 0; i < csr->node_count; i++)
                 {
-                    if (edges->edge.id != edges2->edge.id)
+                    if (fabs(sampled[i] - exact[i]) > max_error)
                     {
-                        if (
-                            edges->edge.endpoint_ids[0] == edges2->edge.endpoint_ids[0] 
-                            && edges->edge.endpoint_ids[1] == edges2->edge.endpoint_ids[1] 
-                        )
-                        {
-                            del = edges2;
-                            edges2 = edges2->next;
-                            ptr->node.edges = delete_edge(ptr->node.edges, del->edge.id);
-                        }
-                        else
-                        {
-                            edges2 = edges2->next;
-                        }
+                        max_error = fabs(sampled[i] - exact[i]);
                     }
-                    else
+                }
+
+                for (i = 0; i < k; i++)
+                {
+                    for (j = 0; j < k; j++)
                     {
-                        edges2 = edges2->next;
+                        hits += (exact_top[i] == sampled_top[j]);
                     }
                 }
 
-                edges = edges->next;
+                printf("\n[Betweenness Benchmark] %d nodes, %d edges, %s, %d threads\n", csr->node_count, csr->edge_count, weighted ? "weighted" : "unweighted", get_thread_count());
+                printf("\n\tExact (all %d sources): %.3f ms\n", csr->node_count, 1000 * exact_time);
+                printf("\tSampled (%d sources): %.3f ms (%.2fx faster)\n", (samples > 0 && samples < csr->node_count) ? samples : csr->node_count, 1000 * sampled_time, exact_time / (sampled_time > 0 ? sampled_time : 1e-9));
+                printf("\tLargest error: %.2f%% of the highest score\n", exact[exact_top[0]] > 0 ? 100 * max_error / exact[exact_top[0]] : 0.0);
+                printf("\tTop %d nodes found by the estimate: %d\n", k, hits);
             }
-
-            ptr = ptr->next;
         }
-    }
+        else
+        {
+            printf("[print_betweenness_benchmark()] ERROR: Memory allocation was unsuccessful\n");
+        }
 
-    return graph;
+        free(exact);
+        free(sampled);
+        free(exact_top);
+        free(sampled_top);
+        csr = delete_graph_csr(csr);
+    }
+    else
+    {
+        printf("\n\t[EMPTY GRAPH]\n");
+    }
 }
 
 
 /*
- *  Sets the edge ID of the edge the function is called on
- *  and proceeds to increment the global_edge_id counter 
+ *  Prints to terminal the amount of triangles of the graph and, for every node, 
+ *  the triangles it belongs to and its local clustering coefficient (see count_triangles())
  */
-id_t set_edge_id(void)
+void print_triangles(graph_t *graph)
 {
-    return global_edge_id++;
+    graph_csr_t *csr;
+    graph_triangles_t *triangles;
+    int v;
+
+
+    if (graph)
+    {
+        csr = create_graph_csr(graph);
+        triangles = count_triangles(csr);
+
+        if (triangles)
+        {
+            printf("\n[Triangles] %ld triangles, global clustering coefficient %.4f:\n\n", triangles->total, triangles->transitivity);
+
+            for (v = 0; v < csr->node_count; v++)
+            {
+                printf("\t[%s] (NID=%u): %ld triangles, clustering %.4f\n", csr->nodes[v]->label, csr->node_ids[v], triangles->triangles[v], triangles->clustering[v]);
+            }
+        }
+
+        triangles = delete_graph_triangles(triangles);
+        csr = delete_graph_csr(csr);
+    }
+    else
+    {
+        printf("\n\t[EMPTY GRAPH]\n");
+    }
 }
 
 
 /*
- *  Sets the node ID of the node the function is called on
- *  and proceeds to increment the global_node_id counter 
+ *  Prints to terminal the core number of every node of the graph 
+ *  (see core_numbers()), and the largest one among them
  */
-id_t set_node_id(void)
+void print_core_numbers(graph_t *graph)
 {
-    return global_node_id++;
+    graph_csr_t *csr;
+    int *core;
+    int v, max_core;
+
+
+    if (graph)
+    {
+        csr = create_graph_csr(graph);
+        core = core_numbers(csr);
+
+        if (core)
+        {
+            max_core = 0;
+
+            for (v = 0; v < csr->node_count; v++)
+            {
+                if (core[v] > max_core)
+                {
+                    max_core = core[v];
+                }
+            }
+
+            printf("\n[k-Core Decomposition] Largest core number: %d\n\n", max_core);
+
+            for (v = 0; v < csr->node_count; v++)
+            {
+                printf("\t[%s] (NID=%u): %d\n", csr->nodes[v]->label, csr->node_ids[v], core[v]);
+            }
+        }
+
+        free(core);
+        csr = delete_graph_csr(csr);
+    }
+    else
+    {
+        printf("\n\t[EMPTY GRAPH]\n");
+    }
 }
 
 
 /*
- *  Prompts the user to choose a node ID between
- *  the ones present in the given graph
+ *  Prints to terminal the maximum flow between two nodes computed with Dinic's Algorithm
+ *  (see dinic_max_flow()), together with the nodes on the source side of the minimum cut
+ *  and the edges crossing it
  */
-id_t select_node_id(graph_t *graph, char *msg_before_ids, char *msg_after_ids)
+void print_max_flow(graph_t *graph, id_t src_nid, id_t sink_nid)
 {
-    id_t nid;
+    graph_csr_t *csr;
+    graph_flow_t *flow;
+    int v;
+
 
     if (graph)
     {
-        if (msg_before_ids)
+        csr = create_graph_csr(graph);
+        flow = dinic_max_flow(csr, src_nid, sink_nid);
+
+        if (flow)
         {
-            printf("%s\n", msg_before_ids);
-        }
+            printf("\n[Dinic's Algorithm] Maximum Flow from (NID=%u) to (NID=%u): %ld\n", src_nid, sink_nid, flow->value);
+            printf("\n\tSource side of the Minimum Cut (NIDs): ");
 
-        print_all_node_ids(graph);
+            for (v = 0; v < csr->node_count; v++)
+            {
+                if (flow->source_side[v])
+                {
+                    printf("%u ", csr->node_ids[v]);
+                }
+            }
 
-        do
-        {
-            nid = *((id_t*)safe_input(U_INT, STRING_BUFFER_SIZE, msg_after_ids));
-        } 
-        while (find_node(graph, nid) == NULL);
+            printf("\n\tEdges of the Minimum Cut (EIDs): ");
+            print_id_list(flow->cut);
+            printf("\n");
+        }
+
+        flow = delete_graph_flow(flow);
+        csr = delete_graph_csr(csr);
     }
     else
     {
-        nid = ERROR_ID;
+        printf("\n\t[EMPTY GRAPH]\n");
     }
-
-    return nid;
 }
 
 
 /*
- *  Given a starting node, the function returns the number of unique 
- *  nodes that it encounters, thus returning the number of nodes
+ *  Prints to terminal the maximum flow between two nodes,
+ *  whose IDs are asked to the user at runtime
  */
-int graph_dim(graph_t *graph)
+void print_max_flow_input(graph_t *graph)
 {
-    graph_t *ptr;
-    int len;
-    
+    id_t src_nid, sink_nid;
 
-    ptr = graph;
-    len = 0;
 
-    while (ptr)
+    if (graph)
     {
-        len++;
-        ptr = ptr->next;
-    }
+        printf("\n[CURRENT OPERATION]\n - Calculating the Maximum Flow and Minimum Cut between two nodes\n");
 
-    return len;
+        src_nid = select_node_id(graph, 
+            "\nAvailable node IDs (NIDs):\n",
+            "Insert source node ID: "
+        );
+
+        sink_nid = select_node_id(graph, 
+            "\nAvailable node IDs (NIDs):\n",
+            "Insert sink node ID: "
+        );
+
+        print_max_flow(graph, src_nid, sink_nid);
+    }
 }
 
 
 /*
- *  Given a starting node, the function returns the number of unique 
- *  nodes that it encounters, thus returning the number of nodes
- *
- *  (RECURSIVE VERSION)
+ *  Compares the running times of dinic_max_flow() and push_relabel_max_flow() between 
+ *  two nodes of the graph, and checks that they find the same maximum flow value, and 
+ *  that the capacity of the minimum cut of each one matches it
  */
-int graph_dim_R(graph_t *graph)
+void print_max_flow_benchmark(graph_t *graph, id_t src_nid, id_t sink_nid)
 {
-    if (graph == NULL)
+    graph_csr_t *csr;
+    graph_flow_t *dinic, *push_relabel;
+    double start, dinic_time, push_relabel_time;
+    long int dinic_cut, push_relabel_cut;
+    int e;
+
+
+    if (graph)
     {
-        return 0;
+        csr = create_graph_csr(graph);
+
+        start = get_wall_time();
+        dinic = dinic_max_flow(csr, src_nid, sink_nid);
+        dinic_time = get_wall_time() - start;
+
+        start = get_wall_time();
+        push_relabel = push_relabel_max_flow(csr, src_nid, sink_nid);
+        push_relabel_time = get_wall_time() - start;
+
+        if (dinic && push_relabel)
+        {
+            dinic_cut = 0;
+            push_relabel_cut = 0;
+
+            for (e = 0; e < csr->edge_count; e++)
+            {
+                if (dinic->source_side[csr->sources[e]] && !dinic->source_side[csr->targets[e]])
+                {
+                    dinic_cut += csr->weights[e];
+                }
+
+                if (push_relabel->source_side[csr->sources[e]] && !push_relabel->source_side[csr->targets[e]])
+                {
+                    push_relabel_cut += csr->weights[e];
+                }
+            }
+
+            printf("\n[Maximum Flow Benchmark] %d nodes, %d edges\n", csr->node_count, csr->edge_count);
+            printf("\n\tDinic's Algorithm: flow %ld, cut %ld, %.3f ms\n", dinic->value, dinic_cut, 1000 * dinic_time);
+            printf("\tPush-Relabel (highest label): flow %ld, cut %ld, %.3f ms\n", push_relabel->value, push_relabel_cut, 1000 * push_relabel_time);
+            printf("\t%s\n", (dinic->value == push_relabel->value && dinic_cut == dinic->value && push_relabel_cut == push_relabel->value) ? "The results match" : "WARNING: The results don't match");
+        }
+
+        dinic = delete_graph_flow(dinic);
+        push_relabel = delete_graph_flow(push_relabel);
+        csr = delete_graph_csr(csr);
     }
     else
     {
-        return 1 + graph_dim_R(graph->next);
+        printf("\n\t[EMPTY GRAPH]\n");
     }
 }
 
 
 /*
- *  Given the beginning of an edge list, returns its length
+ *  Prints to terminal the global minimum cut of the graph computed with the 
+ *  Stoer-Wagner Algorithm (see stoer_wagner_min_cut()): its weight, the nodes
+ *  on one of its sides and the edges crossing it
  */
-int edge_list_dim(graph_edge_list_t *edges)
+void print_min_cut(graph_t *graph)
 {
-    int dim;
-
+    graph_csr_t *csr;
+    graph_cut_t *cut;
+    int v;
 
-    dim = 0;
 
-    while (edges)
+    if (graph)
     {
-        dim++;
-        edges = edges->next;
-    }
+        csr = create_graph_csr(graph);
+        cut = stoer_wagner_min_cut(csr);
 
-    return dim;
-}
+        if (cut)
+        {
+            printf("\n[Stoer-Wagner] Global Minimum Cut: %ld\n", cut->value);
+            printf("\n\tNodes on one side (NIDs): ");
 
+            for (v = 0; v < csr->node_count; v++)
+            {
+                if (cut->side[v])
+                {
+                    printf("%u ", csr->node_ids[v]);
+                }
+            }
 
-/*
- *  Given the beginning of an edge list, returns its length
- *
- *  (RECURSIVE VERSION)
- */
-int edge_list_dim_R(graph_edge_list_t *edges)
-{
-    if (edges)
-    {
-        return 1 + edge_list_dim_R(edges->next);
+            printf("\n\tEdges of the cut (EIDs): ");
+            print_id_list(cut->cut);
+            printf("\n");
+        }
+
+        cut = delete_graph_cut(cut);
+        csr = delete_graph_csr(csr);
     }
     else
     {
-        return 0;
+        printf("\n\t[EMPTY GRAPH]\n");
     }
 }
 
 
 /*
- *  If the graph exists, creates the corresponding matrix of the given graph
- *  otherwise returns NULL
+ *  Prints to terminal the pairs of a matching of the bipartite graph: a maximum cardinality
+ *  matching (see hopcroft_karp_matching()) if 'weighted' is false, or a minimum cost 
+ *  assignment on the edge weights (see hungarian_assignment()) otherwise
  */
-int * create_graph_matrix(graph_t *graph)
+void print_matching(graph_t *graph, bool_t weighted)
 {
-    graph_t *row_ptr, *col_ptr;
-    graph_edge_list_t *row_ptr_edges;
-    bool_t found_common_edge;
-    int dim, i, j;
-    int *mat;
-    
+    graph_csr_t *csr;
+    graph_matching_t *matching;
+    int v;
 
-    mat = NULL;
 
     if (graph)
     {
-        dim = graph_dim(graph);
+        csr = create_graph_csr(graph);
+        matching = weighted ? hungarian_assignment(csr) : hopcroft_karp_matching(csr);
 
-        if (( mat = (int*)malloc(sizeof(int) * dim * dim) ))
+        if (matching)
         {
-            row_ptr = graph;
-            i = 0;
+            printf("\n[%s] %d matched pairs, total weight %ld:\n\n", weighted ? "Hungarian Algorithm" : "Hopcroft-Karp", matching->size, matching->cost);
 
-            while (i < dim && row_ptr)
+            for (v = 0; v < csr->node_count; v++)
             {
-                col_ptr = graph;
-                j = 0;
-
-                while (j < dim && col_ptr)
+                if (matching->mate[v] > v)
                 {
-                    found_common_edge = false;
-                    row_ptr_edges = row_ptr->node.edges;
+                    printf("\t[%s] (NID=%u) <---> [%s] (NID=%u)\n", 
+                        csr->nodes[v]->label, csr->node_ids[v], 
+                        csr->nodes[matching->mate[v]]->label, csr->node_ids[matching->mate[v]]
+                    );
+                }
+            }
 
-                    while (!found_common_edge && row_ptr_edges)
-                    {
-                        if (row_ptr_edges->edge.endpoint_ids[1] == col_ptr->node.id)
-                        {
-                            found_common_edge = true;
-                        }
+            printf("\n\tEIDs: ");
+            print_id_list(matching->edges);
+            printf("\n");
+        }
 
-                        row_ptr_edges = row_ptr_edges->next;
-                    }
+        matching = delete_graph_matching(matching);
+        csr = delete_graph_csr(csr);
+    }
+    else
+    {
+        printf("\n\t[EMPTY GRAPH]\n");
+    }
+}
 
-                    if (found_common_edge)
-                    {
-                        *(mat + j + (i * dim)) = 1;
-                    }
-                    else
+
+/*
+ *  Measures the time taken by the bipartiteness check and by the matching algorithms on the
+ *  given graph: hungarian_assignment() is only run if its cost matrix fits in 
+ *  ASSIGNMENT_MAX_CELLS cells, so large sparse graphs (e.g. one million edges created by
+ *  create_bipartite_graph()) only time hopcroft_karp_matching()
+ */
+void print_matching_benchmark(graph_t *graph)
+{
+    graph_csr_t *csr;
+    graph_matching_t *matching;
+    double start;
+    int *colors;
+    int v, rows;
+    bool_t bipartite;
+
+
+    if (graph)
+    {
+        csr = create_graph_csr(graph);
+
+        if (csr && ( colors = (int*)malloc(sizeof(int) * (csr->node_count + 1)) ))
+        {
+            printf("\n[Matching Benchmark] %d nodes, %d edges\n\n", csr->node_count, csr->edge_count);
+
+            start = get_wall_time();
+            bipartite = is_bipartite(csr, colors);
+            printf("\tBipartiteness check: %s, %.3f ms\n", bipartite ? "bipartite" : "not bipartite", 1000 * (get_wall_time() - start));
+
+            if (bipartite)
+            {
+                start = get_wall_time();
+                matching = hopcroft_karp_matching(csr);
+
+                if (matching)
+                {
+                    printf("\tHopcroft-Karp: %d pairs, %.3f ms\n", matching->size, 1000 * (get_wall_time() - start));
+                }
+
+                matching = delete_graph_matching(matching);
+
+                rows = 0;
+
+                for (v = 0; v < csr->node_count; v++)
+                {
+                    rows += (colors[v] == 0);
+                }
+
+                if ((double)rows * (csr->node_count - rows) <= ASSIGNMENT_MAX_CELLS)
+                {
+                    start = get_wall_time();
+                    matching = hungarian_assignment(csr);
+
+                    if (matching)
                     {
-                        *(mat + j + (i * dim)) = 0;
+                        printf("\tHungarian Algorithm: %d pairs, cost %ld, %.3f ms\n", matching->size, matching->cost, 1000 * (get_wall_time() - start));
                     }
 
-                    col_ptr = col_ptr->next;   
-                    j++;
+                    matching = delete_graph_matching(matching);
+                }
+                else
+                {
+                    printf("\tHungarian Algorithm: skipped, the cost matrix would be too large\n");
                 }
-
-                row_ptr = row_ptr->next;
-                i++;
             }
-            
-        }
-        else
-        {
-            printf("[create_graph_matrix()] ERROR: Memory allocation was unsuccessful\n");
+
+            free(colors);
         }
-    }
 
-    return mat;
+        csr = delete_graph_csr(csr);
+    }
+    else
+    {
+        printf("\n\t[EMPTY GRAPH]\n");
+    }
 }
 
 
-/* 
- *  Given an edges list, it returns 0 if the node doesn't have an autoloop
- *  and, in case they exist and are duplicated, returns the amount of
- *  autoloops found in the edges list
+/*
+ *  Helper function of print_coloring() that returns the amount of colors used by the 
+ *  given coloring, or ERROR_INDEX if an edge (other than a self loop) links two nodes
+ *  with the same color
  */
-int autoloop_count(graph_edge_list_t *edges)
+static int count_colors(graph_csr_t *csr, const int *colors)
 {
-    int count;
+    int v, e, count;
 
 
     count = 0;
 
-    while (edges)
+    for (v = 0; v < csr->node_count; v++)
     {
-        if (edges->edge.endpoint_ids[0] == edges->edge.endpoint_ids[1])
+        for (e = csr->offsets[v]; e < csr->offsets[v + 1]; e++)
         {
-            count++;
+            if (csr->targets[e] != v && colors[csr->targets[e]] == colors[v])
+            {
+                return ERROR_INDEX;
+            }
         }
 
-        edges = edges->next;
+        count = (colors[v] + 1 > count) ? colors[v] + 1 : count;
     }
 
     return count;
@@ -1713,281 +2661,331 @@ int autoloop_count(graph_edge_list_t *edges)
 
 
 /*
- *  Filters out all the given 'remove' characters found in str
+ *  Prints to terminal the amount of colors and the time of every coloring method (see 
+ *  greedy_coloring(), dsatur_coloring() and jones_plassmann_coloring()), followed by the
+ *  color of every node given by the DSatur Algorithm
  */
-char * filter(char *str, char remove)
+void print_coloring(graph_t *graph)
 {
-    char *filtered;
-    int i, j, len;
-   
+    const char *names[] = { "Greedy (natural order)", "Greedy (largest first)", "Greedy (smallest last)", "DSatur", "Jones-Plassmann" };
+    graph_csr_t *csr;
+    int *colors;
+    int method, v, count;
+    double start;
 
-    filtered = NULL;
 
-    if (str)
+    if (graph)
     {
-        len = strlen(str);
-        i = 0;
+        csr = create_graph_csr(graph);
+        colors = NULL;
 
-        while ((str + i) && *(str + i) != END_OF_STRING)
-        {   
-            if ( *(str + i) == remove)
+        if (csr)
+        {
+            printf("\n[Graph Coloring] %d nodes, %d edges, %d threads\n\n", csr->node_count, csr->edge_count, get_thread_count());
+
+            for (method = 0; method < 5; method++)
             {
-                len--;
+                free(colors);
+                start = get_wall_time();
+
+                switch (method)
+                {
+                    case 0: colors = greedy_coloring(csr, NATURAL_ORDER); break;
+                    case 1: colors = greedy_coloring(csr, LARGEST_FIRST_ORDER); break;
+                    case 2: colors = greedy_coloring(csr, SMALLEST_LAST_ORDER); break;
+                    case 3: colors = dsatur_coloring(csr); break;
+                    default: colors = jones_plassmann_coloring(csr, 1); break;
+                }
+
+                if (colors)
+                {
+                    count = count_colors(csr, colors);
+
+                    if (count == ERROR_INDEX)
+                    {
+                        printf("\t%s: INVALID COLORING\n", names[method]);
+                    }
+                    else
+                    {
+                        printf("\t%s: %d colors, %.3f ms\n", names[method], count, 1000 * (get_wall_time() - start));
+                    }
+                }
             }
-            i++;
-        }
 
-        if (( filtered = (char*)malloc(sizeof(char) * (len + 1)) ))
-        {
-            i = 0;
-            j = 0;
+            free(colors);
+            colors = dsatur_coloring(csr);
 
-            while ((str + i) && *(str + i) != END_OF_STRING)
+            if (colors)
             {
-                if (*(str + i) != remove)
+                printf("\n");
+
+                for (v = 0; v < csr->node_count; v++)
                 {
-                    *(filtered + j) = *(str + i);
-                    j++;
+                    printf("\t[%s] (NID=%u): %d\n", csr->nodes[v]->label, csr->node_ids[v], colors[v]);
                 }
-                i++;
             }
-
-            *(filtered + len) = END_OF_STRING;
-        }
-        else
-        {
-            printf("[filter()] ERROR: Memory allocation was unsuccessful\n");
         }
-    }
 
-    return filtered;
+        free(colors);
+        csr = delete_graph_csr(csr);
+    }
+    else
+    {
+        printf("\n\t[EMPTY GRAPH]\n");
+    }
 }
 
 
 /*
- *  Given an integer, it converts it into a string
+ *  Prints to terminal the amount of communities, the modularity and the time of the 
+ *  Louvain Method and of Label Propagation (see louvain_communities() and 
+ *  label_propagation_communities()), followed by the community of every node given by
+ *  the Louvain Method
  */
-char * int_to_string(long int val)
-{   
-    char *str;
-    int digits, i, digit;
-    long int tmp, divider;
-
-
-    tmp = val;
-    digits = 0;
+void print_communities(graph_t *graph)
+{
+    graph_csr_t *csr;
+    graph_communities_t *louvain, *propagation;
+    double start, louvain_time;
+    int v;
 
-    while (tmp)
-    {
-        tmp /= 10;
-        digits++;
-    }
 
-    if (( str = (char*)malloc(sizeof(char) * (digits + 1)) ))
+    if (graph)
     {
-        i = 0;
-        tmp = val;
+        csr = create_graph_csr(graph);
 
-        while (i < digits)
+        if (csr)
         {
-            divider = pow(10, digits - i - 1);
-            digit = tmp / divider;
+            start = get_wall_time();
+            louvain = louvain_communities(csr);
+            louvain_time = get_wall_time() - start;
 
-            *(str + i) = ZERO_CHAR + digit;
-            tmp -= digit * divider;
+            start = get_wall_time();
+            propagation = label_propagation_communities(csr, 1);
 
-            i++;
+            if (louvain && propagation)
+            {
+                printf("\n[Community Detection] %d nodes, %d edges, %d threads\n\n", csr->node_count, csr->edge_count, get_thread_count());
+                printf("\tLouvain Method: %d communities, modularity %.4f, %d levels, %.3f ms\n", louvain->count, louvain->modularity, louvain->rounds, 1000 * louvain_time);
+                printf("\tLabel Propagation: %d communities, modularity %.4f, %d iterations, %.3f ms\n\n", propagation->count, propagation->modularity, propagation->rounds, 1000 * (get_wall_time() - start));
+
+                for (v = 0; v < csr->node_count; v++)
+                {
+                    printf("\t[%s] (NID=%u): %d\n", csr->nodes[v]->label, csr->node_ids[v], louvain->community[v]);
+                }
+            }
+
+            louvain = delete_graph_communities(louvain);
+            propagation = delete_graph_communities(propagation);
         }
 
-        *(str + digits) = END_OF_STRING;
+        csr = delete_graph_csr(csr);
     }
     else
     {
-        printf("[int_to_string()] ERROR: Memory allocation was unsuccessful\n");
+        printf("\n\t[EMPTY GRAPH]\n");
     }
-
-    return str;
 }
 
 
 /*
- *  Given two source strings src1 and src2, it returns the concatenation 
- *  of the beginning of src2 to the end of src1
+ *  Helper function of print_maximal_cliques() that prints a clique to terminal 
+ *  (see graph_clique_callback_t), and keeps the size of the largest one in 'data'
  */
-char * strconcat(char *src1, char *src2)
+static void print_clique(graph_csr_t *csr, const int *clique, int size, void *data)
 {
-    char *str;
-    int len1, len2, len;
     int i;
 
 
-    str = NULL;
-
-    if (src1 && src2)
+    #ifdef _OPENMP
+        #pragma omp critical (print_clique)
+    #endif
     {
-        len1 = strlen(src1);
-        len2 = strlen(src2);
-        len = len1 + len2;
+        printf("\t{");
 
-        if (( str = (char*)malloc(sizeof(char) * (len + 1)) ))
+        for (i = 0; i < size; i++)
         {
-            i = 0;
-
-            while (i < len1)
-            {
-                *(str + i) = *(src1 + i);
-                i++;
-            }
-
-            i = 0;
+            printf(" [%s] (NID=%u)", csr->nodes[clique[i]]->label, csr->node_ids[clique[i]]);
+        }
 
-            while (i < len2)
-            {
-                *(str + len1 + i) = *(src2 + i);
-                i++;
-            }
+        printf(" }\n");
 
-            *(str + len) = END_OF_STRING;
-        }
-        else
+        if (size > *(int*)data)
         {
-            printf("[strconcat()] ERROR: Memory allocation was unsuccessful\n");
+            *(int*)data = size;
         }
     }
-
-    return str;
 }
 
 
 /*
- *  Pushes the passed node at the beginning of the graph list
- *  and returns the updated graph 
+ *  Prints to terminal the maximal cliques of the graph with at least 'min_size' nodes
+ *  (see maximal_cliques()), followed by their amount and the size of the largest one
  */
-graph_t * push_node(graph_t *graph, graph_node_t node)
+void print_maximal_cliques(graph_t *graph, int min_size)
 {
-    graph_t *elem;
+    graph_csr_t *csr;
+    long int count;
+    int largest;
+    double start;
 
 
     if (graph)
     {
-        if (( elem = (graph_t*)malloc(sizeof(graph_t)) ))
-        {
-            elem->node = node;
-            elem->next = graph;
-            graph = elem;
-        }
-        else
+        csr = create_graph_csr(graph);
+
+        if (csr)
         {
-            printf("[push_node()] ERROR: Memory allocation was unsuccessful\n");
+            printf("\n[Maximal Cliques] At least %d nodes\n\n", min_size);
+            largest = 0;
+            start = get_wall_time();
+            count = maximal_cliques(csr, min_size, print_clique, &largest);
+
+            if (count != ERROR_INDEX)
+            {
+                printf("\n\t%ld cliques, the largest with %d nodes, %.3f ms\n", count, largest, 1000 * (get_wall_time() - start));
+            }
         }
+
+        csr = delete_graph_csr(csr);
+    }
+    else
+    {
+        printf("\n\t[EMPTY GRAPH]\n");
     }
+}
 
-    return graph;
+
+/*
+ *  Asks the user for the minimum size of the cliques, then prints the maximal cliques
+ *  of the graph (see print_maximal_cliques())
+ */
+void print_maximal_cliques_input(graph_t *graph)
+{
+    int min_size;
+
+
+    if (graph)
+    {
+        printf("\n[CURRENT OPERATION]\n - Enumerating the maximal cliques of the graph\n");
+
+        min_size = *((int*)safe_input(INT, STRING_BUFFER_SIZE, "Insert the minimum size of the cliques: "));
+
+        print_maximal_cliques(graph, min_size);
+    }
 }
 
 
-/* 
- *  Appends the passed node at the end of the graph list
- *  and returns the updated graph 
+/*
+ *  Helper function of print_subgraph_isomorphisms() that prints a match to terminal 
+ *  (see graph_match_callback_t), as the target node of every pattern node
  */
-graph_t * append_node(graph_t *graph, graph_node_t node)
+static bool_t print_match(graph_csr_t *pattern, graph_csr_t *target, const int *mapping, void *data)
 {
-    graph_t *elem, *ptr;
+    int u;
 
 
-    if (( elem = (graph_t*)malloc(sizeof(graph_t)) ))
+    (void)data;
+
+    printf("\t{");
+
+    for (u = 0; u < pattern->node_count; u++)
     {
-        if (graph)
-        {
-            for (ptr = graph; ptr->next != NULL; ptr = ptr->next)
-                ;
+        printf(" [%s] -> [%s] (NID=%u)", pattern->nodes[u]->label, target->nodes[mapping[u]]->label, target->node_ids[mapping[u]]);
+    }
 
-            elem->node = node;
-            elem->next = NULL;
-            ptr->next = elem;
-        }
-        else
-        {
-            graph = elem;
-            graph->next = NULL;
-            graph->node = node;
-        }        
-    }   
-    else
-    {
-        printf("[append_node()] ERROR: Memory allocation was unsuccessful\n");
-    }
+    printf(" }\n");
 
-    return graph;
+    return true;
 }
 
 
 /*
- *  Deletes the node in the graph that matches the given node ID and
- *  then proceeds to return the updated graph
+ *  Prints to terminal every occurrence of the pattern graph inside the target graph
+ *  (see subgraph_isomorphisms() for the flags), followed by their amount
  */
-graph_t * delete_node(graph_t *graph, id_t id)
+void print_subgraph_isomorphisms(graph_t *pattern, graph_t *target, int flags)
 {
-    graph_t *prev, *del;
+    const char *names[] = { "Induced", "Node labels", "Edge labels", "Edge weights" };
+    const int masks[] = { MATCH_INDUCED, MATCH_NODE_LABELS, MATCH_EDGE_LABELS, MATCH_EDGE_WEIGHTS };
+    const char *sep;
+    long int count;
+    double start;
+    int i;
 
 
-    if (graph)
-    {   
-        prev = NULL;
-        del = graph;
+    if (pattern && target)
+    {
+        printf("\n[Subgraph Isomorphism]");
+        sep = " ";
 
-        while (del && del->node.id != id)
+        for (i = 0; i < 4; i++)
         {
-            prev = del;
-            del = del->next;
+            if (flags & masks[i])
+            {
+                printf("%s%s", sep, names[i]);
+                sep = ", ";
+            }
         }
 
-        if (del)
-        {
-            /* Revoke the node ID */
-            revoked_node_ids = append_revoked_id(revoked_node_ids, del->node.id);
+        printf("\n\n");
 
-            if (prev == NULL)
-            {
-                graph = del->next;
-                free(del);
-            }
-            else
-            {
-                prev->next = del->next;
-                free(del);
-            }
+        start = get_wall_time();
+        count = subgraph_isomorphisms(pattern, target, flags, print_match, NULL);
+
+        if (count != ERROR_INDEX)
+        {
+            printf("\n\t%ld matches, %.3f ms\n", count, 1000 * (get_wall_time() - start));
         }
     }
-
-    return graph;
+    else
+    {
+        printf("\n\t[EMPTY GRAPH]\n");
+    }
 }
 
 
 /*
- *  Deletes all nodes in the graph
+ *  Helper function of print_subgraph_benchmark() that creates a pattern graph with 
+ *  'node_count' nodes and the edges arcs[0] -> arcs[1], arcs[2] -> arcs[3], ...
+ * 
+ *  Returns the pattern graph, NULL on error
  */
-graph_t * delete_graph(graph_t *graph)
+static graph_t * create_pattern_graph(int node_count, const int *arcs, int arc_count)
 {
-    graph_t *del;
-    graph_edge_list_t *ptr;
+    graph_t *graph, *ptr, *src, *dest;
+    graph_edge_t edge;
+    id_t endpoints[2];
+    int i, j;
 
 
-    while (graph)
+    graph = NULL;
+
+    for (i = 0; i < node_count; i++)
     {
-        /* Revoking each node ID */
-        revoked_node_ids = append_revoked_id(revoked_node_ids, graph->node.id);
+        graph = graph ? push_node(graph, create_new_node(PATTERN_NODE_LABEL)) : append_node(NULL, create_new_node(PATTERN_NODE_LABEL));
+    }
 
-        /* Revoking all edge IDs for each node */
-        for (ptr = graph->node.edges; ptr != NULL; ptr = ptr->next)
+    for (i = 0; i < arc_count; i++)
+    {
+        src = NULL;
+        dest = NULL;
+
+        /* The node pushed first is the last one of the list */
+        for (ptr = graph, j = node_count - 1; ptr; ptr = ptr->next, j--)
         {
-            revoked_edge_ids = append_revoked_id(revoked_edge_ids, ptr->edge.id);
+            src = (j == arcs[2 * i]) ? ptr : src;
+            dest = (j == arcs[2 * i + 1]) ? ptr : dest;
         }
 
-        /* Finally, delete the node from the graph */
-        del = graph;
-        graph = graph->next;
-        free(del);
+        if (src && dest)
+        {
+            endpoints[0] = src->node.id;
+            endpoints[1] = dest->node.id;
+            edge = create_new_edge(1, PATTERN_EDGE_LABEL, endpoints);
+            edge.is_in_mst = false;
+            src->node.edges = src->node.edges ? push_edge(src->node.edges, edge) : append_edge(NULL, edge);
+        }
     }
 
     return graph;
@@ -1995,852 +2993,13956 @@ graph_t * delete_graph(graph_t *graph)
 
 
 /*
- *  Returns a pointer to the node if it's been found
- *  in the graph, NULL otherwise
+ *  Measures the time subgraph_isomorphisms() takes to count the occurrences of a few small
+ *  patterns (directed triangle, feed-forward loop, path, square, pair of opposite edges)
+ *  inside the target graph, both as subgraphs and as induced subgraphs, without labels
  */
-graph_t * find_node(graph_t *graph, id_t id)
+void print_subgraph_benchmark(graph_t *target)
 {
-    graph_t *ptr;
+    const char *names[] = { "Directed triangle", "Feed-forward loop", "Path of 3 nodes", "Square", "Opposite edges" };
+    const int sizes[] = { 3, 3, 3, 4, 2 };
+    const int arc_counts[] = { 3, 3, 2, 4, 2 };
+    const int arcs[][8] = {
+        { 0, 1, 1, 2, 2, 0 },
+        { 0, 1, 1, 2, 0, 2 },
+        { 0, 1, 1, 2 },
+        { 0, 1, 1, 2, 2, 3, 3, 0 },
+        { 0, 1, 1, 0 }
+    };
+    graph_t *pattern;
+    long int count, induced_count;
+    double start, time;
+    int p;
+
+
+    if (target)
+    {
+        printf("\n[Subgraph Isomorphism Benchmark]\n\n");
 
+        for (p = 0; p < 5; p++)
+        {
+            pattern = create_pattern_graph(sizes[p], arcs[p], arc_counts[p]);
 
-    ptr = graph;
+            start = get_wall_time();
+            count = subgraph_isomorphisms(pattern, target, 0, NULL, NULL);
+            time = get_wall_time() - start;
 
-    while (ptr && ptr->node.id != id)
+            start = get_wall_time();
+            induced_count = subgraph_isomorphisms(pattern, target, MATCH_INDUCED, NULL, NULL);
+
+            printf("\t%s: %ld matches in %.3f ms, %ld induced in %.3f ms\n", names[p], count, 1000 * time, induced_count, 1000 * (get_wall_time() - start));
+
+            pattern = delete_graph(pattern);
+        }
+    }
+    else
     {
-        ptr = ptr->next;
+        printf("\n\t[EMPTY GRAPH]\n");
     }
-
-    return ptr;
 }
 
 
 /*
- *  Returns a pointer to the node if it's been found
- *  in the graph, NULL otherwise
- * 
- *  (RECURSIVE VERSION)
+ *  Prints to terminal the fingerprints of the two graphs (see graph_fingerprint()) 
+ *  and whether they are isomorphic (see are_isomorphic()), with the given flags
  */
-graph_t * find_node_R(graph_t *ptr, id_t id)
+void print_isomorphism(graph_t *first, graph_t *second, int flags)
 {
-    if (ptr)
+    double start;
+    bool_t isomorphic;
+
+
+    if (first && second)
     {
-        if (ptr->node.id == id)
-        {
-            return ptr;
-        }
-        else
-        {
-            return find_node_R(ptr->next, id);
-        }  
+        printf("\n[Graph Isomorphism]\n\n");
+        printf("\tFirst graph fingerprint: %016lx\n", graph_fingerprint(first, flags));
+        printf("\tSecond graph fingerprint: %016lx\n", graph_fingerprint(second, flags));
+
+        start = get_wall_time();
+        isomorphic = are_isomorphic(first, second, flags);
+        printf("\n\tThe graphs are%s isomorphic (%.3f ms)\n", isomorphic ? "" : " NOT", 1000 * (get_wall_time() - start));
     }
     else
     {
-        return NULL;
+        printf("\n\t[EMPTY GRAPH]\n");
     }
 }
 
 
 /*
- *  Pushes the given edge at the beginning of the given edges list
- *  and proceeds to return the updated edges list
+ *  Compares the reachability index (see create_reachability()) with a breadth-first search on
+ *  'query_count' random pairs of nodes of the given graph: the preprocessing time, the size of
+ *  the index, the query times and the amount of answers of the index that differ from the
+ *  search, on the first REACHABILITY_BENCHMARK_CHECK_COUNT pairs
  */
-graph_edge_list_t * push_edge(graph_edge_list_t *edges, graph_edge_t edge)
+void print_reachability_benchmark(graph_t *graph, int query_count)
 {
-    graph_edge_list_t *elem;
+    graph_csr_t *csr;
+    graph_reachability_t *reach;
+    id_t *pairs;
+    int *queue, *visited;
+    int i, n, checks, mismatches, reachable, head, tail, v, dest, e;
+    double start, preprocessing, index_time, search_time;
 
 
-    if (edges)
+    if (graph && query_count > 0)
     {
-        if (( elem = (graph_edge_list_t*)malloc(sizeof(graph_edge_list_t)) ))
+        csr = create_graph_csr(graph);
+        reach = NULL;
+        pairs = NULL;
+        queue = NULL;
+        visited = NULL;
+
+        if (
+            csr
+            && ( pairs = (id_t*)malloc(sizeof(id_t) * 2 * query_count) )
+            && ( queue = (int*)malloc(sizeof(int) * csr->node_count) )
+            && ( visited = (int*)malloc(sizeof(int) * csr->node_count) )
+        )
         {
-            elem->edge = edge;
-            elem->next = edges;
-            edges = elem;
+            n = csr->node_count;
+            srand(1);
+
+            for (i = 0; i < 2 * query_count; i++)
+            {
+                pairs[i] = csr->node_ids[((unsigned long int)rand() * ((unsigned long int)RAND_MAX + 1) + rand()) % n];
+            }
+
+            for (v = 0; v < n; v++)
+            {
+                visited[v] = ERROR_INDEX;
+            }
+
+            start = get_wall_time();
+            reach = create_reachability(csr, REACHABILITY_CLOSURE_MAX_COMPONENTS);
+            preprocessing = get_wall_time() - start;
         }
-        else
+
+        if (reach)
         {
-            printf("[push_edge()] ERROR: Memory allocation was unsuccessful\n");
-        }
-    }
+            reachable = 0;
+            start = get_wall_time();
 
-    return edges;
-}
+            for (i = 0; i < query_count; i++)
+            {
+                reachable += is_reachable(csr, reach, pairs[2 * i], pairs[2 * i + 1]);
+            }
 
+            index_time = get_wall_time() - start;
+            checks = (query_count < REACHABILITY_BENCHMARK_CHECK_COUNT) ? query_count : REACHABILITY_BENCHMARK_CHECK_COUNT;
+            mismatches = 0;
+            search_time = 0;
 
-/*
- *  Appends the given edge at the end of the given edges lit
- *  and proceeds to return the updated edges list
- */
-graph_edge_list_t * append_edge(graph_edge_list_t *edges, graph_edge_t edge)
-{
-    graph_edge_list_t *elem, *ptr;
+            for (i = 0; i < checks; i++)
+            {
+                start = get_wall_time();
+                dest = get_csr_index_from_id(csr, pairs[2 * i + 1]);
+                queue[0] = get_csr_index_from_id(csr, pairs[2 * i]);
+                visited[queue[0]] = i;
+                head = 0;
+                tail = 1;
+
+                while (head < tail && visited[dest] != i)
+                {
+                    v = queue[head++];
 
+                    for (e = csr->offsets[v]; e < csr->offsets[v + 1]; e++)
+                    {
+                        if (visited[csr->targets[e]] != i)
+                        {
+                            visited[csr->targets[e]] = i;
+                            queue[tail++] = csr->targets[e];
+                        }
+                    }
+                }
 
-    if (( elem = (graph_edge_list_t*)malloc(sizeof(graph_edge_list_t)) ))
-    {
-        if (edges)
-        {  
-            for (ptr = edges; ptr->next != NULL; ptr = ptr->next)
-                ;
+                search_time += get_wall_time() - start;
 
-            elem->edge = edge;
-            elem->next = NULL;
-            ptr->next = elem;
+                if ((visited[dest] == i) != is_reachable(csr, reach, pairs[2 * i], pairs[2 * i + 1]))
+                {
+                    mismatches++;
+                }
+            }
+
+            printf("\n[Reachability Benchmark] %d nodes, %d edges\n", csr->node_count, csr->edge_count);
+            printf("\n\tPreprocessing: %.3f s (%d strongly connected components)", preprocessing, reach->component_count);
+
+            if (reach->closure)
+            {
+                printf("\n\tTransitive closure: %.3f MB", 
+                    (double)reach->component_count * BITSET_WORDS(reach->component_count) * sizeof(bitset_word_t) / (1024 * 1024)
+                );
+            }
+            else
+            {
+                printf("\n\t2-hop labels: %.2f out-hubs and %.2f in-hubs per component", 
+                    (double)reach->out_offsets[reach->component_count] / reach->component_count,
+                    (double)reach->in_offsets[reach->component_count] / reach->component_count
+                );
+            }
+
+            printf("\n\tIndex queries: %d in %.3f s -> %.3f us/query, %d reachable pairs", 
+                query_count, index_time, 1000000 * index_time / query_count, reachable
+            );
+            printf("\n\tBreadth-first search: %.3f ms/query (on %d queries)", 1000 * search_time / checks, checks);
+            printf("\n\tAnswer mismatches: %d\n", mismatches);
         }
         else
         {
-            edges = elem;
-            edges->edge = edge;
-            edges->next = NULL;
+            printf("[print_reachability_benchmark()] ERROR: Preprocessing was unsuccessful\n");
         }
+
+        free(pairs);
+        free(queue);
+        free(visited);
+        reach = delete_reachability(reach);
+        csr = delete_graph_csr(csr);
     }
     else
     {
-        printf("[append_edge()] ERROR: Memory allocation was unsuccessful\n");
+        printf("\n\t[EMPTY GRAPH]\n");
     }
-
-    return edges;
 }
 
 
 /*
- *  Deletes the edge with ID equal to the passed ID from the passed 
- *  edges list, which is then returned updated
+ *  Prints to terminal the Eulerian path of the given graph (see eulerian_path()), as the 
+ *  sequence of the traversed edge IDs (EIDs), and whether it's a circuit
  */
-graph_edge_list_t * delete_edge(graph_edge_list_t *edges, id_t id)
+void print_eulerian_path(graph_t *graph, bool_t undirected)
 {
-    graph_edge_list_t *del, *prev;
+    graph_csr_t *csr;
+    id_list_t *path, *ptr;
+    id_t last_eid;
+    int e, first, last;
+    double start;
 
 
-    if (edges)
+    if (graph)
     {
-        prev = NULL; 
-        del = edges;
+        csr = create_graph_csr(graph);
 
-        while (del && del->edge.id != id)
-        {
-            prev = del;
-            del = del->next;
-        }
+        start = get_wall_time();
+        path = eulerian_path(csr, undirected);
+        start = get_wall_time() - start;
 
-        if (del)
+        if (path)
         {
-            /* Revoke this edge's ID */
-            revoked_edge_ids = append_revoked_id(revoked_edge_ids, del->edge.id);
+            last_eid = ERROR_ID;
+            printf("\n[Eulerian Path]\n\n\tEIDs: ");
 
-            if (prev == NULL)
-            {
-                edges = del->next;
-                free(del);
-            }
-            else
+            for (ptr = path; ptr; ptr = ptr->next)
             {
-                prev->next = del->next;
-                free(del);
+                printf("%u%s", ptr->id, ptr->next ? " -> " : "\n");
+                last_eid = ptr->id;
             }
-        }
-    }
 
-    return edges;
-}
+            /* Endpoints of the path, from its first and its last edge */
+            first = ERROR_INDEX;
+            last = ERROR_INDEX;
 
+            for (e = 0; e < csr->edge_count; e++)
+            {
+                if (csr->edges[e]->id == path->id)
+                {
+                    first = csr->sources[e];
+                }
 
-/*
- *  Deletes all edges in the given edges list
- */
-graph_edge_list_t * delete_edge_list(graph_edge_list_t *edges)
-{
-    graph_edge_list_t *del;
-
+                if (csr->edges[e]->id == last_eid)
+                {
+                    last = csr->targets[e];
+                }
+            }
 
-    if (edges)
-    {   
-        while (edges)
+            printf("\n\t%s from node %u to node %u (%.3f ms)\n", 
+                (first == last) ? "Circuit" : "Path", csr->node_ids[first], csr->node_ids[last], 1000 * start
+            );
+        }
+        else
         {
-            /* Revoke each edge's ID */
-            revoked_edge_ids = append_revoked_id(revoked_edge_ids, edges->edge.id);
-
-            del = edges;
-            edges = edges->next;
-            free(del);
+            printf("\n[Eulerian Path]\n\n\tThe graph has no Eulerian path\n");
         }
-    }
 
-    return edges;
+        path = delete_all_revoked_id(path);
+        csr = delete_graph_csr(csr);
+    }
+    else
+    {
+        printf("\n\t[EMPTY GRAPH]\n");
+    }
 }
 
 
 /*
- *  Returns a pointer to the edge in edges list if the edge with ID id
- *  was found, NULL otherwise
+ *  Prints to terminal whether the given graph is series-parallel (see 
+ *  series_parallel_decomposition()), and if so its terminals, the composition of its
+ *  decomposition tree and the results of the tree dynamic programming examples
  */
-graph_edge_list_t * find_edge(graph_edge_list_t *edges, id_t id)
+void print_series_parallel(graph_t *graph, bool_t undirected)
 {
-    graph_edge_list_t *ptr;
+    graph_csr_t *csr;
+    graph_sp_tree_t *tree;
+    int t, series, parallel;
+    double start;
 
 
-    ptr = edges;
-
-    while (ptr && ptr->edge.id != id)
+    if (graph)
     {
-        ptr = ptr->next;
-    }
+        csr = create_graph_csr(graph);
 
-    return ptr;
-}
+        start = get_wall_time();
+        tree = series_parallel_decomposition(csr, undirected);
+        start = get_wall_time() - start;
 
+        printf("\n[Series-Parallel Decomposition]\n\n");
 
-/*
- *  Returns a pointer to the edge in edges list if the edge with ID id
- *  was found, NULL otherwise
- * 
- *  (RECURSIVE)
- */
-graph_edge_list_t * find_edge_R(graph_edge_list_t *ptr, id_t id)
-{
-    if (ptr)
-    {
-        if (ptr->edge.id == id)
-        {
-            return ptr;
-        }
-        else
+        if (tree)
         {
-            return find_edge_R(ptr->next, id);
-        }
-    }
-    else
-    {
-        return NULL;
-    }
-}
-
-
-/*
- *  Appends the passed ID to the top of the revoked ID stack (FIFO) 
- *  and returns the pointer to the bottom of the updated list.
- */
-id_list_t * append_revoked_id(id_list_t *list, id_t id)
-{
-    id_list_t *ptr, *new_revoked_id;
+            series = 0;
+            parallel = 0;
 
+            for (t = 0; t < tree->size; t++)
+            {
+                series += (tree->types[t] == SP_SERIES);
+                parallel += (tree->types[t] == SP_PARALLEL);
+            }
 
-    if (( new_revoked_id = (id_list_t*)malloc(sizeof(id_list_t)) ))
-    {
-        if (list)
-        {
-            for (ptr = list; ptr->next != NULL; ptr = ptr->next)
-                ;
-
-            new_revoked_id->id = id;
-            new_revoked_id->next = NULL;
-            ptr->next = new_revoked_id;
+            printf("\tTerminals: node %u and node %u\n", csr->node_ids[tree->sources[tree->root]], csr->node_ids[tree->sinks[tree->root]]);
+            printf("\tDecomposition tree: %d leaves, %d series and %d parallel compositions (%.3f ms)\n", 
+                tree->size - series - parallel, series, parallel, 1000 * start
+            );
+            printf("\tMaximum independent set: %d nodes\n", sp_max_independent_set(tree));
+            printf("\tLongest path between the terminals: %ld\n", sp_longest_path(csr, tree));
         }
         else
         {
-            list = new_revoked_id;
-            list->next = NULL;
-            list->id = id;
+            printf("\tThe graph isn't series-parallel\n");
         }
+
+        tree = delete_sp_tree(tree);
+        csr = delete_graph_csr(csr);
     }
     else
     {
-        printf("[append_revoked_id()] ERROR: Memory allocation was unsuccessful\n");
+        printf("\n\t[EMPTY GRAPH]\n");
     }
-
-    return list;
 }
 
 
 /*
- *  Deletes the provided ID 'id' from the given ID list
+ *  Creates an edge list based on user input and returns 
+ *  the list head pointer
  */
-id_list_t * delete_revoked_id(id_list_t *list, id_t id)
+graph_edge_list_t * input_edge_list(id_t node_id)
 {
-    id_list_t *del, *prev;
+    graph_edge_list_t *edges;
+    int weight; 
+    char *label;
+    id_t endpoint_ids[2];
+    int quantity;
+    int i;
 
 
-    if (list)
-    {
-        prev = NULL;
-        del = list;
+    edges = NULL;
+    i = 0;
 
-        while (del && del->id != id)
-        {
-            prev = del;
-            del = del->next;
-        }    
+    /* Asking for the quantity of edges to insert next */
+    quantity = *((int*)safe_input(INT, STRING_BUFFER_SIZE, "Insert amount of edges to input: "));
+    
+    while (i < quantity)
+    {   
+        /* Weight input */
+        printf("Insert edge #%d weight: ", i + 1);
+        weight = *((int*)safe_input(INT, STRING_BUFFER_SIZE, NULL));
 
-        if (del)
+        /* Label input */
+        do
         {
-            if (prev == NULL)
-            {
-                list = del->next;
-                free(del);
-            }
-            else
-            {
-                prev->next = del->next;
-                free(del);
-            }
-        }
+            label = (char*)safe_input(STRING, STRING_BUFFER_SIZE, "Insert edge label: ");
+        } 
+        while (strlen(label) == 0);
+
+        /* Endpoint IDs input */
+        printf("Insert edge #%d final endpoint ID (SELF_NID=%d): ", i + 1, node_id);
+
+        endpoint_ids[0] = node_id;
+        endpoint_ids[1] = *((id_t*)safe_input(U_INT, STRING_BUFFER_SIZE, NULL));        
+
+        edges = append_edge(edges, create_new_edge(weight, label, endpoint_ids));
+        i++;
     }
 
-    return list;
+    return edges;
 }
 
 
 /*
- *  Deletes all IDs in the given ID list
+ *  Creates a node based on user input and returns
+ *  a node element
  */
-id_list_t * delete_all_revoked_id(id_list_t *list)
+graph_node_t input_node(void)
 {
-    id_list_t *del;
+    graph_node_t node;
+    char *label;
+    
 
+    printf("\n[NODE]\n");
 
-    while (list)
+    /* Label input */
+    do
     {
-        del = list;
-        list = list->next;
-        free(del);
-    }
+        label = (char*)safe_input(STRING, STRING_BUFFER_SIZE, "Insert node label: ");
+    } 
+    while (strlen(label) == 0); 
 
-    return list;
+    /* New node creation */
+    node = create_new_node(label);
+    
+    node.edges = input_edge_list(get_id_from_node(&node));
+
+    return node;
 }   
 
 
 /*
- *  Pops the revoked ID that sits at the bottom of the stack (FIFO) 
- *  and puts it in the id parameter. If the list is empty, id contains 0 (ERROR_ID)
+ *  Creates a graph based on user input and returns
+ *  the list head pointer
  */
-id_list_t * pop_front_revoked_id(id_list_t *list, id_t *id)
+graph_t * input_graph(void)
 {
-    id_list_t *del;
+    graph_t *graph;
+    int graph_dim, i;
 
-    if (list)
+
+    graph = NULL;
+
+    /* Input of graph dimension */
+    do
     {
-        *(id) = list->id;
+        graph_dim = *((int*)safe_input(INT, STRING_BUFFER_SIZE, "Insert graph size: "));
+    } 
+    while (graph_dim < 0);
 
-        del = list;
-        list = list->next;
-        free(del);
-    }
-    else
+    /* Creating the graph */
+    for (i = 0; i < graph_dim; i++)
     {
-        *(id) = ERROR_ID;
+        graph = append_node(graph, input_node());
     }
 
-    return list;
+    return graph;
 }
 
 
 /*
- *  Returns 'true' (1 but bool_t) if the given ID 'id' is found in
- *  the ID list, false (0 but bool_t) otherwise
+ *  Safe input method that can get an user input in different 
+ *  data types (see the "enum type" for the complete list) by
+ *  first acquiring user input in a buffer and then formatting it
+ *  as specified by the function parameters. Then the function
+ *  returns a void pointer that needs to be formatted afterwards
+ *  into the correct type
  */
-bool_t find_revoked_id(id_list_t *list, id_t id)
+void * safe_input(const type_t type_selector, const unsigned long int bufsize, char *message)
 {
-    id_list_t *ptr;
-
+    void *result;
+    char *buf, *format, *filtered_buf;
+    bool_t acquired_input;
 
-    ptr = list;
 
-    if (list)
+    if (bufsize > 0)
     {
-        while (ptr && ptr->id != id)
+        switch (type_selector)
         {
-            ptr = ptr->next;
-        }
-    }    
+            case SHORT_INT:     format = "%hd";
+                                result = (short*)malloc(sizeof(short int));
+                                break;
+            
+            case U_SHORT_INT:   format = "%hu";
+                                result = (unsigned short int*)malloc(sizeof(unsigned short int));
+                                break;
 
-    return (ptr && ptr->id == id);
-}
+            case INT:           format = "%d";
+                                result = (int*)malloc(sizeof(int));
+                                break;
+            
+            case U_INT:         format = "%u";
+                                result = (unsigned int*)malloc(sizeof(unsigned int));
+                                break;
 
+            case LONG_INT:      format = "%ld";
+                                result = (long int*)malloc(sizeof(long int));
+                                break;
+            
+            case U_LONG_INT:    format = "%lu";
+                                result = (unsigned long int*)malloc(sizeof(unsigned long int));
+                                break;
 
-/*
- *  Returns 'true' (1 but bool_t) if the given ID 'id' is found in
- *  the ID list, false (0 but bool_t) otherwise
- * 
- *  (RECURSIVE)
- */
-bool_t find_revoked_id_R(id_list_t *ptr, id_t id)
-{
-    if (ptr)
-    {
-        if (ptr->id == id)
-        {
-            return true;
-        }
-        else
-        {
-            return find_revoked_id_R(ptr->next, id);
-        }
-    }
-    else
-    {
-        return false;
-    }
-}
+            case FLOAT:         format = "%f";
+                                result = (float*)malloc(sizeof(float));
+                                break;
 
+            case DOUBLE:        format = "%lf";
+                                result = (double*)malloc(sizeof(double));
+                                break;
 
-/*
- *  In graph theory, vertex contraction is an operation that, given two nodes, 
- *  combines them and their relative edges into a single node
- *  
- *  Given the two node IDs, where first_node_id is the ID of the merge_node (or the 'surviving' node)
- *  and second_node_id is the ID of the donor_node (or the node that will be deleted), the program
- *  unlinks any edge between each node (in both directions) and also corrects each edge's beginning
- *  or destination node ID of each edge that is either going outwards or inwards the donor_node, thus
- *  relinking each edge to the node merge_node. Finally, the donor_node gets deleted and the vertex
+            case CHAR:          format = "%c";
+                                result = (char*)malloc(sizeof(char));
+                                break;
+
+            case STRING:        format = "%s";
+                                result = (char*)malloc(sizeof(char) * (bufsize + 1));
+                                break;
+
+            default:            format = STRING_EMPTY_PLACEHOLDER;
+                                result = NULL;
+        }
+
+        if (result)
+        {
+            if (( buf = (char*)malloc(sizeof(char) * (bufsize + 1)) ))
+            {
+                acquired_input = false;
+                fflush(stdin);
+
+                do
+                {
+                    if (message)
+                    {
+                        printf("%s", message);
+                    }
+
+                    /* 
+                     *  NOTE: 
+                     *  -   fgets() puts an END_OF_STRING ('\0') character at the 
+                     *      end of the buffer if no errors occur during input
+                     */
+                    if (fgets(buf, bufsize + 1, stdin))
+                    {
+                        if (type_selector != STRING)
+                        {
+                            if (1 == sscanf(buf, format, result))
+                            {
+                                acquired_input = true;
+                            }
+                        }
+                        else
+                        {
+                            filtered_buf = filter(buf, NEWLINE_CHAR);
+                            memcpy(result, filtered_buf, strlen(filtered_buf));
+
+                            acquired_input = true;
+                        }
+                    }
+                }
+                while ( !acquired_input );
+
+                free(buf);
+            }
+            else
+            {
+                printf("[safe_input()] ERROR: Memory allocation was unsuccessful\n");
+            }
+        }
+        else
+        {
+            if (strcmp(format, STRING_EMPTY_PLACEHOLDER) == 0)
+            {
+                printf("[safe_input()] ERROR: Memory allocation was unsuccessful\n");
+            }
+            else
+            {
+                printf("[safe_input()] ERROR: The selected type does not exist in the list of specified ones\n");
+            }
+        }
+    }
+    else
+    {
+        result = NULL;
+        printf("[safe_input()] ERROR: The give buffer size can only be greater than zero\n");
+    }
+
+    return result;
+}
+
+
+/*
+ *  Given a file pointer containing the graph description, creates the 
+ *  graph from such description
+ */
+graph_t * load_graph(char *filename)
+{
+    FILE *src;
+    graph_t *graph, *ptr;
+    char *buf;
+    char *src_node_label, *dest_node_label, *edge_label;
+    id_t endpoints[2];
+    int label_len, edge_count, weight;
+
+
+    graph = NULL;
+    ptr = NULL;
+
+    if (( buf = (char*)malloc(sizeof(char) * (STRING_BUFFER_SIZE + 1)) ))
+    {
+        if (( src = fopen(filename, "r") ))
+        {
+            while (1 == fscanf(src, "%s", buf))
+            {
+                label_len = strlen(buf);
+                *(buf + label_len) = END_OF_STRING;
+
+                if (( src_node_label = (char*)malloc(sizeof(char) * (label_len + 1)) ))
+                {   
+                    strcpy(src_node_label, buf);
+                }
+                else
+                {
+                    printf("[load_graph()] ERROR: Memory allocation was unsuccessful\n");
+                    strcpy(src_node_label, STRING_EMPTY_PLACEHOLDER);
+                }
+
+                graph = append_node(
+                    graph, 
+                    create_new_node(src_node_label)
+                );
+
+                fscanf(src, "%[^\n]", buf);
+            }
+
+            rewind(src);
+
+            while (1 == fscanf(src, "%s", buf))
+            {
+                label_len = strlen(buf);
+                *(buf + label_len) = END_OF_STRING;
+
+                if (1 != fscanf(src, " (%d)", &edge_count))
+                {
+                    edge_count = 0;
+                }
+
+                if (ptr == NULL)
+                {
+                    ptr = graph;
+                }
+                else
+                {
+                    ptr = ptr->next;
+                }  
+  
+                if (
+                    (1 == fscanf(src, "%s", buf)) 
+                    && (0 == strcmp(buf, FILE_NODE_EDGE_SEP_STRING))
+                )
+                {
+                    endpoints[0] = ptr->node.id;
+
+                    while (edge_count)
+                    {
+                        if (
+                            ( dest_node_label = (char*)malloc(sizeof(char) * (STRING_BUFFER_SIZE + 1)) )
+                            && ( edge_label = (char*)malloc(sizeof(char) * (STRING_BUFFER_SIZE + 1)) )
+                        )
+                        {
+                            fscanf(src, " %[^(]", dest_node_label);
+                            *(dest_node_label + STRING_BUFFER_SIZE) = END_OF_STRING;
+
+                            fscanf(src, "(%[^,]", edge_label);
+                            *(edge_label + STRING_BUFFER_SIZE) = END_OF_STRING;                            
+
+                            fscanf(src, ", %[^),]", buf);
+                            weight = *(buf) - ZERO_CHAR;
+
+                            if (edge_count > 1)
+                            {
+                                fscanf(src, "%[^ \n]", buf);
+                            }
+
+                            endpoints[1] = get_id_from_node_label(graph, dest_node_label);
+
+                            ptr->node.edges = append_edge(
+                                ptr->node.edges,
+                                create_new_edge(
+                                    weight,
+                                    edge_label,
+                                    endpoints
+                                )
+                            );
+                        }
+                        else
+                        {
+                            printf("[load_graph()] ERROR: Memory allocation was unsuccessful\n");
+                        }
+
+                        edge_count--;
+                    }
+
+                    fscanf(src, "%[^\n]", buf);
+                }                     
+            }
+
+            fclose(src);
+        }
+        else
+        {
+            printf("[load_graph()] ERROR: The given file '%s' does not exist\n", filename);
+        }
+    }
+    else
+    {
+        printf("[load_graph()] ERROR: Memory allocation was unsuccessful\n");
+    }
+
+    return graph;
+}
+
+
+/*
+ *  Given a graph and a filename, the function saves the graph as follows:
+ *      
+ *      "src_node_label (src_node_edges_count) -> dest_node_label(edge_label, edge_weight), "
+ * 
+ *  NOTE:
+ *   - If a node has more that one edge, they are saved concatenated on the same line
+ * 
+ *   - If the provided filename is of an unexisting file, fopen() creates a new file
+ *     thus there'll be always a savefile, either already existing or newly created
+ */
+void save_graph(graph_t *graph, char *filename)
+{
+    FILE *f;
+    graph_t *ptr;
+    graph_edge_list_t *ptr2;
+    long int edge_count;
+    id_t dest_node_id;
+
+
+    /* Written straight to the file, so that nodes with many edges don't overflow a line buffer */
+    if (( f = fopen(filename, "w") ))
+    {
+        ptr = graph;
+
+        while (ptr)
+        {
+            ptr2 = ptr->node.edges;
+            edge_count = 0;
+            
+            while (ptr2)
+            {
+                edge_count++;
+                ptr2 = ptr2->next;
+            }
+
+            fprintf(f, "%s (%ld) "FILE_NODE_EDGE_SEP_STRING" ", ptr->node.label, edge_count);
+
+            ptr2 = ptr->node.edges;
+
+            while (ptr2)
+            {
+                dest_node_id = ptr2->edge.endpoint_ids[1];
+
+                if (dest_node_id != ERROR_ID)
+                {
+                    fprintf(f, "%s(%s, %d), ", (get_node_from_id(graph, dest_node_id))->label, ptr2->edge.label, ptr2->edge.weight);
+                }
+                
+                ptr2 = ptr2->next;
+            }
+
+            fprintf(f, "\n");
+            ptr = ptr->next;
+        }
+        
+        fclose(f);
+    }
+    else
+    {
+        printf("[save_graph()] ERROR: The given file '%s' does not exist\n", filename);
+    }
+}
+
+
+/*
+ *  Given a file created by save_landmarks(), it loads the landmarks table described in it.
+ *  Returns NULL if the file doesn't exist or if its content is malformed
+ */
+graph_landmarks_t * load_landmarks(char *filename)
+{
+    FILE *src;
+    graph_landmarks_t *landmarks;
+    char *buf;
+    int node_count, landmark_count, i;
+    bool_t malformed;
+
+
+    landmarks = NULL;
+
+    if (( buf = (char*)malloc(sizeof(char) * (STRING_BUFFER_SIZE + 1)) ))
+    {
+        if (( src = fopen(filename, "r") ))
+        {
+            if (
+                1 == fscanf(src, "%256s", buf)
+                && 0 == strcmp(buf, LANDMARKS_FILE_HEADER)
+                && 2 == fscanf(src, " (%d, %d)", &node_count, &landmark_count)
+                && node_count > 0 && landmark_count > 0 && landmark_count <= node_count
+            )
+            {
+                if (( landmarks = (graph_landmarks_t*)calloc(1, sizeof(graph_landmarks_t)) ))
+                {
+                    landmarks->node_count = node_count;
+                    landmarks->landmark_count = landmark_count;
+
+                    if (
+                        ( landmarks->landmarks = (int*)malloc(sizeof(int) * landmark_count) )
+                        && ( landmarks->dist_from = (long int*)malloc(sizeof(long int) * node_count * landmark_count) )
+                        && ( landmarks->dist_to = (long int*)malloc(sizeof(long int) * node_count * landmark_count) )
+                    )
+                    {
+                        malformed = false;
+
+                        for (i = 0; i < landmark_count && !malformed; i++)
+                        {
+                            malformed = (1 != fscanf(src, "%d", &(landmarks->landmarks[i])));
+                        }
+
+                        for (i = 0; i < node_count * landmark_count && !malformed; i++)
+                        {
+                            malformed = (2 != fscanf(src, "%ld %ld", &(landmarks->dist_from[i]), &(landmarks->dist_to[i])));
+                        }
+
+                        if (malformed)
+                        {
+                            printf("[load_landmarks()] ERROR: The file '%s' is malformed\n", filename);
+                            landmarks = delete_landmarks(landmarks);
+                        }
+                    }
+                    else
+                    {
+                        printf("[load_landmarks()] ERROR: Memory allocation was unsuccessful\n");
+                        landmarks = delete_landmarks(landmarks);
+                    }
+                }
+                else
+                {
+                    printf("[load_landmarks()] ERROR: Memory allocation was unsuccessful\n");
+                }
+            }
+            else
+            {
+                printf("[load_landmarks()] ERROR: The file '%s' is malformed\n", filename);
+            }
+
+            fclose(src);
+        }
+        else
+        {
+            printf("[load_landmarks()] ERROR: The given file '%s' does not exist\n", filename);
+        }
+
+        free(buf);
+    }
+    else
+    {
+        printf("[load_landmarks()] ERROR: Memory allocation was unsuccessful\n");
+    }
+
+    return landmarks;
+}
+
+
+/*
+ *  Given a landmarks table and a filename, the function saves the table as follows:
+ * 
+ *      "landmarks (node_count, landmark_count)"
+ *      "landmark_index_1 landmark_index_2 ... "
+ *      "dist_from_1 dist_to_1 dist_from_2 dist_to_2 ... "     (one line per node)
+ * 
+ *  NOTE:
+ *   - Nodes are identified by their position in the graph list, which is preserved by 
+ *     save_graph() and load_graph() (unlike the node IDs), so the table can be saved next to 
+ *     the graph file and loaded again with it, without repeating the preprocessing
+ * 
+ *   - Unreachable pairs are saved with the value of GRAPH_DIST_INF
+ */
+void save_landmarks(graph_landmarks_t *landmarks, char *filename)
+{
+    FILE *f;
+    int i, j;
+
+
+    if (landmarks)
+    {
+        if (( f = fopen(filename, "w") ))
+        {
+            fprintf(f, "%s (%d, %d)\n", LANDMARKS_FILE_HEADER, landmarks->node_count, landmarks->landmark_count);
+
+            for (i = 0; i < landmarks->landmark_count; i++)
+            {
+                fprintf(f, "%d ", landmarks->landmarks[i]);
+            }
+
+            fprintf(f, "\n");
+
+            for (i = 0; i < landmarks->node_count; i++)
+            {
+                for (j = 0; j < landmarks->landmark_count; j++)
+                {
+                    fprintf(f, "%ld %ld ", 
+                        landmarks->dist_from[j + (i * landmarks->landmark_count)], 
+                        landmarks->dist_to[j + (i * landmarks->landmark_count)]
+                    );
+                }
+
+                fprintf(f, "\n");
+            }
+
+            fclose(f);
+        }
+        else
+        {
+            printf("[save_landmarks()] ERROR: The given file '%s' could not be opened\n", filename);
+        }
+    }
+}
+
+
+/*
+ *  Given a file created by save_reachability(), it loads the reachability index described in it.
+ *  Returns NULL if the file doesn't exist or if its content is malformed
+ */
+graph_reachability_t * load_reachability(char *filename)
+{
+    FILE *src;
+    graph_reachability_t *reach;
+    char *buf;
+    int node_count, component_count, out_size, in_size, words, count, c, i;
+    bool_t malformed;
+
+
+    reach = NULL;
+
+    if (( buf = (char*)malloc(sizeof(char) * (STRING_BUFFER_SIZE + 1)) ))
+    {
+        if (( src = fopen(filename, "r") ))
+        {
+            if (
+                1 == fscanf(src, "%256s", buf)
+                && 0 == strcmp(buf, REACHABILITY_FILE_HEADER)
+                && 4 == fscanf(src, " (%d, %d, %d, %d)", &node_count, &component_count, &out_size, &in_size)
+                && node_count > 0 && component_count > 0 && component_count <= node_count && out_size >= 0 && in_size >= 0
+            )
+            {
+                if (( reach = (graph_reachability_t*)calloc(1, sizeof(graph_reachability_t)) ))
+                {
+                    reach->node_count = node_count;
+                    reach->component_count = component_count;
+                    words = BITSET_WORDS(component_count);
+
+                    /* Without labels, the file stores the transitive closure */
+                    if (
+                        ( reach->component = (int*)malloc(sizeof(int) * node_count) )
+                        && (
+                            (
+                                out_size == 0
+                                && ( reach->closure = (bitset_word_t*)malloc(sizeof(bitset_word_t) * ((size_t)component_count * words + 1)) )
+                            )
+                            || (
+                                out_size > 0
+                                && ( reach->pre = (int*)malloc(sizeof(int) * component_count) )
+                                && ( reach->post = (int*)malloc(sizeof(int) * component_count) )
+                                && ( reach->low = (int*)malloc(sizeof(int) * component_count) )
+                                && ( reach->out_offsets = (int*)malloc(sizeof(int) * (component_count + 1)) )
+                                && ( reach->out_hubs = (int*)malloc(sizeof(int) * out_size) )
+                                && ( reach->in_offsets = (int*)malloc(sizeof(int) * (component_count + 1)) )
+                                && ( reach->in_hubs = (int*)malloc(sizeof(int) * (in_size + 1)) )
+                            )
+                        )
+                    )
+                    {
+                        malformed = false;
+
+                        for (i = 0; i < node_count && !malformed; i++)
+                        {
+                            malformed = (
+                                1 != fscanf(src, "%d", &(reach->component[i]))
+                                || reach->component[i] < 0 || reach->component[i] >= component_count
+                            );
+                        }
+
+                        if (reach->closure)
+                        {
+                            for (i = 0; i < component_count * words && !malformed; i++)
+                            {
+                                malformed = (1 != fscanf(src, "%lx", &(reach->closure[i])));
+                            }
+                        }
+                        else
+                        {
+                            reach->out_offsets[0] = 0;
+                            reach->in_offsets[0] = 0;
+
+                            for (c = 0; c < component_count && !malformed; c++)
+                            {
+                                malformed = (
+                                    4 != fscanf(src, "%d %d %d %d", &(reach->pre[c]), &(reach->post[c]), &(reach->low[c]), &count)
+                                    || count < 0 || count > out_size - reach->out_offsets[c]
+                                );
+
+                                for (i = reach->out_offsets[c]; !malformed && i < reach->out_offsets[c] + count; i++)
+                                {
+                                    malformed = (1 != fscanf(src, "%d", &(reach->out_hubs[i])));
+                                }
+
+                                reach->out_offsets[c + 1] = reach->out_offsets[c] + count;
+
+                                malformed = (
+                                    malformed
+                                    || 1 != fscanf(src, "%d", &count)
+                                    || count < 0 || count > in_size - reach->in_offsets[c]
+                                );
+
+                                for (i = reach->in_offsets[c]; !malformed && i < reach->in_offsets[c] + count; i++)
+                                {
+                                    malformed = (1 != fscanf(src, "%d", &(reach->in_hubs[i])));
+                                }
+
+                                reach->in_offsets[c + 1] = reach->in_offsets[c] + count;
+                            }
+
+                            malformed = malformed || reach->out_offsets[component_count] != out_size || reach->in_offsets[component_count] != in_size;
+                        }
+
+                        if (malformed)
+                        {
+                            printf("[load_reachability()] ERROR: The file '%s' is malformed\n", filename);
+                            reach = delete_reachability(reach);
+                        }
+                    }
+                    else
+                    {
+                        printf("[load_reachability()] ERROR: Memory allocation was unsuccessful\n");
+                        reach = delete_reachability(reach);
+                    }
+                }
+                else
+                {
+                    printf("[load_reachability()] ERROR: Memory allocation was unsuccessful\n");
+                }
+            }
+            else
+            {
+                printf("[load_reachability()] ERROR: The file '%s' is malformed\n", filename);
+            }
+
+            fclose(src);
+        }
+        else
+        {
+            printf("[load_reachability()] ERROR: The given file '%s' does not exist\n", filename);
+        }
+
+        free(buf);
+    }
+    else
+    {
+        printf("[load_reachability()] ERROR: Memory allocation was unsuccessful\n");
+    }
+
+    return reach;
+}
+
+
+/*
+ *  Given a reachability index and a filename, the function saves the index as follows:
+ * 
+ *      "reachability (node_count, component_count, out_label_size, in_label_size)"
+ *      "component_1 component_2 ... "                              (one per node)
+ * 
+ *  followed by the transitive closure (the label sizes are 0), one line of hexadecimal words
+ *  per component, or by the labels, one line per component:
+ * 
+ *      "pre post low out_count out_hub_1 ... in_count in_hub_1 ... "
+ * 
+ *  NOTE: Like the landmarks tables (see save_landmarks()), nodes are identified by their 
+ *        position in the graph list, so the index can be saved next to the graph file and 
+ *        loaded again with it, without repeating the preprocessing
+ */
+void save_reachability(graph_reachability_t *reach, char *filename)
+{
+    FILE *f;
+    int words, c, i;
+
+
+    if (reach)
+    {
+        if (( f = fopen(filename, "w") ))
+        {
+            fprintf(f, "%s (%d, %d, %d, %d)\n", 
+                REACHABILITY_FILE_HEADER, reach->node_count, reach->component_count,
+                reach->closure ? 0 : reach->out_offsets[reach->component_count],
+                reach->closure ? 0 : reach->in_offsets[reach->component_count]
+            );
+
+            for (i = 0; i < reach->node_count; i++)
+            {
+                fprintf(f, "%d ", reach->component[i]);
+            }
+
+            fprintf(f, "\n");
+            words = BITSET_WORDS(reach->component_count);
+
+            for (c = 0; c < reach->component_count; c++)
+            {
+                if (reach->closure)
+                {
+                    for (i = c * words; i < (c + 1) * words; i++)
+                    {
+                        fprintf(f, "%lx ", reach->closure[i]);
+                    }
+                }
+                else
+                {
+                    fprintf(f, "%d %d %d %d ", reach->pre[c], reach->post[c], reach->low[c], reach->out_offsets[c + 1] - reach->out_offsets[c]);
+
+                    for (i = reach->out_offsets[c]; i < reach->out_offsets[c + 1]; i++)
+                    {
+                        fprintf(f, "%d ", reach->out_hubs[i]);
+                    }
+
+                    fprintf(f, "%d ", reach->in_offsets[c + 1] - reach->in_offsets[c]);
+
+                    for (i = reach->in_offsets[c]; i < reach->in_offsets[c + 1]; i++)
+                    {
+                        fprintf(f, "%d ", reach->in_hubs[i]);
+                    }
+                }
+
+                fprintf(f, "\n");
+            }
+
+            fclose(f);
+        }
+        else
+        {
+            printf("[save_reachability()] ERROR: The given file '%s' could not be opened\n", filename);
+        }
+    }
+}
+
+
+/* 
+ *  Creates a standalone node (meaning that it has 0 edges at time of creation)
+ *  with an additional label 
+ * 
+ *  (+) Prioritizes the use of revoked_node_ids to initialize the
+ *      new node instead of straight up using a new node ID
+ */
+graph_node_t create_new_node(char *label)
+{
+    graph_node_t new_node;
+
+
+    new_node.label = label;
+    new_node.edges = NULL;
+
+    if (revoked_node_ids)
+    {
+        revoked_node_ids = pop_front_revoked_id(revoked_node_ids, &(new_node.id));
+    }
+    else
+    {
+        new_node.id = set_node_id();
+    }
+
+    return new_node;
+}
+
+
+/*
+ *  Creates a new standalone edge element with all its properties 
+ *  set with the given parameters
+ * 
+ *  (+) Prioritizes the use of revoked_edge_ids to initialize the
+ *      new edge instead of straight up using a new edge ID
+ */
+graph_edge_t create_new_edge(int weight, char *label, id_t endpoint_ids[2])
+{
+    graph_edge_t new_edge;
+    char *new_label;
+    int len, i;
+
+
+    len = strlen(label);
+
+    new_edge.weight = weight;
+    new_edge.endpoint_ids[0] = endpoint_ids[0];
+    new_edge.endpoint_ids[1] = endpoint_ids[1];
+
+    if (revoked_edge_ids)
+    {
+        revoked_edge_ids = pop_front_revoked_id(revoked_edge_ids, &(new_edge.id));
+    }
+    else
+    {
+        new_edge.id = set_edge_id();
+    }
+
+    if (( new_label =  (char*)malloc(sizeof(char) * (len + 1)) ))
+    {
+        for (i = 0; i < len; i++)
+        {
+            *(new_label + i) = *(label + i);
+        }
+        *(new_label + len) = END_OF_STRING;
+
+        new_edge.label = new_label;
+    }
+    else
+    {
+        printf("[create_new_edge()] ERROR: Memory allocation was unsuccessful\n");
+        new_edge.label = NULL;
+    }    
+
+    return new_edge;
+}
+
+
+/* 
+ *  Given a graph, it returns a new graph that has the same nodes
+ *  and edges but with newly attributed node and edge IDs
+ */
+graph_t * create_graph_copy(graph_t *old_graph)
+{
+    graph_t *graph, *ptr, *ptr2;
+    graph_t *old_ptr, *old_ptr2;
+    graph_node_t *node;
+    graph_edge_list_t *ptr3;
+    id_t endpoints[2];
+    bool_t found;
+    int i, j, dim;
+    int *old_mat;
+
+
+    graph = NULL;
+
+    if (old_graph)
+    {
+        old_mat = create_graph_matrix(old_graph);
+        ptr = old_graph;
+
+        while (ptr)
+        {       
+            graph = append_node(
+                graph,
+                create_new_node(
+                    ptr->node.label
+                )
+            );
+
+            ptr = ptr->next;
+        }
+
+        dim = graph_dim(old_graph);
+        ptr = graph;
+        old_ptr = old_graph;
+        i = 0;
+
+        while (ptr && old_ptr)
+        {
+            endpoints[0] = ptr->node.id;
+            ptr2 = graph;
+            old_ptr2 = old_graph;
+            j = 0;
+
+            while (ptr2 && old_ptr2)
+            {
+                if (*(old_mat + j + (i * dim)) == 1)
+                {
+                    endpoints[1] = ptr2->node.id;
+
+                    node = get_node_from_id(old_graph, old_ptr->node.id);
+                    ptr3 = node->edges;
+                    found = false;
+
+                    while (ptr3 && !found)
+                    {
+                        if (ptr3->edge.endpoint_ids[1] == old_ptr2->node.id)
+                        {
+                            found = true;
+                        }
+                        else
+                        {
+                            ptr3 = ptr3->next;
+                        }
+                    }
+
+                    if (found)
+                    {
+                        ptr->node.edges = append_edge(
+                            ptr->node.edges,
+                            create_new_edge(
+                                ptr3->edge.weight,
+                                ptr3->edge.label,
+                                endpoints
+                            )
+                        );
+                    }
+                    else
+                    {
+                        ptr->node.edges = append_edge(
+                            ptr->node.edges,
+                            create_new_edge(
+                                DEFAULT_COPIED_EDGE_WEIGHT,
+                                DEFAULT_COPIED_EDGE_LABEL,
+                                endpoints
+                            )
+                        );
+                    }
+                }
+
+                ptr2 = ptr2->next;
+                old_ptr2 = old_ptr2->next;
+                j++;
+            }
+
+            ptr = ptr->next;
+            old_ptr = old_ptr->next;
+            i++;
+        }
+
+        /*
+        while (ptr)
+        {
+            endpoints[0] = ptr->node.id;
+            ptr2 = graph;
+            j = 0;
+
+            while (ptr2)
+            {
+                if (*(old_mat + j + (i * dim)) == 1)
+                {
+                    endpoints[1] = ptr2->node.id;
+                    ptr3 = old_graph;
+                    k = 0;
+
+                    while (ptr3->next && k < i)
+                    {
+                        ptr3 = ptr3->next;
+                        k++;
+                    }
+
+                    k = 0;
+                    ptr4 = ptr3->node.edges;
+
+                    while (ptr4->next && k < j)
+                    {
+                        ptr4 = ptr4->next;
+                        k++;
+                    }
+
+                    ptr->node.edges = append_edge(
+                        ptr->node.edges,
+                        create_new_edge(
+                            ptr4->edge.weight,
+                            ptr4->edge.label,
+                            endpoints
+                        )
+                    );
+                }
+
+                ptr2 = ptr2->next;
+                j++;
+            }
+
+            ptr = ptr->next;
+            i++;
+        }
+        */
+    }
+
+    return graph;
+}
+
+
+/*
+ *  Returns a pointer to the node with the given id if
+ *  it is found in the graph, NULL otherwise
+ */
+graph_node_t * get_node_from_id(graph_t *graph, id_t id)
+{
+    graph_t *ptr;
+
+
+    ptr = graph;
+
+    while (ptr && ptr->node.id != id)
+    {
+        ptr = ptr->next;
+    }
+
+    return &(ptr->node);
+}
+
+
+/*
+ *  Returns the given node's ID if it exists, 0 (ERROR_ID) otherwise
+ */
+id_t get_id_from_node(graph_node_t *node)
+{
+    if (node)
+    {
+        return node->id;
+    }
+    else
+    {
+        return ERROR_ID;
+    }
+}
+
+
+/*
+ *  Given a node label belonging to a node of the given graph,
+ *  it returns the corresponding node ID
+ * 
+ *  In case there's duplicated labels, it returns the ID of the
+ *  first node found in the graph
+ */
+id_t get_id_from_node_label(graph_t *graph, char *label)
+{
+    id_t node_id;
+    bool_t found;
+
+
+    node_id = ERROR_ID;
+    found = false;
+
+    while (graph && !found)
+    {
+        if (strcmp(graph->node.label, label) == 0)
+        {
+            node_id = graph->node.id;
+            found = true;
+        }
+
+        graph = graph->next;
+    }
+
+    return node_id;
+}
+
+
+/*
+ *  Searches the graph for the node with ID 'node_id' and, if it's found, 
+ *  adds to the edges list the new edges contained in the new_edges list
+ */
+void add_new_edges_to_node(graph_t *graph, id_t node_id, graph_edge_list_t *new_edges)
+{
+    while (graph && (graph->node.id != node_id))
+    {
+        graph = graph->next;
+    }
+
+    if (graph)
+    {
+        while (new_edges)
+        {
+            graph->node.edges = append_edge(graph->node.edges, new_edges->edge);
+            new_edges = new_edges->next;
+        }
+    }
+}
+
+
+/*
+ *  Searches the graph for the node with ID 'node_id' and, if it's found, 
+ *  then it proceeds to change the node's label with the new_label string
+ */
+void change_node_label(graph_t *graph, id_t node_id, char *new_label)
+{
+    while (graph && (graph->node.id != node_id))
+    {
+        graph = graph->next;
+    }
+
+    if (graph)
+    {
+        if (graph->node.label)
+        {
+            free(graph->node.label);
+        }
+
+        graph->node.label = new_label;
+    }
+}
+
+
+/*
+ *  Searches for each node in the graph the edge with ID 'edge_id' and, if it's 
+ *  found, then it proceeds to change the edge's label with the new_label string
+ */
+void change_edge_label(graph_t *graph, id_t edge_id, char *new_label)
+{
+    bool_t changed;
+
+
+    changed = false;
+
+    while (graph && !changed)
+    {
+        while (graph->node.edges && !changed)
+        {
+            if (graph->node.edges->edge.id == edge_id)
+            {
+                if (graph->node.edges->edge.label)
+                {
+                    free(graph->node.edges->edge.label);
+                }
+                graph->node.edges->edge.label = new_label;
+
+                changed = true;
+            }
+            else
+            {
+                graph->node.edges = graph->node.edges->next;
+            }
+        }
+
+        graph = graph->next;
+    }
+}
+
+
+/*
+ *  Given a graph, it finds each duplicated node label  
+ *  and substitutes it with an unique label 
+ *  (Achieved through the use of the ID as a 'hash' for the node label)
+ */
+graph_t * change_duplicated_node_labels(graph_t *graph, char *substitute)
+{
+    graph_t *ptr, *ptr2;
+
+
+    ptr = graph;
+
+    while (ptr)
+    {
+        ptr2 = graph;
+
+        while (ptr2)
+        {
+            if ((ptr != ptr2) && strcmp(ptr->node.label, ptr2->node.label) == 0)
+            {
+                if (ptr2->node.label)
+                {
+                    free(ptr2->node.label);
+                }
+
+                ptr2->node.label = strconcat(substitute, int_to_string(ptr2->node.id));
+            }
+
+            ptr2 = ptr2->next;
+        }
+
+        ptr = ptr->next;
+    }
+
+    return graph;
+}
+
+
+/*
+ *  Searches the graph for the node with ID 'node_id' and, if it's found, then
+ *  it searches its edges for the edge with edge ID 'edge_id' and, if it's found,
+ *  then proceeds to deleting that edge from the edges list of the node
+ */
+void delete_edge_from_node(graph_t *graph, id_t node_id, id_t edge_id)
+{
+    while (graph && (graph->node.id != node_id))
+    {
+        graph = graph->next;
+    }
+
+    if (graph)
+    {
+        graph->node.edges = delete_edge(graph->node.edges, edge_id);
+    }
+}
+
+
+/*
+ *  Given a graph, it removes any duplicated edge in each node
+ *  A duplicated edge is defined as having the same endpoint NIDs
+ */
+graph_t * delete_all_duplicate_edges(graph_t *graph)
+{
+    graph_t *ptr;
+    graph_edge_list_t *edges, *edges2, *del;
+
+
+    if (graph)
+    {
+        ptr = graph;
+
+        while (ptr)
+        {
+            edges = ptr->node.edges;
+
+            while (edges)
+            {
+                edges2 = ptr->node.edges;
+
+                while (edges2)
+                {
+                    if (edges->edge.id != edges2->edge.id)
+                    {
+                        if (
+                            edges->edge.endpoint_ids[0] == edges2->edge.endpoint_ids[0] 
+                            && edges->edge.endpoint_ids[1] == edges2->edge.endpoint_ids[1] 
+                        )
+                        {
+                            del = edges2;
+                            edges2 = edges2->next;
+                            ptr->node.edges = delete_edge(ptr->node.edges, del->edge.id);
+                        }
+                        else
+                        {
+                            edges2 = edges2->next;
+                        }
+                    }
+                    else
+                    {
+                        edges2 = edges2->next;
+                    }
+                }
+
+                edges = edges->next;
+            }
+
+            ptr = ptr->next;
+        }
+    }
+
+    return graph;
+}
+
+
+/*
+ *  Sets the edge ID of the edge the function is called on
+ *  and proceeds to increment the global_edge_id counter 
+ */
+id_t set_edge_id(void)
+{
+    return global_edge_id++;
+}
+
+
+/*
+ *  Sets the node ID of the node the function is called on
+ *  and proceeds to increment the global_node_id counter 
+ */
+id_t set_node_id(void)
+{
+    return global_node_id++;
+}
+
+
+/*
+ *  Prompts the user to choose a node ID between
+ *  the ones present in the given graph
+ */
+id_t select_node_id(graph_t *graph, char *msg_before_ids, char *msg_after_ids)
+{
+    id_t nid;
+
+    if (graph)
+    {
+        if (msg_before_ids)
+        {
+            printf("%s\n", msg_before_ids);
+        }
+
+        print_all_node_ids(graph);
+
+        do
+        {
+            nid = *((id_t*)safe_input(U_INT, STRING_BUFFER_SIZE, msg_after_ids));
+        } 
+        while (find_node(graph, nid) == NULL);
+    }
+    else
+    {
+        nid = ERROR_ID;
+    }
+
+    return nid;
+}
+
+
+/*
+ *  Given a starting node, the function returns the number of unique 
+ *  nodes that it encounters, thus returning the number of nodes
+ */
+int graph_dim(graph_t *graph)
+{
+    graph_t *ptr;
+    int len;
+    
+
+    ptr = graph;
+    len = 0;
+
+    while (ptr)
+    {
+        len++;
+        ptr = ptr->next;
+    }
+
+    return len;
+}
+
+
+/*
+ *  Given a starting node, the function returns the number of unique 
+ *  nodes that it encounters, thus returning the number of nodes
+ *
+ *  (RECURSIVE VERSION)
+ */
+int graph_dim_R(graph_t *graph)
+{
+    if (graph == NULL)
+    {
+        return 0;
+    }
+    else
+    {
+        return 1 + graph_dim_R(graph->next);
+    }
+}
+
+
+/*
+ *  Given the beginning of an edge list, returns its length
+ */
+int edge_list_dim(graph_edge_list_t *edges)
+{
+    int dim;
+
+
+    dim = 0;
+
+    while (edges)
+    {
+        dim++;
+        edges = edges->next;
+    }
+
+    return dim;
+}
+
+
+/*
+ *  Given the beginning of an edge list, returns its length
+ *
+ *  (RECURSIVE VERSION)
+ */
+int edge_list_dim_R(graph_edge_list_t *edges)
+{
+    if (edges)
+    {
+        return 1 + edge_list_dim_R(edges->next);
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+
+/*
+ *  If the graph exists, creates the corresponding matrix of the given graph
+ *  otherwise returns NULL
+ */
+int * create_graph_matrix(graph_t *graph)
+{
+    graph_t *row_ptr, *col_ptr;
+    graph_edge_list_t *row_ptr_edges;
+    bool_t found_common_edge;
+    int dim, i, j;
+    int *mat;
+    
+
+    mat = NULL;
+
+    if (graph)
+    {
+        dim = graph_dim(graph);
+
+        if (( mat = (int*)malloc(sizeof(int) * dim * dim) ))
+        {
+            row_ptr = graph;
+            i = 0;
+
+            while (i < dim && row_ptr)
+            {
+                col_ptr = graph;
+                j = 0;
+
+                while (j < dim && col_ptr)
+                {
+                    found_common_edge = false;
+                    row_ptr_edges = row_ptr->node.edges;
+
+                    while (!found_common_edge && row_ptr_edges)
+                    {
+                        if (row_ptr_edges->edge.endpoint_ids[1] == col_ptr->node.id)
+                        {
+                            found_common_edge = true;
+                        }
+
+                        row_ptr_edges = row_ptr_edges->next;
+                    }
+
+                    if (found_common_edge)
+                    {
+                        *(mat + j + (i * dim)) = 1;
+                    }
+                    else
+                    {
+                        *(mat + j + (i * dim)) = 0;
+                    }
+
+                    col_ptr = col_ptr->next;   
+                    j++;
+                }
+
+                row_ptr = row_ptr->next;
+                i++;
+            }
+            
+        }
+        else
+        {
+            printf("[create_graph_matrix()] ERROR: Memory allocation was unsuccessful\n");
+        }
+    }
+
+    return mat;
+}
+
+
+/*
+ *  If the graph exists, creates the corresponding distance matrix of the given graph, 
+ *  where each cell (i, j) contains the weight of the lightest edge from the i-th node to 
+ *  the j-th node (in graph list order), 0 if i = j and GRAPH_MATRIX_INF if there's no edge.
+ *  Otherwise returns NULL
+ * 
+ *  NOTE:
+ *   - The matrix is only created if every path length fits in it, that is if 
+ *     (node_count - 1) * max|weight| is below GRAPH_MATRIX_INF, so that floyd_warshall_apsp()
+ *     can neither confuse a distance with GRAPH_MATRIX_INF nor overflow. NULL is returned
+ *     for larger graphs or weights
+ */
+int * create_graph_weight_matrix(graph_t *graph)
+{
+    graph_csr_t *csr;
+    int dim, i, j, e;
+    long int max_abs_weight;
+    int *mat;
+
+
+    mat = NULL;
+
+    if (graph && ( csr = create_graph_csr(graph) ))
+    {
+        dim = csr->node_count;
+        max_abs_weight = ((long int)csr->max_weight > -(long int)csr->min_weight) ? csr->max_weight : -(long int)csr->min_weight;
+
+        if ((double)(dim - 1) * max_abs_weight >= GRAPH_MATRIX_INF)
+        {
+            printf("[create_graph_weight_matrix()] ERROR: The distances of %d nodes with weights up to %ld don't fit in the matrix\n", dim, max_abs_weight);
+        }
+        else if (( mat = (int*)malloc(sizeof(int) * dim * dim) ))
+        {
+            for (i = 0; i < dim; i++)
+            {
+                for (j = 0; j < dim; j++)
+                {
+                    *(mat + j + (i * dim)) = (i == j) ? 0 : GRAPH_MATRIX_INF;
+                }
+
+                for (e = csr->offsets[i]; e < csr->offsets[i + 1]; e++)
+                {
+                    j = csr->targets[e];
+
+                    if (csr->weights[e] < *(mat + j + (i * dim)))
+                    {
+                        *(mat + j + (i * dim)) = csr->weights[e];
+                    }
+                }
+            }
+        }
+        else
+        {
+            printf("[create_graph_weight_matrix()] ERROR: Memory allocation was unsuccessful\n");
+        }
+
+        csr = delete_graph_csr(csr);
+    }
+
+    return mat;
+}
+
+
+/*
+ *  Returns the amount of threads available to the parallel operations,
+ *  which is always 1 if the library isn't compiled with OpenMP
+ */
+int get_thread_count(void)
+{
+    #ifdef _OPENMP
+        return omp_get_max_threads();
+    #else
+        return 1;
+    #endif
+}
+
+
+/*
+ *  Returns the amount of threads of the team running the current parallel region, which 
+ *  can be less than get_thread_count() (e.g. dynamic teams, thread limits or nested regions),
+ *  always 1 outside of a parallel region or if the library isn't compiled with OpenMP
+ */
+int get_team_size(void)
+{
+    #ifdef _OPENMP
+        return omp_get_num_threads();
+    #else
+        return 1;
+    #endif
+}
+
+
+/*
+ *  Returns the ID (0 .. get_thread_count() - 1) of the calling thread
+ *  inside a parallel region, always 0 if the library isn't compiled with OpenMP
+ */
+int get_thread_id(void)
+{
+    #ifdef _OPENMP
+        return omp_get_thread_num();
+    #else
+        return 0;
+    #endif
+}
+
+
+/*
+ *  Returns the elapsed wall-clock time in seconds from an arbitrary point in the past,
+ *  so the difference between two calls measures the duration of an operation (if the
+ *  library isn't compiled with OpenMP, the processor time is used instead)
+ */
+double get_wall_time(void)
+{
+    #ifdef _OPENMP
+        return omp_get_wtime();
+    #else
+        return (double)clock() / CLOCKS_PER_SEC;
+    #endif
+}
+
+
+/* 
+ *  Given an edges list, it returns 0 if the node doesn't have an autoloop
+ *  and, in case they exist and are duplicated, returns the amount of
+ *  autoloops found in the edges list
+ */
+int autoloop_count(graph_edge_list_t *edges)
+{
+    int count;
+
+
+    count = 0;
+
+    while (edges)
+    {
+        if (edges->edge.endpoint_ids[0] == edges->edge.endpoint_ids[1])
+        {
+            count++;
+        }
+
+        edges = edges->next;
+    }
+
+    return count;
+}
+
+
+/*
+ *  Filters out all the given 'remove' characters found in str
+ */
+char * filter(char *str, char remove)
+{
+    char *filtered;
+    int i, j, len;
+   
+
+    filtered = NULL;
+
+    if (str)
+    {
+        len = strlen(str);
+        i = 0;
+
+        while ((str + i) && *(str + i) != END_OF_STRING)
+        {   
+            if ( *(str + i) == remove)
+            {
+                len--;
+            }
+            i++;
+        }
+
+        if (( filtered = (char*)malloc(sizeof(char) * (len + 1)) ))
+        {
+            i = 0;
+            j = 0;
+
+            while ((str + i) && *(str + i) != END_OF_STRING)
+            {
+                if (*(str + i) != remove)
+                {
+                    *(filtered + j) = *(str + i);
+                    j++;
+                }
+                i++;
+            }
+
+            *(filtered + len) = END_OF_STRING;
+        }
+        else
+        {
+            printf("[filter()] ERROR: Memory allocation was unsuccessful\n");
+        }
+    }
+
+    return filtered;
+}
+
+
+/*
+ *  Given an integer, it converts it into a string
+ */
+char * int_to_string(long int val)
+{   
+    char *str;
+    int digits, i, digit;
+    long int tmp, divider;
+
+
+    tmp = val;
+    digits = 0;
+
+    while (tmp)
+    {
+        tmp /= 10;
+        digits++;
+    }
+
+    /* The value 0 still has one digit */
+    digits = (digits > 0) ? digits : 1;
+
+    if (( str = (char*)malloc(sizeof(char) * (digits + 1)) ))
+    {
+        i = 0;
+        tmp = val;
+
+        while (i < digits)
+        {
+            divider = pow(10, digits - i - 1);
+            digit = tmp / divider;
+
+            *(str + i) = ZERO_CHAR + digit;
+            tmp -= digit * divider;
+
+            i++;
+        }
+
+        *(str + digits) = END_OF_STRING;
+    }
+    else
+    {
+        printf("[int_to_string()] ERROR: Memory allocation was unsuccessful\n");
+    }
+
+    return str;
+}
+
+
+/*
+ *  Given two source strings src1 and src2, it returns the concatenation 
+ *  of the beginning of src2 to the end of src1
+ */
+char * strconcat(char *src1, char *src2)
+{
+    char *str;
+    int len1, len2, len;
+    int i;
+
+
+    str = NULL;
+
+    if (src1 && src2)
+    {
+        len1 = strlen(src1);
+        len2 = strlen(src2);
+        len = len1 + len2;
+
+        if (( str = (char*)malloc(sizeof(char) * (len + 1)) ))
+        {
+            i = 0;
+
+            while (i < len1)
+            {
+                *(str + i) = *(src1 + i);
+                i++;
+            }
+
+            i = 0;
+
+            while (i < len2)
+            {
+                *(str + len1 + i) = *(src2 + i);
+                i++;
+            }
+
+            *(str + len) = END_OF_STRING;
+        }
+        else
+        {
+            printf("[strconcat()] ERROR: Memory allocation was unsuccessful\n");
+        }
+    }
+
+    return str;
+}
+
+
+/*
+ *  Pushes the passed node at the beginning of the graph list
+ *  and returns the updated graph 
+ */
+graph_t * push_node(graph_t *graph, graph_node_t node)
+{
+    graph_t *elem;
+
+
+    if (graph)
+    {
+        if (( elem = (graph_t*)malloc(sizeof(graph_t)) ))
+        {
+            elem->node = node;
+            elem->next = graph;
+            graph = elem;
+        }
+        else
+        {
+            printf("[push_node()] ERROR: Memory allocation was unsuccessful\n");
+        }
+    }
+
+    return graph;
+}
+
+
+/* 
+ *  Appends the passed node at the end of the graph list
+ *  and returns the updated graph 
+ */
+graph_t * append_node(graph_t *graph, graph_node_t node)
+{
+    graph_t *elem, *ptr;
+
+
+    if (( elem = (graph_t*)malloc(sizeof(graph_t)) ))
+    {
+        if (graph)
+        {
+            for (ptr = graph; ptr->next != NULL; ptr = ptr->next)
+                ;
+
+            elem->node = node;
+            elem->next = NULL;
+            ptr->next = elem;
+        }
+        else
+        {
+            graph = elem;
+            graph->next = NULL;
+            graph->node = node;
+        }        
+    }   
+    else
+    {
+        printf("[append_node()] ERROR: Memory allocation was unsuccessful\n");
+    }
+
+    return graph;
+}
+
+
+/*
+ *  Deletes the node in the graph that matches the given node ID and
+ *  then proceeds to return the updated graph
+ */
+graph_t * delete_node(graph_t *graph, id_t id)
+{
+    graph_t *prev, *del;
+
+
+    if (graph)
+    {   
+        prev = NULL;
+        del = graph;
+
+        while (del && del->node.id != id)
+        {
+            prev = del;
+            del = del->next;
+        }
+
+        if (del)
+        {
+            /* Revoke the node ID */
+            revoked_node_ids = append_revoked_id(revoked_node_ids, del->node.id);
+
+            if (prev == NULL)
+            {
+                graph = del->next;
+                free(del);
+            }
+            else
+            {
+                prev->next = del->next;
+                free(del);
+            }
+        }
+    }
+
+    return graph;
+}
+
+
+/*
+ *  Deletes all nodes in the graph
+ */
+graph_t * delete_graph(graph_t *graph)
+{
+    graph_t *del;
+    graph_edge_list_t *ptr;
+
+
+    while (graph)
+    {
+        /* Revoking each node ID */
+        revoked_node_ids = append_revoked_id(revoked_node_ids, graph->node.id);
+
+        /* Revoking all edge IDs for each node */
+        for (ptr = graph->node.edges; ptr != NULL; ptr = ptr->next)
+        {
+            revoked_edge_ids = append_revoked_id(revoked_edge_ids, ptr->edge.id);
+        }
+
+        /* Finally, delete the node from the graph */
+        del = graph;
+        graph = graph->next;
+        free(del);
+    }
+
+    return graph;
+}
+
+
+/*
+ *  Returns a pointer to the node if it's been found
+ *  in the graph, NULL otherwise
+ */
+graph_t * find_node(graph_t *graph, id_t id)
+{
+    graph_t *ptr;
+
+
+    ptr = graph;
+
+    while (ptr && ptr->node.id != id)
+    {
+        ptr = ptr->next;
+    }
+
+    return ptr;
+}
+
+
+/*
+ *  Returns a pointer to the node if it's been found
+ *  in the graph, NULL otherwise
+ * 
+ *  (RECURSIVE VERSION)
+ */
+graph_t * find_node_R(graph_t *ptr, id_t id)
+{
+    if (ptr)
+    {
+        if (ptr->node.id == id)
+        {
+            return ptr;
+        }
+        else
+        {
+            return find_node_R(ptr->next, id);
+        }  
+    }
+    else
+    {
+        return NULL;
+    }
+}
+
+
+/*
+ *  Pushes the given edge at the beginning of the given edges list
+ *  and proceeds to return the updated edges list
+ */
+graph_edge_list_t * push_edge(graph_edge_list_t *edges, graph_edge_t edge)
+{
+    graph_edge_list_t *elem;
+
+
+    if (edges)
+    {
+        if (( elem = (graph_edge_list_t*)malloc(sizeof(graph_edge_list_t)) ))
+        {
+            elem->edge = edge;
+            elem->next = edges;
+            edges = elem;
+        }
+        else
+        {
+            printf("[push_edge()] ERROR: Memory allocation was unsuccessful\n");
+        }
+    }
+
+    return edges;
+}
+
+
+/*
+ *  Appends the given edge at the end of the given edges lit
+ *  and proceeds to return the updated edges list
+ */
+graph_edge_list_t * append_edge(graph_edge_list_t *edges, graph_edge_t edge)
+{
+    graph_edge_list_t *elem, *ptr;
+
+
+    if (( elem = (graph_edge_list_t*)malloc(sizeof(graph_edge_list_t)) ))
+    {
+        if (edges)
+        {  
+            for (ptr = edges; ptr->next != NULL; ptr = ptr->next)
+                ;
+
+            elem->edge = edge;
+            elem->next = NULL;
+            ptr->next = elem;
+        }
+        else
+        {
+            edges = elem;
+            edges->edge = edge;
+            edges->next = NULL;
+        }
+    }
+    else
+    {
+        printf("[append_edge()] ERROR: Memory allocation was unsuccessful\n");
+    }
+
+    return edges;
+}
+
+
+/*
+ *  Deletes the edge with ID equal to the passed ID from the passed 
+ *  edges list, which is then returned updated
+ */
+graph_edge_list_t * delete_edge(graph_edge_list_t *edges, id_t id)
+{
+    graph_edge_list_t *del, *prev;
+
+
+    if (edges)
+    {
+        prev = NULL; 
+        del = edges;
+
+        while (del && del->edge.id != id)
+        {
+            prev = del;
+            del = del->next;
+        }
+
+        if (del)
+        {
+            /* Revoke this edge's ID */
+            revoked_edge_ids = append_revoked_id(revoked_edge_ids, del->edge.id);
+
+            if (prev == NULL)
+            {
+                edges = del->next;
+                free(del);
+            }
+            else
+            {
+                prev->next = del->next;
+                free(del);
+            }
+        }
+    }
+
+    return edges;
+}
+
+
+/*
+ *  Deletes all edges in the given edges list
+ */
+graph_edge_list_t * delete_edge_list(graph_edge_list_t *edges)
+{
+    graph_edge_list_t *del;
+
+
+    if (edges)
+    {   
+        while (edges)
+        {
+            /* Revoke each edge's ID */
+            revoked_edge_ids = append_revoked_id(revoked_edge_ids, edges->edge.id);
+
+            del = edges;
+            edges = edges->next;
+            free(del);
+        }
+    }
+
+    return edges;
+}
+
+
+/*
+ *  Returns a pointer to the edge in edges list if the edge with ID id
+ *  was found, NULL otherwise
+ */
+graph_edge_list_t * find_edge(graph_edge_list_t *edges, id_t id)
+{
+    graph_edge_list_t *ptr;
+
+
+    ptr = edges;
+
+    while (ptr && ptr->edge.id != id)
+    {
+        ptr = ptr->next;
+    }
+
+    return ptr;
+}
+
+
+/*
+ *  Returns a pointer to the edge in edges list if the edge with ID id
+ *  was found, NULL otherwise
+ * 
+ *  (RECURSIVE)
+ */
+graph_edge_list_t * find_edge_R(graph_edge_list_t *ptr, id_t id)
+{
+    if (ptr)
+    {
+        if (ptr->edge.id == id)
+        {
+            return ptr;
+        }
+        else
+        {
+            return find_edge_R(ptr->next, id);
+        }
+    }
+    else
+    {
+        return NULL;
+    }
+}
+
+
+/*
+ *  Appends the passed ID to the top of the revoked ID stack (FIFO) 
+ *  and returns the pointer to the bottom of the updated list.
+ */
+id_list_t * append_revoked_id(id_list_t *list, id_t id)
+{
+    id_list_t *ptr, *new_revoked_id;
+
+
+    if (( new_revoked_id = (id_list_t*)malloc(sizeof(id_list_t)) ))
+    {
+        if (list)
+        {
+            for (ptr = list; ptr->next != NULL; ptr = ptr->next)
+                ;
+
+            new_revoked_id->id = id;
+            new_revoked_id->next = NULL;
+            ptr->next = new_revoked_id;
+        }
+        else
+        {
+            list = new_revoked_id;
+            list->next = NULL;
+            list->id = id;
+        }
+    }
+    else
+    {
+        printf("[append_revoked_id()] ERROR: Memory allocation was unsuccessful\n");
+    }
+
+    return list;
+}
+
+
+/*
+ *  Deletes the provided ID 'id' from the given ID list
+ */
+id_list_t * delete_revoked_id(id_list_t *list, id_t id)
+{
+    id_list_t *del, *prev;
+
+
+    if (list)
+    {
+        prev = NULL;
+        del = list;
+
+        while (del && del->id != id)
+        {
+            prev = del;
+            del = del->next;
+        }    
+
+        if (del)
+        {
+            if (prev == NULL)
+            {
+                list = del->next;
+                free(del);
+            }
+            else
+            {
+                prev->next = del->next;
+                free(del);
+            }
+        }
+    }
+
+    return list;
+}
+
+
+/*
+ *  Deletes all IDs in the given ID list
+ */
+id_list_t * delete_all_revoked_id(id_list_t *list)
+{
+    id_list_t *del;
+
+
+    while (list)
+    {
+        del = list;
+        list = list->next;
+        free(del);
+    }
+
+    return list;
+}   
+
+
+/*
+ *  Pops the revoked ID that sits at the bottom of the stack (FIFO) 
+ *  and puts it in the id parameter. If the list is empty, id contains 0 (ERROR_ID)
+ */
+id_list_t * pop_front_revoked_id(id_list_t *list, id_t *id)
+{
+    id_list_t *del;
+
+    if (list)
+    {
+        *(id) = list->id;
+
+        del = list;
+        list = list->next;
+        free(del);
+    }
+    else
+    {
+        *(id) = ERROR_ID;
+    }
+
+    return list;
+}
+
+
+/*
+ *  Pushes the given ID at the beginning of the given ID list
+ *  and returns the updated list
+ */
+id_list_t * push_id(id_list_t *list, id_t id)
+{
+    id_list_t *elem;
+
+
+    if (( elem = (id_list_t*)malloc(sizeof(id_list_t)) ))
+    {
+        elem->id = id;
+        elem->next = list;
+        list = elem;
+    }
+    else
+    {
+        printf("[push_id()] ERROR: Memory allocation was unsuccessful\n");
+    }
+
+    return list;
+}
+
+
+/*
+ *  Returns 'true' (1 but bool_t) if the given ID 'id' is found in
+ *  the ID list, false (0 but bool_t) otherwise
+ */
+bool_t find_revoked_id(id_list_t *list, id_t id)
+{
+    id_list_t *ptr;
+
+
+    ptr = list;
+
+    if (list)
+    {
+        while (ptr && ptr->id != id)
+        {
+            ptr = ptr->next;
+        }
+    }    
+
+    return (ptr && ptr->id == id);
+}
+
+
+/*
+ *  Returns 'true' (1 but bool_t) if the given ID 'id' is found in
+ *  the ID list, false (0 but bool_t) otherwise
+ * 
+ *  (RECURSIVE)
+ */
+bool_t find_revoked_id_R(id_list_t *ptr, id_t id)
+{
+    if (ptr)
+    {
+        if (ptr->id == id)
+        {
+            return true;
+        }
+        else
+        {
+            return find_revoked_id_R(ptr->next, id);
+        }
+    }
+    else
+    {
+        return false;
+    }
+}
+
+
+/*
+ *  In graph theory, vertex contraction is an operation that, given two nodes, 
+ *  combines them and their relative edges into a single node
+ *  
+ *  Given the two node IDs, where first_node_id is the ID of the merge_node (or the 'surviving' node)
+ *  and second_node_id is the ID of the donor_node (or the node that will be deleted), the program
+ *  unlinks any edge between each node (in both directions) and also corrects each edge's beginning
+ *  or destination node ID of each edge that is either going outwards or inwards the donor_node, thus
+ *  relinking each edge to the node merge_node. Finally, the donor_node gets deleted and the vertex
  *  contraction is complete.
  */
-/* 
- *  (1.1) - Only performs the vertex contraction operation
+/* 
+ *  (1.1) - Only performs the vertex contraction operation
+ */
+graph_t * vertex_contraction(graph_t *graph, id_t first_node_id, id_t second_node_id)
+{
+    graph_node_t *merge_node, *donor_node;
+    graph_edge_list_t *ptr, *ptr2, *ptr3;
+    graph_t *ptr4;
+
+
+    merge_node = get_node_from_id(graph, first_node_id);
+    donor_node = get_node_from_id(graph, second_node_id);
+
+    if (merge_node && donor_node)
+    {
+        /* If it exists, remove any edges pointing from the merge_node to the donor_node */
+        ptr = merge_node->edges;
+
+        while (ptr)
+        {
+            if (ptr->edge.endpoint_ids[1] == second_node_id)
+            {
+                delete_edge_from_node(graph, first_node_id, ptr->edge.id);
+            }
+
+            ptr = ptr->next;
+        }
+
+        /* If it exists, remove any edges pointing from the donor_node to the merge_node */
+        ptr = donor_node->edges;
+        
+        while (ptr)
+        {
+            if (ptr->edge.endpoint_ids[1] == first_node_id)
+            {
+                delete_edge_from_node(graph, second_node_id, ptr->edge.id);
+            }
+
+            ptr = ptr->next;
+        }
+        
+        /*
+        *  For each edge that points OUTWARDS from the donor_node, append
+        *  it to the merge_node and then change each new edge's beginning node ID 
+        *  to the merge_node's node ID
+        */
+        ptr = donor_node->edges;
+        ptr2 = merge_node->edges;
+
+        while (ptr)
+        {
+            ptr2 = append_edge(ptr2, ptr->edge);
+            ptr = ptr->next;
+        }
+
+        while (ptr2)
+        {
+            if (ptr2->edge.endpoint_ids[0] != first_node_id)
+            {
+                if (ptr2->edge.endpoint_ids[0] == ptr2->edge.endpoint_ids[1])
+                {
+                    ptr2->edge.endpoint_ids[1] = first_node_id;
+                }
+
+                ptr2->edge.endpoint_ids[0] = first_node_id;
+            }
+
+            ptr2 = ptr2->next;
+        }
+
+        /*
+        *  For each node in the graph that has an INWARD edge pointing to the 
+        *  donor_node, change its edge destination node ID to the merge_node's node ID
+        * 
+        *  NOTE:   This is the most processing-intensive part of the operation, since
+        *          due to the assumption that a graph can be either directed or undirected, 
+        *          it's mandatory to check for all edges for each node in the graph.
+        */
+        ptr4 = graph;
+
+        while (ptr4)
+        {
+            if (ptr4->node.id != second_node_id)
+            {
+                ptr3 = ptr4->node.edges;
+
+                while (ptr3)
+                {
+                    if (ptr3->edge.endpoint_ids[1] == second_node_id)
+                    {
+                        ptr3->edge.endpoint_ids[1] = first_node_id;
+                    }
+
+                    ptr3 = ptr3->next;
+                }
+
+                /* Resetting the head of the edges list */
+                ptr3 = ptr4->node.edges;
+            }
+
+            ptr4 = ptr4->next;
+        }
+
+        /* Finally, delete the donor_node and complete the merge */
+        graph = delete_node(graph, second_node_id);
+    }
+    else
+    {
+        printf("[vertex_contraction()] ERROR: The given node IDs are of non-existing nodes\n");
+    }
+
+    return graph;
+}
+
+
+/* 
+ *  (1.2) - Performs the vertex contraction operation on an user input provided at runtime
+ */
+graph_t * vertex_contraction_input(graph_t *graph)
+{
+    id_t nid1, nid2;
+
+
+    nid1 = select_node_id(graph, 
+        "\nAvailable node IDs (NIDs):\n",
+        "Select first node ID: "
+    );
+
+    nid2 = select_node_id(graph, 
+        "\nAvailable node IDs (NIDs):\n",
+        "Select second node ID: "
+    );
+
+    return vertex_contraction(graph, nid1, nid2);
+}
+
+
+/*
+ *  In the mathematical field of graph theory, the complement or inverse of 
+ *  a graph G is a graph H on the same vertices such that two distinct vertices 
+ *  of H are adjacent if and only if they are not adjacent in G. 
+ * 
+ *  That is, to generate the complement of a graph, one fills in all the missing 
+ *  edges required to form a complete graph, and removes all the edges that were 
+ *  previously there.
+ * 
+ *  The complement is not the set complement of the graph; only the edges are complemented.
+ */
+graph_t * complement_graph(graph_t *graph)
+{
+    graph_t *ptr, *ptr2;
+    graph_edge_list_t *template, *edges, *template_ptr;
+    id_t endpoints[2];
+
+
+    ptr = graph;
+
+    while (ptr)
+    {
+        /* 
+         *  Creating the template of all possible edges for each node by
+         *  iterating for all possible destinations reachable by a single node
+         *  which corresponds to all the nodes in the graph, including itself
+         */
+        template = NULL;
+        ptr2 = graph;
+        endpoints[0] = ptr->node.id;
+
+        while (ptr2)
+        {   
+            endpoints[1] = ptr2->node.id;
+
+            template = append_edge(
+                template,
+                create_new_edge(
+                    COMPLEMENTED_EDGE_DEFAULT_WEIGHT,
+                    COMPLEMENTED_EDGE_DEFAULT_LABEL,
+                    endpoints
+                )
+            );
+            
+            ptr2 = ptr2->next;
+        }
+
+        /* 
+         *  Iterating through all the old edges so that they are removed 
+         *  from the template, thus leaving only the complementary edges list 
+         *  that contains all the node's possible destinations except the old ones
+         */
+        edges = ptr->node.edges;
+
+        while (edges)
+        {
+            template_ptr = template;
+
+            while (template_ptr)
+            {
+                if (
+                    edges->edge.endpoint_ids[0] == template_ptr->edge.endpoint_ids[0]
+                    && edges->edge.endpoint_ids[1] == template_ptr->edge.endpoint_ids[1]
+                )
+                {
+                    template = delete_edge(template, template_ptr->edge.id);
+                }
+
+                template_ptr = template_ptr->next;
+            }
+
+            edges = edges->next;
+        }
+
+        /* 
+         *  Now that the template contains only the complementary edges, substitute 
+         *  the pointer reference of the node's edges to the template
+         */
+        ptr->node.edges = delete_edge_list(ptr->node.edges);
+        ptr->node.edges = template;
+
+        ptr = ptr->next;
+    }
+
+    return graph;
+}
+
+
+/*
+ *  Given a graph and a source node, the function returns the Minimum Spanning Tree
+ *  (MST) from the given source node, calculated using Dijkstra's Algorithm 
+ * 
+ *  NOTE:
+ *   - The results are written inside the nodes (dist, prev_eid, prev_nid) and edges (is_in_mst)
+ *     of the graph, so two searches can't run on the same graph at the same time. Use 
+ *     dijkstra_sssp() on a compact view for concurrent queries
+ */
+/* 
+ *  (1.1) - Returns the MST from the given source node 
+ */
+graph_t * dijkstra_mst(graph_t *graph, id_t src_id)
+{
+    graph_t *mst, *src, *ptr;
+    graph_node_t *curr, *ptr2;
+    graph_edge_t *mst_edge;
+    graph_edge_list_t *edges;
+    bool_t found_neg_w, initialized;
+    int min_dist, dim, i;
+
+
+    mst = NULL;
+
+    if (graph && (src = find_node(graph, src_id)))
+    {
+        found_neg_w = false;
+        ptr = graph;
+
+        while (ptr && !found_neg_w)
+        {
+            edges = ptr->node.edges;
+
+            while (edges && !found_neg_w)
+            {
+                if (edges->edge.weight < 0)
+                {
+                    found_neg_w = true;
+                }
+
+                edges = edges->next;
+            }
+
+            ptr = ptr->next;
+        }
+
+        if ( !found_neg_w )
+        {
+            /* Initialization */
+            ptr = graph;
+
+            while (ptr)
+            {
+                ptr->node.dist = -1;
+                ptr->node.prev_eid = ERROR_ID;
+                ptr->node.prev_nid = ERROR_ID;
+
+                ptr = ptr->next;
+            }
+
+            src->node.dist = 0;
+
+            /* Beginning of algorithm */
+            /* Debug */
+            #ifdef ENABLE_DIJKSTRA_DEBUG
+                printf("\n<<< [DEBUG LOG START] >>>\n");
+            #endif
+
+            curr = &(src->node);
+            dim = graph_dim(graph);
+            i = 0;
+
+            while (i < dim)
+            {
+                /* Debug */
+                #ifdef ENABLE_DIJKSTRA_DEBUG
+                    printf("\nPREV_MST_NODE_ADDED: %s\n", curr->label);
+                #endif
+
+                mst = append_node(mst, *(curr));
+                ptr = mst;
+                initialized = false;
+
+                while (ptr)
+                {
+                    /* Debug */
+                    #ifdef ENABLE_DIJKSTRA_DEBUG
+                        printf("\t(MST)   NODE: %s | DIST: %lu\n", 
+                            ptr->node.label, 
+                            ptr->node.dist
+                        );
+                    #endif
+                    
+                    edges = ptr->node.edges;
+
+                    while (edges)
+                    {
+                        if (find_node(mst, edges->edge.endpoint_ids[1]) == NULL)
+                        {
+                            ptr2 = get_node_from_id(graph, edges->edge.endpoint_ids[1]);
+
+                            if (ptr2->dist > ptr->node.dist + edges->edge.weight)
+                            {
+                                /* Debug */
+                                #ifdef ENABLE_DIJKSTRA_DEBUG
+                                    printf("\t ==> DIST OF NODE [%s] CHANGED: %lu --> ",
+                                        ptr2->label,
+                                        ptr2->dist
+                                    );
+                                #endif
+
+                                ptr2->dist = ptr->node.dist + edges->edge.weight;
+                                ptr2->prev_eid = edges->edge.id;
+                                ptr2->prev_nid = ptr->node.id;
+                                
+                                /* Debug */
+                                #ifdef ENABLE_DIJKSTRA_DEBUG
+                                    printf("%lu\n", ptr2->dist);
+                                #endif
+                            }
+
+                            if ( !initialized )
+                            {
+                                min_dist = ptr2->dist;
+                                if (ptr2->prev_eid != ERROR_ID && ptr2->prev_nid != ERROR_ID)
+                                {
+                                    mst_edge = &((find_edge((find_node(mst, ptr2->prev_nid))->node.edges, ptr2->prev_eid))->edge);    
+                                }
+
+                                initialized = true;
+
+                                /* Debug */
+                                #ifdef ENABLE_DIJKSTRA_DEBUG
+                                    printf("\t ==> (INIT) mst_edge: [%s] --(%s)--> [%s]\n",
+                                        (get_node_from_id(graph, mst_edge->endpoint_ids[0]))->label,
+                                        mst_edge->label,
+                                        (get_node_from_id(graph, mst_edge->endpoint_ids[1]))->label
+                                    );
+                                #endif
+                            }
+
+                            #ifdef ENABLE_DIJKSTRA_DEBUG
+                                printf("\t(ITER)  [%s] (d=%lu) --(%s, w=%d)--> [%s] (d=%lu)\n", 
+                                    ptr->node.label,
+                                    ptr->node.dist,
+                                    edges->edge.label,
+                                    edges->edge.weight,
+                                    ptr2->label,
+                                    ptr2->dist
+                                );
+                            #endif
+
+                            if (ptr2->dist < min_dist)
+                            {
+                                min_dist = ptr2->dist;
+                                mst_edge = &(edges->edge);
+                                ptr2->prev_eid = mst_edge->id;
+                                ptr2->prev_nid = mst_edge->endpoint_ids[0];
+                                
+                                /* Debug */
+                                #ifdef ENABLE_DIJKSTRA_DEBUG
+                                    printf("\t ==> (FOUND)  mst_edge: [%s] --(%s)--> [%s]\n",
+                                        (get_node_from_id(graph, mst_edge->endpoint_ids[0]))->label,
+                                        mst_edge->label,
+                                        (get_node_from_id(graph, mst_edge->endpoint_ids[1]))->label
+                                    );
+                                #endif
+                            }
+                        }
+
+                        edges = edges->next;
+                    }
+
+                    ptr = ptr->next;
+                }
+
+                /* Debug */
+                #ifdef ENABLE_DIJKSTRA_DEBUG
+                    printf("\n\t[+] mst_edge: [%s] --(%s)--> [%s]\n\n",
+                        (get_node_from_id(graph, mst_edge->endpoint_ids[0]))->label,
+                        mst_edge->label,
+                        (get_node_from_id(graph, mst_edge->endpoint_ids[1]))->label
+                    );
+                #endif
+
+                mst_edge->is_in_mst = true;
+
+                curr = get_node_from_id(graph, mst_edge->endpoint_ids[1]);
+                i++;
+            }
+
+            /* Debug */
+            #ifdef ENABLE_DIJKSTRA_DEBUG
+                printf("\n<<< [DEBUG LOG END] >>>\n");
+            #endif
+        }
+        else
+        {
+            printf("[dijkstra_mst()] ERROR: Dijkstra's Algorithm can only be applied on graphs with positive edge weights\n");
+        }
+    }
+
+    return graph;
+}
+
+/*
+ *  (1.2) - Returns the MST from the source node selected by the user
+ */
+graph_t * dijkstra_mst_input(graph_t *graph)
+{
+    id_t src_nid;
+
+
+    if (graph)
+    {
+        printf("\n[CURRENT OPERATION]\n - Calculating the Minimum Spanning Tree (MST) using Dijkstra's Algorithm\n");
+        
+        printf("\nAvailable node IDs (NIDs):\n");
+        print_all_node_ids(graph);
+
+        do
+        {
+            src_nid = *((id_t*)safe_input(U_INT, STRING_BUFFER_SIZE, "Insert source node ID: "));
+        } 
+        while (find_node(graph, src_nid) == NULL);
+
+        return dijkstra_mst(graph, src_nid);
+    }
+
+    return NULL;
+}
+
+
+/*
+ *  In graph theory, a branch of mathematics, the disjoint union of graphs is an operation 
+ *  that combines two or more graphs to form a larger graph. It is analogous to the disjoint 
+ *  union of sets, and is constructed by making the vertex set of the result be the disjoint
+ *  union of the vertex sets of the given graphs, and by making the edge set of the result be 
+ *  the disjoint union of the edge sets of the given graphs. Any disjoint union of two or more 
+ *  nonempty graphs is necessarily disconnected.
+ */
+graph_t * disjoint_graph_union(graph_t *graph1, graph_t *graph2)
+{
+    graph_t *union_graph;
+
+
+    union_graph = NULL;
+
+    while (graph1)
+    {
+        union_graph = append_node(union_graph, graph1->node);
+        graph1 = graph1->next;
+    }
+
+    while (graph2)
+    {
+        union_graph = append_node(union_graph, graph2->node);
+        graph2 = graph2->next;
+    }
+
+    return union_graph;
+}
+
+
+/*
+ *  In graph theory, the Cartesian product G □ H of graphs G and H is a graph such that:
+ *
+ *      - the vertex set of G □ H is the Cartesian product V(G) × V(H); and
+ *      - two vertices (u,v) and (u' ,v' ) are adjacent in G □ H if and only if either
+ *      - u = u' and v is adjacent to v' in H, or
+ *      - v = v' and u is adjacent to u' in G.
+ * 
+ *  The Cartesian product of graphs is sometimes called the box product of graphs [Harary 1969].
+ */
+graph_t * cartesian_graph_product(graph_t *graph1, graph_t *graph2)
+{
+    graph_t *cartesian, *copy, *ptr;
+    graph_t **layers;
+    graph_edge_list_t *ptr2;
+    id_t endpoints[2];
+    id_t *node_ids;
+    int i, j, k, dim1, dim2;
+    bool_t found;
+
+
+    cartesian = NULL;
+
+    if (graph1 && graph2)
+    {
+        dim1 = graph_dim(graph1);
+        dim2 = graph_dim(graph2);
+
+        if (
+            ( layers = (graph_t**)malloc(sizeof(graph_t*) * dim1) )
+            && ( node_ids = (id_t*)malloc(sizeof(id_t) * dim1) )
+        )
+        {
+            i = 0;
+
+            while (i < dim1)
+            {
+                copy = create_graph_copy(graph2);
+                *(layers + i) = copy;
+                ptr = copy;
+
+                while (ptr)
+                {
+                    cartesian = append_node(cartesian, ptr->node);
+                    ptr = ptr->next;
+                }
+                
+                i++;
+            }
+
+            i = 0;
+
+            while (i < dim2)
+            {
+                ptr = graph1;
+                j = 0;
+                
+                while (ptr && j < dim1)
+                {
+                    *(node_ids + j) = ptr->node.id;
+                    ptr = ptr->next;
+                    j++;
+                }
+
+                ptr = graph1;
+                j = 0;
+
+                while (ptr && j < dim1)
+                {
+                    endpoints[0] = (*(layers + j))->node.id;
+                    ptr2 = ptr->node.edges;
+
+                    while (ptr2)
+                    {
+                        found = false;
+                        k = 0;
+
+                        while (k < dim1 && !found)
+                        {
+                            if (node_ids[k] == ptr2->edge.endpoint_ids[1])
+                            {
+                                found = true;
+                            }
+                            else
+                            {
+                                k++;
+                            }
+                        }
+
+                        if (found)
+                        {
+                            endpoints[1] = (*(layers + k))->node.id;
+
+                            (*(layers + j))->node.edges = append_edge(
+                                (*(layers + j))->node.edges,
+                                create_new_edge(
+                                    DEFAULT_WEIGHT_CARTESIAN_PRODUCT,
+                                    DEFAULT_LABEL_CARTESIAN_PRODUCT,
+                                    endpoints
+                                )
+                            );
+                        }
+
+                        ptr2 = ptr2->next;
+                    }                    
+
+                    ptr = ptr->next;
+                    j++;
+                }
+
+                j = 0;
+
+                while (j < dim1)
+                {
+                    *(layers + j) = (*(layers + j))->next;
+                    j++;
+                }
+
+                i++;
+            }
+        }
+        else
+        {
+            printf("[cartesian_graph_product()] ERROR: Memory allocation was unsuccessful\n");
+        }        
+    }
+
+    return cartesian;
+}
+
+
+/*
+ *  A two-terminal graph (TTG) is a graph with two distinguished vertices, s and t called source 
+ *  and sink, respectively.
+ *  
+ *  (1) - The parallel composition Pc = Pc(X,Y) of two TTGs X and Y is a TTG created from the disjoint union 
+ *        of graphs X and Y by merging the sources of X and Y to create the source of Pc and merging the 
+ *        sinks of X and Y to create the sink of Pc.
+ * 
+ *  (2) - The series composition Sc = Sc(X,Y) of two TTGs X and Y is a TTG created from the disjoint union of 
+ *        graphs X and Y by merging the sink of X with the source of Y. The source of X becomes the source 
+ *        of Sc and the sink of Y becomes the sink of Sc.
+ * 
+ *  A two-terminal series–parallel graph (TTSPG) is a graph that may be constructed by a sequence 
+ *  of series and parallel compositions starting from a set of copies of a single-edge graph K2 
+ *  with assigned terminals.
+ * 
+ *  Finally, a graph is called series–parallel (SP-graph), if it is a TTSPG when some two 
+ *  of its vertices are regarded as source and sink.
+ */
+/* 
+ *  (1.1) - Only performs the parallel composition operation
+ */
+graph_t * parallel_graph_composition(graph_t *graph1, graph_t *graph2, id_t source_1, id_t sink_1, id_t source_2, id_t sink_2)
+{
+    graph_t *union_graph;
+
+
+    union_graph = NULL;
+
+    if (
+        find_node(graph1, source_1) != NULL
+        && find_node(graph1, sink_1) != NULL
+        && find_node(graph2, source_2) != NULL
+        && find_node(graph2, sink_2) != NULL
+    )
+    {
+        /* 
+         *  (PARALLEL COMPOSITION)
+         *  After selecting the source and sink node for both graphs, proceed
+         *  to perform a vertex contraction between the two source nodes and
+         *  also between the two sink nodes
+         */
+        union_graph = disjoint_graph_union(graph1, graph2);
+        union_graph = vertex_contraction(union_graph, source_1, source_2);
+        union_graph = vertex_contraction(union_graph, sink_1, sink_2);
+    }
+    else
+    {
+        printf("[parallel_graph_composition()] ERROR: Some of the given IDs don't belong to any of the nodes in either graph\n");
+    }
+    
+    return union_graph;
+}
+
+/* 
+ *  (1.2) - Gets the source and sink IDs for both graphs and then performs 
+ *          the parallel composition operation 
+ */
+graph_t * parallel_graph_composition_input(graph_t *graph1, graph_t *graph2)
+{
+    id_t source_ids[2], sink_ids[2];
+
+
+    if (graph1 && graph2)
+    {
+        printf("\n[CURRENT OPERATION]\n - Parallel Graph Composition\n");
+
+        /* Source and sink IDs for graph 1 */ 
+        source_ids[0] = select_node_id(graph1, 
+            "\nAvailable node IDs (NIDs) from the first graph:\n", 
+            "Insert the source ID from the first graph: "
+        );
+        sink_ids[0] = select_node_id(graph1, 
+            "\nAvailable node IDs (NIDs) from the first graph:\n", 
+            "Insert the sink ID from the first graph: "
+        );
+
+        /* Source and sink IDs for graph2 */ 
+        source_ids[1] = select_node_id(graph2, 
+            "\nAvailable node IDs (NIDs) from the second graph:\n", 
+            "Insert the source ID from the second graph: "
+        );
+        sink_ids[1] = select_node_id(graph2, 
+            "\nAvailable node IDs (NIDs) from the second graph:\n", 
+            "Insert the sink ID from the second graph: "
+        );
+
+        return parallel_graph_composition(graph1, graph2, source_ids[0], sink_ids[0], source_ids[1], sink_ids[1]);
+    }
+
+    return NULL;
+}
+
+
+/* 
+ *  (2.1) - Only performs the series composition operation
+ */
+graph_t * series_graph_composition(graph_t *graph1, graph_t *graph2, id_t source_id, id_t sink_id)
+{
+    graph_t *union_graph;
+    graph_node_t *left_node, *right_node;
+    id_t endpoints[2];
+
+
+    union_graph = NULL;
+
+    /* 
+     *  (SERIES COMPOSITION)
+     *  After selecting the source and sink node for both graphs, proceed
+     *  to add an edge (both ways) between the sink_node of the first
+     *  graph and the source_node of the second graph
+     */
+    left_node = get_node_from_id(graph1, source_id);
+    right_node = get_node_from_id(graph2, sink_id);
+
+    if (left_node && right_node)
+    {
+        union_graph = disjoint_graph_union(graph1, graph2);
+
+        /* left_node --[edge]--> right_node */
+        endpoints[0] = left_node->id;
+        endpoints[1] = right_node->id;
+
+        left_node->edges = append_edge(
+            left_node->edges, 
+            create_new_edge(
+                SERIES_EDGE_DEFAULT_WEIGHT,
+                SERIES_EDGE_DEFAULT_LABEL,
+                endpoints
+            )
+        );
+
+        /* right_node --[edge]--> left_node */
+        endpoints[0] = right_node->id;
+        endpoints[1] = left_node->id;
+
+        right_node->edges = append_edge(
+            right_node->edges, 
+            create_new_edge(
+                SERIES_EDGE_DEFAULT_WEIGHT,
+                SERIES_EDGE_DEFAULT_LABEL,
+                endpoints
+            )
+        );
+    }
+    else
+    {
+        printf("[series_graph_composition()] ERROR: One or both of the given IDs don't belong to any of the nodes in either graph\n");
+    }
+    
+    return union_graph;
+}
+
+/*
+ *  (2.2) - Gets both the source ID from the first graph and sink ID from the second, then 
+ *          the series composition operation 
+ */
+graph_t * series_graph_composition_input(graph_t *graph1, graph_t *graph2)
+{
+    id_t source_id, sink_id;
+
+
+    if (graph1 && graph2)
+    {
+        printf("\n[CURRENT OPERATION]\n - Series Graph Composition\n");
+
+        /* Source ID of graph1 */
+        source_id = select_node_id(graph1, 
+            "\nAvailable node IDs (NIDs) from the first graph:\n",
+            "Insert the source ID from the first graph: "
+        );
+
+        /* Sink ID of graph2 */
+        sink_id = select_node_id(graph2, 
+            "\nAvailable node IDs (NIDs) from the second graph:\n",
+            "Insert the sink ID from the second graph: "
+        );
+
+        return series_graph_composition(graph1, graph2, source_id, sink_id);
+    }
+
+    return NULL;
+}
+
+
+/*
+ *  Helper function of the graph generators that adds in front of the given graph list the 
+ *  nodes with indices 'first' .. 'last', each labeled with its index, and stores them in 
+ *  'nodes'. They are pushed starting from the last one, so that the list is sorted by label
+ */
+static graph_t * push_generated_nodes(graph_t *graph, graph_t **nodes, int first, int last)
+{
+    int i;
+
+
+    for (i = last; i >= first; i--)
+    {
+        graph = graph ? push_node(graph, create_new_node(int_to_string(i))) : append_node(graph, create_new_node(int_to_string(i)));
+        nodes[i] = graph;
+    }
+
+    return graph;
+}
+
+
+/*
+ *  Creates a random graph with the R-MAT model, which reproduces the skewed degree distribution
+ *  and the small diameter of real networks (social graphs, web graphs): the graph has 2^scale
+ *  nodes and (edge_factor * 2^scale) edges, and each edge is placed by recursively choosing one
+ *  of the four quadrants of the adjacency matrix with probabilities RMAT_A, RMAT_B, RMAT_C and
+ *  (1 - RMAT_A - RMAT_B - RMAT_C). The weights are uniformly distributed in [1, max_weight].
+ *  The same seed always gives the same graph.
+ * 
+ *  Returns the R-MAT graph, NULL on error (e.g. if the amount of edges doesn't fit an int)
+ */
+graph_t * create_rmat_graph(int scale, int edge_factor, int max_weight, unsigned int seed)
+{
+    graph_t *graph, **nodes;
+    graph_edge_t edge;
+    id_t endpoints[2];
+    int n, m, i, level, src, dest;
+    double r;
+
+
+    graph = NULL;
+
+    if (scale < 0 || scale > RMAT_MAX_SCALE || edge_factor < 0 || max_weight < 1)
+    {
+        printf("[create_rmat_graph()] ERROR: Invalid parameters\n");
+    }
+    else if (edge_factor > (INT_MAX >> scale))
+    {
+        printf("[create_rmat_graph()] ERROR: Too many edges (edge_factor * 2^scale must be at most %d)\n", INT_MAX);
+    }
+    else if (( nodes = (graph_t**)malloc(sizeof(graph_t*) * (1 << scale)) ))
+    {
+        n = 1 << scale;
+        m = edge_factor * n;
+        srand(seed);
+
+        graph = push_generated_nodes(graph, nodes, 0, n - 1);
+
+        for (i = 0; i < m; i++)
+        {
+            src = 0;
+            dest = 0;
+
+            for (level = 0; level < scale; level++)
+            {
+                r = (double)rand() / ((double)RAND_MAX + 1);
+                src = 2 * src + (r >= RMAT_A + RMAT_B);
+                dest = 2 * dest + ((r >= RMAT_A && r < RMAT_A + RMAT_B) || r >= RMAT_A + RMAT_B + RMAT_C);
+            }
+
+            endpoints[0] = nodes[src]->node.id;
+            endpoints[1] = nodes[dest]->node.id;
+            edge = create_new_edge(1 + rand() % max_weight, RMAT_EDGE_DEFAULT_LABEL, endpoints);
+            edge.is_in_mst = false;
+
+            nodes[src]->node.edges = nodes[src]->node.edges ? push_edge(nodes[src]->node.edges, edge) : append_edge(NULL, edge);
+        }
+
+        free(nodes);
+    }
+    else
+    {
+        printf("[create_rmat_graph()] ERROR: Memory allocation was unsuccessful\n");
+    }
+
+    return graph;
+}
+
+
+/*
+ *  Helper function of the graph generators that adds to the node stored in 'src' 
+ *  a new edge towards the node stored in 'dest', with the given weight and label
+ */
+static void link_generated_nodes(graph_t *src, graph_t *dest, int weight, char *label)
+{
+    graph_edge_t edge;
+    id_t endpoints[2];
+
+
+    endpoints[0] = src->node.id;
+    endpoints[1] = dest->node.id;
+    edge = create_new_edge(weight, label, endpoints);
+    edge.is_in_mst = false;
+
+    src->node.edges = src->node.edges ? push_edge(src->node.edges, edge) : append_edge(NULL, edge);
+}
+
+
+/*
+ *  Creates a random layered graph, which is the typical benchmark of the maximum flow
+ *  algorithms: a source node, 'layers' layers of 'width' nodes each and a sink node, in
+ *  this order. The source is linked to every node of the first layer, every node of the 
+ *  last layer is linked to the sink, and every other node to 'degree' random nodes of 
+ *  the next layer. The weights (capacities) are random between 1 and 'max_capacity'
+ * 
+ *  Returns the layered graph, NULL on error
+ */
+graph_t * create_layered_graph(int layers, int width, int degree, int max_capacity, unsigned int seed)
+{
+    graph_t *graph, **nodes;
+    int n, i, j, u;
+
+
+    graph = NULL;
+
+    if (layers < 1 || width < 1 || degree < 0 || max_capacity < 1)
+    {
+        printf("[create_layered_graph()] ERROR: Invalid parameters\n");
+    }
+    else if (( nodes = (graph_t**)malloc(sizeof(graph_t*) * (layers * width + 2)) ))
+    {
+        n = layers * width + 2;
+        srand(seed);
+
+        /* The nodes are pushed starting from the sink, so that the source is the first one */
+        graph = append_node(graph, create_new_node(LAYERED_SINK_LABEL));
+        nodes[n - 1] = graph;
+
+        graph = push_generated_nodes(graph, nodes, 1, n - 2);
+
+        graph = push_node(graph, create_new_node(LAYERED_SOURCE_LABEL));
+        nodes[0] = graph;
+
+        for (j = 0; j < width; j++)
+        {
+            link_generated_nodes(nodes[0], nodes[1 + j], 1 + rand() % max_capacity, LAYERED_EDGE_DEFAULT_LABEL);
+        }
+
+        /* The node with index u belongs to the layer (u - 1) / width */
+        for (u = 1; u < n - 1; u++)
+        {
+            if ((u - 1) / width == layers - 1)
+            {
+                link_generated_nodes(nodes[u], nodes[n - 1], 1 + rand() % max_capacity, LAYERED_EDGE_DEFAULT_LABEL);
+            }
+            else
+            {
+                for (j = 0; j < degree; j++)
+                {
+                    i = 1 + ((u - 1) / width + 1) * width + rand() % width;
+                    link_generated_nodes(nodes[u], nodes[i], 1 + rand() % max_capacity, LAYERED_EDGE_DEFAULT_LABEL);
+                }
+            }
+        }
+
+        free(nodes);
+    }
+    else
+    {
+        printf("[create_layered_graph()] ERROR: Memory allocation was unsuccessful\n");
+    }
+
+    return graph;
+}
+
+
+/*
+ *  Creates a random bipartite graph with 'left' nodes on one side, followed by 'right' nodes
+ *  on the other one, and 'edge_count' edges from a random node of the first side to a random
+ *  node of the second one, with weights between 1 and 'max_weight' (useful to test the
+ *  matching algorithms, as a job assignment with random costs)
+ * 
+ *  Returns the bipartite graph, NULL on error
+ */
+graph_t * create_bipartite_graph(int left, int right, int edge_count, int max_weight, unsigned int seed)
+{
+    graph_t *graph, **nodes;
+    int i;
+
+
+    graph = NULL;
+
+    if (left < 1 || right < 1 || edge_count < 0 || max_weight < 1)
+    {
+        printf("[create_bipartite_graph()] ERROR: Invalid parameters\n");
+    }
+    else if (( nodes = (graph_t**)malloc(sizeof(graph_t*) * (left + right)) ))
+    {
+        srand(seed);
+
+        graph = push_generated_nodes(graph, nodes, 0, left + right - 1);
+
+        for (i = 0; i < edge_count; i++)
+        {
+            link_generated_nodes(
+                nodes[((unsigned long int)rand() * ((unsigned long int)RAND_MAX + 1) + rand()) % left], 
+                nodes[left + ((unsigned long int)rand() * ((unsigned long int)RAND_MAX + 1) + rand()) % right], 
+                1 + rand() % max_weight, 
+                BIPARTITE_EDGE_DEFAULT_LABEL
+            );
+        }
+
+        free(nodes);
+    }
+    else
+    {
+        printf("[create_bipartite_graph()] ERROR: Memory allocation was unsuccessful\n");
+    }
+
+    return graph;
+}
+
+
+/*
+ *  Creates a random two-terminal series-parallel graph with 'edge_count' edges, directed from
+ *  the source (the first node) to the sink (the second node), with weights between 1 and 
+ *  'max_weight'. Starting from a single edge, a random edge u -> w is repeatedly either
+ *  split by a new node x into u -> x -> w (series), or joined by a new path u -> x -> w 
+ *  (parallel), so the result is always recognized by series_parallel_decomposition()
+ * 
+ *  Returns the series-parallel graph, NULL on error
+ */
+graph_t * create_series_parallel_graph(int edge_count, int max_weight, unsigned int seed)
+{
+    graph_t *graph, **nodes;
+    int *ends;
+    int n, m, e;
+
+
+    graph = NULL;
+    nodes = NULL;
+    ends = NULL;
+
+    if (edge_count < 1 || max_weight < 1)
+    {
+        printf("[create_series_parallel_graph()] ERROR: Invalid parameters\n");
+    }
+    else if (
+        ( ends = (int*)malloc(sizeof(int) * 2 * edge_count) )
+        && ( nodes = (graph_t**)malloc(sizeof(graph_t*) * (edge_count + 1)) )
+    )
+    {
+        srand(seed);
+        ends[0] = 0;
+        ends[1] = 1;
+        n = 2;
+        m = 1;
+
+        /* Every step adds one node and one (series) or two (parallel) edges */
+        while (m < edge_count)
+        {
+            e = ((unsigned long int)rand() * ((unsigned long int)RAND_MAX + 1) + rand()) % m;
+
+            if (m + 2 <= edge_count && rand() % 2)
+            {
+                ends[2 * m] = ends[2 * e];
+                ends[2 * m + 1] = n;
+                ends[2 * m + 2] = n;
+                ends[2 * m + 3] = ends[2 * e + 1];
+                m += 2;
+            }
+            else
+            {
+                ends[2 * m] = n;
+                ends[2 * m + 1] = ends[2 * e + 1];
+                ends[2 * e + 1] = n;
+                m++;
+            }
+
+            n++;
+        }
+
+        graph = push_generated_nodes(graph, nodes, 0, n - 1);
+
+        for (e = 0; e < m; e++)
+        {
+            link_generated_nodes(nodes[ends[2 * e]], nodes[ends[2 * e + 1]], 1 + rand() % max_weight, SERIES_PARALLEL_EDGE_DEFAULT_LABEL);
+        }
+    }
+    else
+    {
+        printf("[create_series_parallel_graph()] ERROR: Memory allocation was unsuccessful\n");
+    }
+
+    free(ends);
+    free(nodes);
+
+    return graph;
+}
+
+
+/*
+ *  Given a graph, it creates its compact view in the Compressed Sparse Row (CSR) format:
+ *  each node gets a dense index, following the order of the graph list, and all the outward
+ *  edges are stored contiguously in arrays indexed by edge index. Edges whose destination 
+ *  doesn't belong to the graph are left out of the view.
+ * 
+ *  NOTE:
+ *   - The view holds pointers to the nodes and edges of the graph, so it must be
+ *     recreated after the graph gets modified
+ */
+graph_csr_t * create_graph_csr(graph_t *graph)
+{
+    graph_csr_t *csr;
+    graph_t *ptr;
+    graph_edge_list_t *edges;
+    id_t max_id;
+    int i, e, dim, edge_dim;
+
+
+    csr = NULL;
+
+    if (graph)
+    {
+        dim = 0;
+        edge_dim = 0;
+        max_id = ERROR_ID;
+
+        for (ptr = graph; ptr != NULL; ptr = ptr->next)
+        {
+            if (ptr->node.id > max_id)
+            {
+                max_id = ptr->node.id;
+            }
+
+            edge_dim += edge_list_dim(ptr->node.edges);
+            dim++;
+        }
+
+        if (( csr = (graph_csr_t*)calloc(1, sizeof(graph_csr_t)) ))
+        {
+            csr->node_count = dim;
+            csr->max_node_id = max_id;
+
+            if (
+                ( csr->node_ids = (id_t*)malloc(sizeof(id_t) * dim) )
+                && ( csr->index_of = (int*)malloc(sizeof(int) * (max_id + 1)) )
+                && ( csr->nodes = (graph_node_t**)malloc(sizeof(graph_node_t*) * dim) )
+                && ( csr->offsets = (int*)malloc(sizeof(int) * (dim + 1)) )
+                && ( csr->sources = (int*)malloc(sizeof(int) * (edge_dim + 1)) )
+                && ( csr->targets = (int*)malloc(sizeof(int) * (edge_dim + 1)) )
+                && ( csr->weights = (int*)malloc(sizeof(int) * (edge_dim + 1)) )
+                && ( csr->edges = (graph_edge_t**)malloc(sizeof(graph_edge_t*) * (edge_dim + 1)) )
+            )
+            {
+                for (i = 0; i <= (int)max_id; i++)
+                {
+                    csr->index_of[i] = ERROR_INDEX;
+                }
+
+                i = 0;
+
+                for (ptr = graph; ptr != NULL; ptr = ptr->next)
+                {
+                    csr->node_ids[i] = ptr->node.id;
+                    csr->nodes[i] = &(ptr->node);
+                    csr->index_of[ptr->node.id] = i;
+                    i++;
+                }
+
+                i = 0;
+                e = 0;
+
+                for (ptr = graph; ptr != NULL; ptr = ptr->next)
+                {
+                    csr->offsets[i] = e;
+
+                    for (edges = ptr->node.edges; edges != NULL; edges = edges->next)
+                    {
+                        if (
+                            edges->edge.endpoint_ids[1] <= max_id 
+                            && csr->index_of[edges->edge.endpoint_ids[1]] != ERROR_INDEX
+                        )
+                        {
+                            csr->sources[e] = i;
+                            csr->targets[e] = csr->index_of[edges->edge.endpoint_ids[1]];
+                            csr->weights[e] = edges->edge.weight;
+                            csr->edges[e] = &(edges->edge);
+                            e++;
+                        }
+                    }
+
+                    i++;
+                }
+
+                csr->offsets[dim] = e;
+                csr->edge_count = e;
+                csr->min_weight = 0;
+                csr->max_weight = 0;
+
+                for (e = 0; e < csr->edge_count; e++)
+                {
+                    if (e == 0 || csr->weights[e] < csr->min_weight)
+                    {
+                        csr->min_weight = csr->weights[e];
+                    }
+
+                    if (e == 0 || csr->weights[e] > csr->max_weight)
+                    {
+                        csr->max_weight = csr->weights[e];
+                    }
+                }
+            }
+            else
+            {
+                printf("[create_graph_csr()] ERROR: Memory allocation was unsuccessful\n");
+                csr = delete_graph_csr(csr);
+            }
+        }
+        else
+        {
+            printf("[create_graph_csr()] ERROR: Memory allocation was unsuccessful\n");
+        }
+    }
+
+    return csr;
+}
+
+
+/*
+ *  Given a compact view, it creates the compact view of the transpose graph, where every
+ *  edge is reversed: the edges stored in the row of a node are its INWARD edges, with the
+ *  'targets' array containing their beginning nodes. Node indices are the same of the 
+ *  given view, and the edge pointers still refer to the original edges of the graph
+ */
+graph_csr_t * create_graph_csr_transpose(graph_csr_t *csr)
+{
+    graph_csr_t *transpose;
+    int i, e, pos;
+    int *fill;
+
+
+    transpose = NULL;
+
+    if (csr && ( transpose = (graph_csr_t*)calloc(1, sizeof(graph_csr_t)) ))
+    {
+        transpose->node_count = csr->node_count;
+        transpose->edge_count = csr->edge_count;
+        transpose->max_node_id = csr->max_node_id;
+        transpose->min_weight = csr->min_weight;
+        transpose->max_weight = csr->max_weight;
+        fill = NULL;
+
+        if (
+            ( transpose->node_ids = (id_t*)malloc(sizeof(id_t) * csr->node_count) )
+            && ( transpose->index_of = (int*)malloc(sizeof(int) * (csr->max_node_id + 1)) )
+            && ( transpose->nodes = (graph_node_t**)malloc(sizeof(graph_node_t*) * csr->node_count) )
+            && ( transpose->offsets = (int*)calloc(csr->node_count + 1, sizeof(int)) )
+            && ( transpose->sources = (int*)malloc(sizeof(int) * (csr->edge_count + 1)) )
+            && ( transpose->targets = (int*)malloc(sizeof(int) * (csr->edge_count + 1)) )
+            && ( transpose->weights = (int*)malloc(sizeof(int) * (csr->edge_count + 1)) )
+            && ( transpose->edges = (graph_edge_t**)malloc(sizeof(graph_edge_t*) * (csr->edge_count + 1)) )
+            && ( fill = (int*)malloc(sizeof(int) * (csr->node_count + 1)) )
+        )
+        {
+            memcpy(transpose->node_ids, csr->node_ids, sizeof(id_t) * csr->node_count);
+            memcpy(transpose->index_of, csr->index_of, sizeof(int) * (csr->max_node_id + 1));
+            memcpy(transpose->nodes, csr->nodes, sizeof(graph_node_t*) * csr->node_count);
+
+            /* Counting the inward edges of each node, then turning the counts into offsets */
+            for (e = 0; e < csr->edge_count; e++)
+            {
+                transpose->offsets[csr->targets[e] + 1]++;
+            }
+
+            for (i = 0; i < csr->node_count; i++)
+            {
+                transpose->offsets[i + 1] += transpose->offsets[i];
+                fill[i] = transpose->offsets[i];
+            }
+
+            for (e = 0; e < csr->edge_count; e++)
+            {
+                pos = fill[csr->targets[e]]++;
+
+                transpose->sources[pos] = csr->targets[e];
+                transpose->targets[pos] = csr->sources[e];
+                transpose->weights[pos] = csr->weights[e];
+                transpose->edges[pos] = csr->edges[e];
+            }
+        }
+        else
+        {
+            printf("[create_graph_csr_transpose()] ERROR: Memory allocation was unsuccessful\n");
+            transpose = delete_graph_csr(transpose);
+        }
+
+        free(fill);
+    }
+
+    return transpose;
+}
+
+
+/*
+ *  Deletes the given compact view (the graph it was created from is left untouched)
+ */
+graph_csr_t * delete_graph_csr(graph_csr_t *csr)
+{
+    if (csr)
+    {
+        free(csr->node_ids);
+        free(csr->index_of);
+        free(csr->nodes);
+        free(csr->offsets);
+        free(csr->sources);
+        free(csr->targets);
+        free(csr->weights);
+        free(csr->edges);
+        free(csr);
+    }
+
+    return NULL;
+}
+
+
+/*
+ *  Returns the dense index of the node with ID 'nid' inside the compact view,
+ *  ERROR_INDEX if such node doesn't belong to the view
+ */
+int get_csr_index_from_id(graph_csr_t *csr, id_t nid)
+{
+    if (csr && nid != ERROR_ID && nid <= csr->max_node_id)
+    {
+        return csr->index_of[nid];
+    }
+    else
+    {
+        return ERROR_INDEX;
+    }
+}
+
+
+/*
+ *  Creates a shortest paths workspace able to hold the results of 
+ *  a single-source search on a graph of 'node_count' nodes
+ */
+graph_sssp_t * create_sssp(int node_count)
+{
+    graph_sssp_t *sssp;
+
+
+    sssp = NULL;
+
+    if (node_count > 0)
+    {
+        if (( sssp = (graph_sssp_t*)calloc(1, sizeof(graph_sssp_t)) ))
+        {
+            sssp->node_count = node_count;
+            sssp->src = ERROR_INDEX;
+            sssp->cycle_node = ERROR_INDEX;
+
+            if (
+                !( sssp->stamp = (unsigned int*)calloc(node_count, sizeof(unsigned int)) )
+                || !( sssp->dist = (long int*)malloc(sizeof(long int) * node_count) )
+                || !( sssp->prev_edge = (int*)malloc(sizeof(int) * node_count) )
+                || !( sssp->path_len = (int*)malloc(sizeof(int) * node_count) )
+                || !( sssp->queue = (int*)malloc(sizeof(int) * node_count) )
+                || !( sssp->in_queue = (bool_t*)malloc(sizeof(bool_t) * node_count) )
+                || !( sssp->heap_pos = (int*)malloc(sizeof(int) * node_count) )
+                || !( sssp->heap_key = (long int*)malloc(sizeof(long int) * node_count) )
+            )
+            {
+                printf("[create_sssp()] ERROR: Memory allocation was unsuccessful\n");
+                sssp = delete_sssp(sssp);
+            }
+        }
+        else
+        {
+            printf("[create_sssp()] ERROR: Memory allocation was unsuccessful\n");
+        }
+    }
+
+    return sssp;
+}
+
+
+/*
+ *  Deletes the given shortest paths workspace
+ */
+graph_sssp_t * delete_sssp(graph_sssp_t *sssp)
+{
+    if (sssp)
+    {
+        free(sssp->stamp);
+        free(sssp->dist);
+        free(sssp->prev_edge);
+        free(sssp->path_len);
+        free(sssp->queue);
+        free(sssp->in_queue);
+        free(sssp->heap_pos);
+        free(sssp->heap_key);
+        free(sssp);
+    }
+
+    return NULL;
+}
+
+
+/*
+ *  Helper function that starts a new search on the workspace by increasing its epoch,
+ *  which invalidates the entries of all the nodes in O(1). Only when the epoch counter
+ *  wraps around the stamps need to be cleared
+ */
+static void sssp_begin_search(graph_sssp_t *sssp)
+{
+    sssp->epoch++;
+
+    if (sssp->epoch == 0)
+    {
+        memset(sssp->stamp, 0, sizeof(unsigned int) * sssp->node_count);
+        sssp->epoch = 1;
+    }
+
+    sssp->cycle_node = ERROR_INDEX;
+    sssp->heap_size = 0;
+}
+
+
+/*
+ *  Helper function that initializes the entries of the node with index 'v' the first
+ *  time the current search reaches it
+ */
+static void sssp_reach(graph_sssp_t *sssp, int v)
+{
+    if (sssp->stamp[v] != sssp->epoch)
+    {
+        sssp->stamp[v] = sssp->epoch;
+        sssp->dist[v] = GRAPH_DIST_INF;
+        sssp->prev_edge[v] = ERROR_INDEX;
+        sssp->path_len[v] = 0;
+        sssp->in_queue[v] = false;
+    }
+}
+
+
+/*
+ *  Helper function that returns the distance of the node with index 'v' found by
+ *  the last search of the workspace (GRAPH_DIST_INF if the search didn't reach it)
+ */
+static long int sssp_dist(graph_sssp_t *sssp, int v)
+{
+    return (sssp->stamp[v] == sssp->epoch) ? sssp->dist[v] : GRAPH_DIST_INF;
+}
+
+
+/*
+ *  Helper function that runs the Bellman-Ford (SPFA) search from the node with index 'src'
+ *  (see bellman_ford_sssp()). If 'src' is ERROR_INDEX, the search starts from a virtual node 
+ *  linked to every node with a 0-weight edge, so all the nodes begin at distance 0 and the 
+ *  resulting distances are the potentials used by Johnson's Algorithm
+ */
+static bool_t bellman_ford_search(graph_csr_t *csr, graph_sssp_t *sssp, int src)
+{
+    int n, u, v, e, head, count;
+    long int new_dist;
+    double queue_sum;
+    bool_t found_neg_cycle;
+
+
+    n = csr->node_count;
+
+    /* Initialization (Bellman-Ford may reach every node, so all of them are stamped) */
+    sssp_begin_search(sssp);
+
+    for (u = 0; u < n; u++)
+    {
+        sssp->stamp[u] = sssp->epoch;
+        sssp->dist[u] = (src == ERROR_INDEX) ? 0 : GRAPH_DIST_INF;
+        sssp->prev_edge[u] = ERROR_INDEX;
+        sssp->path_len[u] = 0;
+        sssp->in_queue[u] = (src == ERROR_INDEX);
+        sssp->queue[u] = u;
+    }
+
+    sssp->src = src;
+    head = 0;
+    queue_sum = 0;
+    found_neg_cycle = false;
+
+    if (src == ERROR_INDEX)
+    {
+        count = n;
+    }
+    else
+    {
+        sssp->dist[src] = 0;
+        sssp->queue[0] = src;
+        sssp->in_queue[src] = true;
+        count = 1;
+    }
+
+    /* Beginning of algorithm */
+    while (count > 0 && !found_neg_cycle)
+    {
+        /* (LLL) Moving the front nodes with a large label to the back of the deque */
+        while (count > 1 && sssp->dist[sssp->queue[head]] * (double)count > queue_sum)
+        {
+            sssp->queue[(head + count) % n] = sssp->queue[head];
+            head = (head + 1) % n;
+        }
+
+        u = sssp->queue[head];
+        head = (head + 1) % n;
+        count--;
+        sssp->in_queue[u] = false;
+        queue_sum -= sssp->dist[u];
+
+        for (e = csr->offsets[u]; e < csr->offsets[u + 1] && !found_neg_cycle; e++)
+        {
+            v = csr->targets[e];
+            new_dist = sssp->dist[u] + csr->weights[e];
+
+            if (new_dist < sssp->dist[v])
+            {
+                if (sssp->in_queue[v])
+                {
+                    queue_sum += (double)new_dist - sssp->dist[v];
+                }
+
+                sssp->dist[v] = new_dist;
+                sssp->prev_edge[v] = e;
+                sssp->path_len[v] = sssp->path_len[u] + 1;
+
+                if (sssp->path_len[v] >= n)
+                {
+                    sssp->cycle_node = v;
+                    found_neg_cycle = true;
+                }
+                else if ( !sssp->in_queue[v] )
+                {
+                    /* (SLF) Small labels go to the front of the deque */
+                    if (count > 0 && new_dist < sssp->dist[sssp->queue[head]])
+                    {
+                        head = (head - 1 + n) % n;
+                        sssp->queue[head] = v;
+                    }
+                    else
+                    {
+                        sssp->queue[(head + count) % n] = v;
+                    }
+
+                    sssp->in_queue[v] = true;
+                    queue_sum += new_dist;
+                    count++;
+                }
+            }
+        }
+    }
+
+    return !found_neg_cycle;
+}
+
+
+/*
+ *  Computes the shortest paths from the node with ID 'src_nid' to every other node
+ *  of the compact view, storing distances and predecessor edges in the workspace.
+ *  Unlike dijkstra_mst(), edge weights are allowed to be negative.
+ * 
+ *  The algorithm is the queue-based variant of Bellman-Ford (SPFA), where only the 
+ *  nodes whose distance just decreased get their edges relaxed again, plus two
+ *  heuristics on the node deque:
+ * 
+ *      - Small Label First (SLF): a node is inserted at the front of the deque if its
+ *        distance is smaller than the one of the current front node, at the back otherwise
+ * 
+ *      - Large Label Last (LLL): before extracting the front node, if its distance is 
+ *        greater than the average distance in the deque, it's moved to the back
+ * 
+ *  Each node also keeps the amount of edges of its current path: once a path reaches 
+ *  node_count edges it must contain a repeated node, which can only happen through a 
+ *  negative cycle, so the search stops.
+ * 
+ *  Returns true if the distances are correct, false if a negative cycle is reachable from
+ *  the source (see bellman_ford_negative_cycle()) or if the parameters are invalid
+ */
+bool_t bellman_ford_sssp(graph_csr_t *csr, id_t src_nid, graph_sssp_t *sssp)
+{
+    int src;
+
+
+    src = get_csr_index_from_id(csr, src_nid);
+
+    if (src == ERROR_INDEX || sssp == NULL || sssp->node_count < csr->node_count)
+    {
+        printf("[bellman_ford_sssp()] ERROR: Invalid source node or workspace\n");
+        return false;
+    }
+
+    return bellman_ford_search(csr, sssp, src);
+}
+
+
+/*
+ *  Helper function that follows the predecessor edges backwards from the node
+ *  with index 'start' and returns the index of a node that lies on a cycle of
+ *  predecessors, ERROR_INDEX if the walk reaches a node without predecessor
+ */
+static int find_predecessor_cycle(graph_csr_t *csr, graph_sssp_t *sssp, int start)
+{
+    int u, steps;
+
+
+    u = start;
+    steps = 0;
+
+    while (u != ERROR_INDEX && steps < csr->node_count)
+    {
+        u = (sssp->prev_edge[u] == ERROR_INDEX) ? ERROR_INDEX : csr->sources[sssp->prev_edge[u]];
+        steps++;
+    }
+
+    return u;
+}
+
+
+/*
+ *  After bellman_ford_sssp() has returned false, this function extracts the negative
+ *  cycle that was found, returning the list of its edge IDs (EIDs) in the order they
+ *  are traversed. Returns NULL if the workspace doesn't contain a negative cycle.
+ * 
+ *  After node_count steps backwards along the predecessor edges the walk is inside
+ *  the cycle. If the predecessor edges still don't close a cycle (because they changed 
+ *  after the long path was found), full relaxation rounds over all edges are performed
+ *  until they do, which is the classic Bellman-Ford cycle extraction
+ */
+id_list_t * bellman_ford_negative_cycle(graph_csr_t *csr, graph_sssp_t *sssp)
+{
+    id_list_t *cycle;
+    int u, v, e, round, last_relaxed;
+
+
+    cycle = NULL;
+
+    if (csr && sssp && sssp->cycle_node != ERROR_INDEX)
+    {
+        u = find_predecessor_cycle(csr, sssp, sssp->cycle_node);
+        round = 0;
+
+        while (u == ERROR_INDEX && round < csr->node_count)
+        {
+            last_relaxed = ERROR_INDEX;
+
+            for (e = 0; e < csr->edge_count; e++)
+            {
+                if (
+                    sssp->dist[csr->sources[e]] != GRAPH_DIST_INF
+                    && sssp->dist[csr->sources[e]] + csr->weights[e] < sssp->dist[csr->targets[e]]
+                )
+                {
+                    sssp->dist[csr->targets[e]] = sssp->dist[csr->sources[e]] + csr->weights[e];
+                    sssp->prev_edge[csr->targets[e]] = e;
+                    last_relaxed = csr->targets[e];
+                }
+            }
+
+            if (last_relaxed != ERROR_INDEX)
+            {
+                u = find_predecessor_cycle(csr, sssp, last_relaxed);
+            }
+
+            round++;
+        }
+
+        if (u != ERROR_INDEX)
+        {
+            /* Walking the cycle backwards, so pushing each EID gives the forward order */
+            v = u;
+
+            do
+            {
+                e = sssp->prev_edge[v];
+                cycle = push_id(cycle, csr->edges[e]->id);
+                v = csr->sources[e];
+            }
+            while (v != u);
+        }
+    }
+
+    return cycle;
+}
+
+
+/*
+ *  Given a workspace filled by a shortest paths search, returns the list of edge IDs (EIDs)
+ *  of the shortest path from the source to the node with ID 'dest_nid', in the order they 
+ *  are traversed. Returns NULL if the node is the source itself or if it's unreachable
+ */
+id_list_t * get_sssp_path(graph_csr_t *csr, graph_sssp_t *sssp, id_t dest_nid)
+{
+    id_list_t *path;
+    int v, steps;
+
+
+    path = NULL;
+    v = get_csr_index_from_id(csr, dest_nid);
+
+    if (v != ERROR_INDEX && sssp && sssp_dist(sssp, v) != GRAPH_DIST_INF)
+    {
+        steps = 0;
+
+        while (sssp->prev_edge[v] != ERROR_INDEX && steps < csr->node_count)
+        {
+            path = push_id(path, csr->edges[sssp->prev_edge[v]]->id);
+            v = csr->sources[sssp->prev_edge[v]];
+            steps++;
+        }
+    }
+
+    return path;
+}
+
+
+/*
+ *  Given a workspace filled by a shortest paths search, returns the distance from the source
+ *  to the node with ID 'dest_nid', GRAPH_DIST_INF if it's unreachable or not in the view
+ */
+long int get_sssp_dist(graph_csr_t *csr, graph_sssp_t *sssp, id_t dest_nid)
+{
+    int v;
+
+
+    v = get_csr_index_from_id(csr, dest_nid);
+
+    if (v != ERROR_INDEX && sssp && sssp->epoch != 0)
+    {
+        return sssp_dist(sssp, v);
+    }
+    else
+    {
+        return GRAPH_DIST_INF;
+    }
+}
+
+
+/*
+ *  Helper function of floyd_warshall_apsp() that relaxes the tile of rows
+ *  [row_begin, row_end) and columns [col_begin, col_end) through every intermediate 
+ *  node in [k_begin, k_end). The innermost loop is branch-free (a min of sums over 
+ *  contiguous ints) so that the compiler can turn it into SIMD instructions
+ */
+static void floyd_warshall_tile(int *mat, int dim, int k_begin, int k_end, int row_begin, int row_end, int col_begin, int col_end)
+{
+    int *row, *k_row;
+    int i, j, k, dist_ik, new_dist;
+
+
+    for (k = k_begin; k < k_end; k++)
+    {
+        k_row = mat + (k * dim);
+
+        for (i = row_begin; i < row_end; i++)
+        {
+            row = mat + (i * dim);
+            dist_ik = row[k];
+
+            if (dist_ik != GRAPH_MATRIX_INF)
+            {
+                #ifdef _OPENMP
+                    #pragma omp simd
+                #endif
+                for (j = col_begin; j < col_end; j++)
+                {
+                    new_dist = dist_ik + k_row[j];
+                    row[j] = (k_row[j] != GRAPH_MATRIX_INF && new_dist < row[j]) ? new_dist : row[j];
+                }
+            }
+        }
+    }
+}
+
+
+/*
+ *  Given a distance matrix of dimension dim x dim (see create_graph_weight_matrix()),
+ *  it computes in place the shortest distance between every pair of nodes using the 
+ *  Floyd-Warshall Algorithm, where unreachable pairs are left as GRAPH_MATRIX_INF.
+ * 
+ *  The matrix is split in square tiles of FLOYD_WARSHALL_TILE_SIZE nodes so that the three
+ *  tiles involved in each step fit in cache, and for each block of intermediate nodes:
+ * 
+ *      (1) - The diagonal tile is relaxed through its own nodes
+ *      (2) - The tiles in the same row and column of the diagonal tile are relaxed, using 
+ *            only the diagonal tile, so they are independent from each other
+ *      (3) - All the remaining tiles are relaxed using the tiles of step (2), again
+ *            independently from each other
+ * 
+ *  When compiled with OpenMP, the independent tiles of steps (2) and (3) are spread
+ *  among the available threads.
+ * 
+ *  Every finite distance must be below GRAPH_MATRIX_INF in absolute value, which
+ *  create_graph_weight_matrix() guarantees. The search stops as soon as an intermediate node
+ *  has a negative distance to itself, before a negative cycle can make the sums overflow,
+ *  and the matrix is then left partially computed.
+ * 
+ *  Returns false if the graph contains a negative cycle, true otherwise
+ */
+bool_t floyd_warshall_apsp(int *mat, int dim)
+{
+    int blocks, kb, k, t, ib, jb;
+    int k_begin, k_end, i_begin, i_end, j_begin, j_end;
+    bool_t found_neg_cycle;
+
+
+    found_neg_cycle = false;
+
+    if (mat && dim > 0)
+    {
+        blocks = (dim + FLOYD_WARSHALL_TILE_SIZE - 1) / FLOYD_WARSHALL_TILE_SIZE;
+
+        for (kb = 0; kb < blocks; kb++)
+        {
+            k_begin = kb * FLOYD_WARSHALL_TILE_SIZE;
+            k_end = (kb == blocks - 1) ? dim : k_begin + FLOYD_WARSHALL_TILE_SIZE;
+
+            /* (1) Diagonal tile, one node at a time to check the distance of each node to itself */
+            for (k = k_begin; k < k_end && !found_neg_cycle; k++)
+            {
+                if (*(mat + k + (k * dim)) < 0)
+                {
+                    found_neg_cycle = true;
+                }
+                else
+                {
+                    floyd_warshall_tile(mat, dim, k, k + 1, k_begin, k_end, k_begin, k_end);
+                }
+            }
+
+            if (found_neg_cycle)
+            {
+                break;
+            }
+
+            /* (2) Tiles in the same row and column of the diagonal tile */
+            #ifdef _OPENMP
+                #pragma omp parallel for schedule(dynamic) private(ib, i_begin, i_end)
+            #endif
+            for (t = 0; t < 2 * blocks; t++)
+            {
+                ib = t / 2;
+                i_begin = ib * FLOYD_WARSHALL_TILE_SIZE;
+                i_end = (ib == blocks - 1) ? dim : i_begin + FLOYD_WARSHALL_TILE_SIZE;
+
+                if (ib != kb)
+                {
+                    if (t % 2 == 0)
+                    {
+                        floyd_warshall_tile(mat, dim, k_begin, k_end, k_begin, k_end, i_begin, i_end);
+                    }
+                    else
+                    {
+                        floyd_warshall_tile(mat, dim, k_begin, k_end, i_begin, i_end, k_begin, k_end);
+                    }
+                }
+            }
+
+            /* (3) Remaining tiles */
+            #ifdef _OPENMP
+                #pragma omp parallel for schedule(dynamic) private(ib, jb, i_begin, i_end, j_begin, j_end)
+            #endif
+            for (t = 0; t < blocks * blocks; t++)
+            {
+                ib = t / blocks;
+                jb = t % blocks;
+
+                if (ib != kb && jb != kb)
+                {
+                    i_begin = ib * FLOYD_WARSHALL_TILE_SIZE;
+                    i_end = (ib == blocks - 1) ? dim : i_begin + FLOYD_WARSHALL_TILE_SIZE;
+                    j_begin = jb * FLOYD_WARSHALL_TILE_SIZE;
+                    j_end = (jb == blocks - 1) ? dim : j_begin + FLOYD_WARSHALL_TILE_SIZE;
+
+                    floyd_warshall_tile(mat, dim, k_begin, k_end, i_begin, i_end, j_begin, j_end);
+                }
+            }
+        }
+    }
+
+    return !found_neg_cycle;
+}
+
+
+/*
+ *  Helper function that moves the node stored at position 'pos' of the binary heap 
+ *  of the workspace towards the root, until its parent has a smaller key
+ */
+static void sssp_heap_sift_up(graph_sssp_t *sssp, int pos)
+{
+    int node, parent;
+
+
+    node = sssp->queue[pos];
+
+    while (pos > 0 && sssp->heap_key[sssp->queue[(pos - 1) / 2]] > sssp->heap_key[node])
+    {
+        parent = sssp->queue[(pos - 1) / 2];
+        sssp->queue[pos] = parent;
+        sssp->heap_pos[parent] = pos;
+        pos = (pos - 1) / 2;
+    }
+
+    sssp->queue[pos] = node;
+    sssp->heap_pos[node] = pos;
+}
+
+
+/*
+ *  Helper function that inserts the node with index 'v' in the binary heap of the workspace
+ *  with the given key (its distance for Dijkstra's Algorithm), or moves it up if it's already
+ *  inside (the key can only be decreased)
+ */
+static void sssp_heap_push(graph_sssp_t *sssp, int v, long int key)
+{
+    sssp->heap_key[v] = key;
+
+    if (sssp->in_queue[v])
+    {
+        sssp_heap_sift_up(sssp, sssp->heap_pos[v]);
+    }
+    else
+    {
+        sssp->in_queue[v] = true;
+        sssp->queue[sssp->heap_size] = v;
+        sssp->heap_size++;
+        sssp_heap_sift_up(sssp, sssp->heap_size - 1);
+    }
+}
+
+
+/*
+ *  Helper function that removes and returns the node with the smallest 
+ *  key from the binary heap of the workspace
+ */
+static int sssp_heap_pop(graph_sssp_t *sssp)
+{
+    int top, node, pos, child;
+
+
+    top = sssp->queue[0];
+    sssp->in_queue[top] = false;
+    sssp->heap_size--;
+
+    if (sssp->heap_size > 0)
+    {
+        node = sssp->queue[sssp->heap_size];
+        pos = 0;
+        child = 1;
+
+        while (child < sssp->heap_size)
+        {
+            if (child + 1 < sssp->heap_size && sssp->heap_key[sssp->queue[child + 1]] < sssp->heap_key[sssp->queue[child]])
+            {
+                child++;
+            }
+
+            if (sssp->heap_key[sssp->queue[child]] < sssp->heap_key[node])
+            {
+                sssp->queue[pos] = sssp->queue[child];
+                sssp->heap_pos[sssp->queue[pos]] = pos;
+                pos = child;
+                child = 2 * pos + 1;
+            }
+            else
+            {
+                child = sssp->heap_size;
+            }
+        }
+
+        sssp->queue[pos] = node;
+        sssp->heap_pos[node] = pos;
+    }
+
+    return top;
+}
+
+
+/*
+ *  Helper function that runs Dijkstra's Algorithm with a binary heap from the node with 
+ *  index 'src'. If 'weights' isn't NULL, it's used instead of the weights of the compact
+ *  view (this is how Johnson's Algorithm passes the reweighted edges)
+ */
+static void dijkstra_search(graph_csr_t *csr, const long int *weights, graph_sssp_t *sssp, int src)
+{
+    int u, v, e;
+    long int new_dist;
+
+
+    sssp_begin_search(sssp);
+    sssp_reach(sssp, src);
+
+    sssp->src = src;
+    sssp->dist[src] = 0;
+    sssp_heap_push(sssp, src, 0);
+
+    while (sssp->heap_size > 0)
+    {
+        u = sssp_heap_pop(sssp);
+
+        for (e = csr->offsets[u]; e < csr->offsets[u + 1]; e++)
+        {
+            v = csr->targets[e];
+            new_dist = sssp->dist[u] + (weights ? weights[e] : csr->weights[e]);
+            sssp_reach(sssp, v);
+
+            if (new_dist < sssp->dist[v])
+            {
+                sssp->dist[v] = new_dist;
+                sssp->prev_edge[v] = e;
+                sssp_heap_push(sssp, v, new_dist);
+            }
+        }
+    }
+}
+
+
+/*
+ *  Helper function that inserts the node with index 'v' at the front of the bucket 'b'.
+ *  The buckets are doubly linked lists of nodes, stored in the scratch arrays of the
+ *  workspace: 'queue' holds the next node and 'heap_pos' the previous one
+ */
+static void sssp_bucket_insert(graph_sssp_t *sssp, int *buckets, int b, int v)
+{
+    sssp->queue[v] = buckets[b];
+    sssp->heap_pos[v] = ERROR_INDEX;
+
+    if (buckets[b] != ERROR_INDEX)
+    {
+        sssp->heap_pos[buckets[b]] = v;
+    }
+
+    buckets[b] = v;
+    sssp->in_queue[v] = true;
+}
+
+
+/*
+ *  Helper function that removes the node with index 'v' from the bucket 'b'
+ */
+static void sssp_bucket_remove(graph_sssp_t *sssp, int *buckets, int b, int v)
+{
+    if (sssp->heap_pos[v] != ERROR_INDEX)
+    {
+        sssp->queue[sssp->heap_pos[v]] = sssp->queue[v];
+    }
+    else
+    {
+        buckets[b] = sssp->queue[v];
+    }
+
+    if (sssp->queue[v] != ERROR_INDEX)
+    {
+        sssp->heap_pos[sssp->queue[v]] = sssp->heap_pos[v];
+    }
+
+    sssp->in_queue[v] = false;
+}
+
+
+/*
+ *  Helper function that runs Dial's Algorithm from the node with index 'src' (see dial_sssp()),
+ *  where 'buckets' has room for max_weight + 1 buckets
+ */
+static void dial_search(graph_csr_t *csr, graph_sssp_t *sssp, int src, int *buckets)
+{
+    int bucket_count, count, b, u, v, e;
+    long int new_dist;
+
+
+    bucket_count = csr->max_weight + 1;
+
+    for (b = 0; b < bucket_count; b++)
+    {
+        buckets[b] = ERROR_INDEX;
+    }
+
+    sssp_begin_search(sssp);
+    sssp_reach(sssp, src);
+
+    sssp->src = src;
+    sssp->dist[src] = 0;
+    sssp_bucket_insert(sssp, buckets, 0, src);
+    count = 1;
+    b = 0;
+
+    while (count > 0)
+    {
+        /* The cursor only moves forward, following the distance of the extracted nodes */
+        while (buckets[b] == ERROR_INDEX)
+        {
+            b = (b + 1 == bucket_count) ? 0 : b + 1;
+        }
+
+        u = buckets[b];
+        sssp_bucket_remove(sssp, buckets, b, u);
+        count--;
+
+        for (e = csr->offsets[u]; e < csr->offsets[u + 1]; e++)
+        {
+            v = csr->targets[e];
+            new_dist = sssp->dist[u] + csr->weights[e];
+            sssp_reach(sssp, v);
+
+            if (new_dist < sssp->dist[v])
+            {
+                if (sssp->in_queue[v])
+                {
+                    sssp_bucket_remove(sssp, buckets, sssp->dist[v] % bucket_count, v);
+                    count--;
+                }
+
+                sssp->dist[v] = new_dist;
+                sssp->prev_edge[v] = e;
+                sssp_bucket_insert(sssp, buckets, new_dist % bucket_count, v);
+                count++;
+            }
+        }
+    }
+}
+
+
+/*
+ *  Helper function that returns the bucket of the radix heap for the given key, which is
+ *  the position of the highest bit where the key differs from the last extracted one 
+ *  (0 if they're equal)
+ */
+static int radix_heap_bucket(long int key, long int last)
+{
+    unsigned long int diff;
+    int b;
+
+
+    diff = (unsigned long int)(key ^ last);
+    b = 0;
+
+    while (diff >> 8)
+    {
+        diff >>= 8;
+        b += 8;
+    }
+
+    while (diff)
+    {
+        diff >>= 1;
+        b++;
+    }
+
+    return b;
+}
+
+
+/*
+ *  Helper function that runs Dijkstra's Algorithm with a radix heap from the node with 
+ *  index 'src' (see radix_heap_sssp())
+ */
+static void radix_heap_search(graph_csr_t *csr, graph_sssp_t *sssp, int src)
+{
+    int buckets[RADIX_HEAP_BUCKETS];
+    int count, b, u, v, e, next;
+    long int new_dist, last;
+
+
+    for (b = 0; b < RADIX_HEAP_BUCKETS; b++)
+    {
+        buckets[b] = ERROR_INDEX;
+    }
+
+    sssp_begin_search(sssp);
+    sssp_reach(sssp, src);
+
+    sssp->src = src;
+    sssp->dist[src] = 0;
+    sssp_bucket_insert(sssp, buckets, 0, src);
+    count = 1;
+    last = 0;
+
+    while (count > 0)
+    {
+        if (buckets[0] == ERROR_INDEX)
+        {
+            /* The minimum of the first non-empty bucket becomes the last key, then the bucket is redistributed */
+            for (b = 1; buckets[b] == ERROR_INDEX; b++);
+
+            last = GRAPH_DIST_INF;
+
+            for (v = buckets[b]; v != ERROR_INDEX; v = sssp->queue[v])
+            {
+                last = (sssp->dist[v] < last) ? sssp->dist[v] : last;
+            }
+
+            for (v = buckets[b]; v != ERROR_INDEX; v = next)
+            {
+                next = sssp->queue[v];
+                sssp_bucket_insert(sssp, buckets, radix_heap_bucket(sssp->dist[v], last), v);
+            }
+
+            buckets[b] = ERROR_INDEX;
+        }
+
+        u = buckets[0];
+        sssp_bucket_remove(sssp, buckets, 0, u);
+        count--;
+
+        for (e = csr->offsets[u]; e < csr->offsets[u + 1]; e++)
+        {
+            v = csr->targets[e];
+            new_dist = sssp->dist[u] + csr->weights[e];
+            sssp_reach(sssp, v);
+
+            if (new_dist < sssp->dist[v])
+            {
+                if (sssp->in_queue[v])
+                {
+                    sssp_bucket_remove(sssp, buckets, radix_heap_bucket(sssp->dist[v], last), v);
+                    count--;
+                }
+
+                sssp->dist[v] = new_dist;
+                sssp->prev_edge[v] = e;
+                sssp_bucket_insert(sssp, buckets, radix_heap_bucket(new_dist, last), v);
+                count++;
+            }
+        }
+    }
+}
+
+
+/*
+ *  Computes the shortest paths from the node with ID 'src_nid' with Dial's Algorithm: since
+ *  the edge weights are non-negative integers, the nodes waiting to be extracted can be kept in
+ *  max_weight + 1 buckets indexed by (distance % (max_weight + 1)) instead of a heap, and a cursor
+ *  that only moves forward finds the closest one, in O(V + E + D) where D is the largest distance.
+ *  It's the best choice when the maximum weight is small (a few hundreds at most).
+ * 
+ *  Returns true if the search was performed, false otherwise
+ */
+bool_t dial_sssp(graph_csr_t *csr, id_t src_nid, graph_sssp_t *sssp)
+{
+    int *buckets;
+    int src;
+
+
+    src = get_csr_index_from_id(csr, src_nid);
+
+    if (src == ERROR_INDEX || sssp == NULL || sssp->node_count < csr->node_count)
+    {
+        printf("[dial_sssp()] ERROR: Invalid source node or workspace\n");
+        return false;
+    }
+
+    if (csr->min_weight < 0)
+    {
+        printf("[dial_sssp()] ERROR: Dial's Algorithm can only be applied on graphs with positive edge weights\n");
+        return false;
+    }
+
+    if (!( buckets = (int*)malloc(sizeof(int) * ((long int)csr->max_weight + 1)) ))
+    {
+        printf("[dial_sssp()] ERROR: Memory allocation was unsuccessful\n");
+        return false;
+    }
+
+    dial_search(csr, sssp, src, buckets);
+    free(buckets);
+
+    return true;
+}
+
+
+/*
+ *  Computes the shortest paths from the node with ID 'src_nid' using Dijkstra's Algorithm with 
+ *  a radix heap: the keys extracted from a Dijkstra's heap never decrease, so each node can be
+ *  stored in the bucket given by the highest bit where its distance differs from the last
+ *  extracted one. Only the first non-empty bucket is ever scanned, and every node moves to a 
+ *  lower bucket at most once per bit, in O(E + V log C) where C is the maximum weight.
+ * 
+ *  Returns true if the search was performed, false otherwise
+ */
+bool_t radix_heap_sssp(graph_csr_t *csr, id_t src_nid, graph_sssp_t *sssp)
+{
+    int src;
+
+
+    src = get_csr_index_from_id(csr, src_nid);
+
+    if (src == ERROR_INDEX || sssp == NULL || sssp->node_count < csr->node_count)
+    {
+        printf("[radix_heap_sssp()] ERROR: Invalid source node or workspace\n");
+        return false;
+    }
+
+    if (csr->min_weight < 0)
+    {
+        printf("[radix_heap_sssp()] ERROR: Dijkstra's Algorithm can only be applied on graphs with positive edge weights\n");
+        return false;
+    }
+
+    radix_heap_search(csr, sssp, src);
+
+    return true;
+}
+
+
+/*
+ *  Computes the shortest paths from the node with ID 'src_nid' to every other node of
+ *  the compact view using Dijkstra's Algorithm. Like dijkstra_mst(), it refuses graphs 
+ *  with negative edge weights (use bellman_ford_sssp() for those), but the results are 
+ *  stored in the workspace. The queue of the algorithm is chosen by the maximum weight
+ *  of the view: Dial's buckets (see dial_sssp()) up to DIAL_MAX_WEIGHT, and a radix heap 
+ *  (see radix_heap_sssp()) for larger weights.
+ * 
+ *  NOTE:
+ *   - Unlike dijkstra_mst(), neither the graph nor the compact view are modified, so many
+ *     threads can search the same view at the same time as long as each one has its own
+ *     workspace (read the results with get_sssp_dist() and get_sssp_path())
+ * 
+ *   - The workspace doesn't need to be reset between searches: the cost of a search only
+ *     depends on the nodes it reaches, not on the size of the graph
+ *  
+ *  Returns true if the search was performed, false otherwise
+ */
+bool_t dijkstra_sssp(graph_csr_t *csr, id_t src_nid, graph_sssp_t *sssp)
+{
+    int src;
+
+
+    src = get_csr_index_from_id(csr, src_nid);
+
+    if (src == ERROR_INDEX || sssp == NULL || sssp->node_count < csr->node_count)
+    {
+        printf("[dijkstra_sssp()] ERROR: Invalid source node or workspace\n");
+        return false;
+    }
+
+    if (csr->min_weight < 0)
+    {
+        printf("[dijkstra_sssp()] ERROR: Dijkstra's Algorithm can only be applied on graphs with positive edge weights\n");
+        return false;
+    }
+
+    if (csr->max_weight <= DIAL_MAX_WEIGHT)
+    {
+        return dial_sssp(csr, src_nid, sssp);
+    }
+
+    radix_heap_search(csr, sssp, src);
+
+    return true;
+}
+
+
+/*
+ *  Computes the shortest paths from the node with ID 'src_nid' using Dijkstra's Algorithm 
+ *  with a binary heap, in O((V + E) log V). Unlike dijkstra_sssp(), the weights don't need
+ *  to be small integers for the heap to be efficient, which is why Johnson's Algorithm and
+ *  the point-to-point searches (whose weights are reweighted or estimated) are based on it.
+ * 
+ *  Returns true if the search was performed, false otherwise
+ */
+bool_t binary_heap_sssp(graph_csr_t *csr, id_t src_nid, graph_sssp_t *sssp)
+{
+    int src;
+
+
+    src = get_csr_index_from_id(csr, src_nid);
+
+    if (src == ERROR_INDEX || sssp == NULL || sssp->node_count < csr->node_count)
+    {
+        printf("[binary_heap_sssp()] ERROR: Invalid source node or workspace\n");
+        return false;
+    }
+
+    if (csr->min_weight < 0)
+    {
+        printf("[binary_heap_sssp()] ERROR: Dijkstra's Algorithm can only be applied on graphs with positive edge weights\n");
+        return false;
+    }
+
+    dijkstra_search(csr, NULL, sssp, src);
+
+    return true;
+}
+
+
+/*
+ *  Helper function that lowers the distance pointed by 'dist' to 'value' if it's smaller, 
+ *  atomically when the library is compiled with OpenMP (with a compare-and-swap loop on
+ *  GCC-compatible compilers, or a critical section otherwise). Returns true if the 
+ *  distance was lowered
+ */
+static bool_t atomic_min_dist(long int *dist, long int value)
+{
+    bool_t updated;
+    #if defined(_OPENMP) && defined(__GNUC__)
+        long int old;
+    #endif
+
+
+    updated = false;
+
+    #if defined(_OPENMP) && defined(__GNUC__)
+        old = __atomic_load_n(dist, __ATOMIC_RELAXED);
+
+        while (value < old && !updated)
+        {
+            updated = __atomic_compare_exchange_n(dist, &old, value, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+        }
+    #elif defined(_OPENMP)
+        #pragma omp critical (atomic_min_dist)
+        {
+            if (value < *dist)
+            {
+                *dist = value;
+                updated = true;
+            }
+        }
+    #else
+        if (value < *dist)
+        {
+            *dist = value;
+            updated = true;
+        }
+    #endif
+
+    return updated;
+}
+
+
+/*
+ *  Helper function that appends the node with index 'v' to the given bucket of a thread 
+ *  (see delta_stepping_sssp()), growing it when it's full. Returns false if the allocation 
+ *  was unsuccessful
+ */
+static bool_t delta_stepping_push(int **bucket, int *size, int *capacity, int v)
+{
+    int *grown;
+
+
+    if (*size == *capacity)
+    {
+        if (!( grown = (int*)realloc(*bucket, sizeof(int) * (2 * (*capacity) + DELTA_STEPPING_BUCKET_SIZE)) ))
+        {
+            return false;
+        }
+
+        *bucket = grown;
+        *capacity = 2 * (*capacity) + DELTA_STEPPING_BUCKET_SIZE;
+    }
+
+    (*bucket)[*size] = v;
+    (*size)++;
+
+    return true;
+}
+
+
+/*
+ *  Helper function that relaxes the light (weight <= delta) or the heavy (weight > delta) edges
+ *  of the node with index 'u', pushing every improved node into the bucket of its new distance
+ *  among the 'slot_count' circular buckets of the thread. Returns false if a push failed
+ */
+static bool_t delta_stepping_relax(graph_csr_t *csr, long int *dist, int u, int delta, bool_t light, int **buckets, int *sizes, int *capacities, int slot_count)
+{
+    int e, v, slot;
+    long int new_dist;
+    bool_t allocated;
+
+
+    allocated = true;
+
+    for (e = csr->offsets[u]; e < csr->offsets[u + 1]; e++)
+    {
+        if ((csr->weights[e] <= delta) == light)
+        {
+            v = csr->targets[e];
+            new_dist = dist[u] + csr->weights[e];
+
+            if (atomic_min_dist(&(dist[v]), new_dist))
+            {
+                slot = (new_dist / delta) % slot_count;
+                allocated = delta_stepping_push(&(buckets[slot]), &(sizes[slot]), &(capacities[slot]), v) && allocated;
+            }
+        }
+    }
+
+    return allocated;
+}
+
+
+/*
+ *  Computes the shortest paths from the node with ID 'src_nid' with the Delta-Stepping
+ *  Algorithm, which processes in parallel all the nodes whose tentative distance falls in the 
+ *  same bucket of width 'delta'. The light edges (weight <= delta) of a bucket are relaxed 
+ *  again and again until no node re-enters it, then its heavy edges are relaxed only once,
+ *  since they always lead to later buckets. The distances are lowered with an atomic minimum,
+ *  and every thread keeps its own circular array of buckets, which only needs 
+ *  (max_weight / delta + 2) slots because the tentative distances never exceed the current 
+ *  bucket by more than max_weight. Once the distances are final, the previous edge of every 
+ *  node is chosen among the edges that lie on a shortest path.
+ * 
+ *  A small delta works like Dijkstra's Algorithm (little wasted work, but also little 
+ *  parallelism), while a large one works like Bellman-Ford. If delta <= 0 it's chosen as 
+ *  (max_weight / average out-degree), and it's always raised enough to keep the slots under
+ *  DELTA_STEPPING_MAX_SLOTS.
+ * 
+ *  Returns true if the search was performed, false otherwise
+ */
+bool_t delta_stepping_sssp(graph_csr_t *csr, id_t src_nid, graph_sssp_t *sssp, int delta)
+{
+    int **buckets;
+    int *sizes, *capacities, *offsets, *frontier, *grown;
+    int src, n, threads, team, slot_count, columns, frontier_size, frontier_capacity;
+    int t, i, u, v, e, next;
+    long int curr;
+    bool_t allocated;
+
+
+    src = get_csr_index_from_id(csr, src_nid);
+
+    if (src == ERROR_INDEX || sssp == NULL || sssp->node_count < csr->node_count)
+    {
+        printf("[delta_stepping_sssp()] ERROR: Invalid source node or workspace\n");
+        return false;
+    }
+
+    if (csr->min_weight < 0)
+    {
+        printf("[delta_stepping_sssp()] ERROR: Delta-Stepping can only be applied on graphs with positive edge weights\n");
+        return false;
+    }
+
+    n = csr->node_count;
+    threads = get_thread_count();
+
+    if (delta <= 0)
+    {
+        delta = (csr->edge_count > n) ? (int)(((long int)csr->max_weight * n) / csr->edge_count) : csr->max_weight;
+    }
+
+    if (delta < 1 + csr->max_weight / DELTA_STEPPING_MAX_SLOTS)
+    {
+        delta = 1 + csr->max_weight / DELTA_STEPPING_MAX_SLOTS;
+    }
+
+    /* Each thread has slot_count buckets, plus one for the nodes settled in the current bucket */
+    slot_count = csr->max_weight / delta + 2;
+    columns = slot_count + 1;
+    frontier_capacity = n + 1;
+    sizes = NULL;
+    capacities = NULL;
+    offsets = NULL;
+    frontier = NULL;
+
+    if (!(
+        ( buckets = (int**)calloc(threads * columns, sizeof(int*)) )
+        && ( sizes = (int*)calloc(threads * columns, sizeof(int)) )
+        && ( capacities = (int*)calloc(threads * columns, sizeof(int)) )
+        && ( offsets = (int*)malloc(sizeof(int) * (threads + 1)) )
+        && ( frontier = (int*)malloc(sizeof(int) * frontier_capacity) )
+    ))
+    {
+        printf("[delta_stepping_sssp()] ERROR: Memory allocation was unsuccessful\n");
+        free(buckets);
+        free(sizes);
+        free(capacities);
+        free(offsets);
+        free(frontier);
+        return false;
+    }
+
+    /* Initialization (every node is stamped, since most of them will be reached anyway) */
+    sssp_begin_search(sssp);
+
+    #ifdef _OPENMP
+        #pragma omp parallel for schedule(static)
+    #endif
+    for (v = 0; v < n; v++)
+    {
+        sssp->stamp[v] = sssp->epoch;
+        sssp->dist[v] = GRAPH_DIST_INF;
+        sssp->prev_edge[v] = ERROR_INDEX;
+        sssp->path_len[v] = 0;
+        sssp->in_queue[v] = false;
+    }
+
+    sssp->src = src;
+    sssp->dist[src] = 0;
+    allocated = delta_stepping_push(&(buckets[0]), &(sizes[0]), &(capacities[0]), src);
+    curr = 0;
+    frontier_size = 0;
+    team = 1;
+
+    /* Beginning of algorithm */
+    #ifdef _OPENMP
+        #pragma omp parallel private(t, i, u, next)
+    #endif
+    {
+        t = get_thread_id();
+
+        /* The team can be smaller than get_thread_count(), so only its threads are gathered */
+        #ifdef _OPENMP
+            #pragma omp single
+        #endif
+        {
+            team = get_team_size();
+        }
+
+        while (curr != ERROR_INDEX && allocated)
+        {
+            /* Gathering the current bucket of all the threads into the frontier */
+            #ifdef _OPENMP
+                #pragma omp single
+            #endif
+            {
+                frontier_size = 0;
+
+                for (i = 0; i < team; i++)
+                {
+                    offsets[i] = frontier_size;
+                    frontier_size += sizes[i * columns + (curr % slot_count)];
+                }
+
+                if (frontier_size > frontier_capacity)
+                {
+                    if (( grown = (int*)realloc(frontier, sizeof(int) * frontier_size) ))
+                    {
+                        frontier = grown;
+                        frontier_capacity = frontier_size;
+                    }
+                    else
+                    {
+                        allocated = false;
+                        frontier_size = 0;
+                    }
+                }
+            }
+
+            if (allocated && sizes[t * columns + (curr % slot_count)] > 0)
+            {
+                memcpy(frontier + offsets[t], buckets[t * columns + (curr % slot_count)], sizeof(int) * sizes[t * columns + (curr % slot_count)]);
+            }
+
+            sizes[t * columns + (curr % slot_count)] = 0;
+
+            #ifdef _OPENMP
+                #pragma omp barrier
+            #endif
+
+            if (frontier_size > 0)
+            {
+                /* Light edges: the nodes of the frontier that are still in the current bucket */
+                #ifdef _OPENMP
+                    #pragma omp for schedule(dynamic, 64)
+                #endif
+                for (i = 0; i < frontier_size; i++)
+                {
+                    u = frontier[i];
+
+                    if (sssp->dist[u] / delta == curr)
+                    {
+                        if (!(
+                            delta_stepping_push(&(buckets[t * columns + slot_count]), &(sizes[t * columns + slot_count]), &(capacities[t * columns + slot_count]), u)
+                            && delta_stepping_relax(csr, sssp->dist, u, delta, true, buckets + t * columns, sizes + t * columns, capacities + t * columns, slot_count)
+                        ))
+                        {
+                            allocated = false;
+                        }
+                    }
+                }
+            }
+            else
+            {
+                /* Heavy edges of the nodes settled in the current bucket */
+                for (i = 0; i < sizes[t * columns + slot_count]; i++)
+                {
+                    if (!delta_stepping_relax(csr, sssp->dist, buckets[t * columns + slot_count][i], delta, false, buckets + t * columns, sizes + t * columns, capacities + t * columns, slot_count))
+                    {
+                        allocated = false;
+                    }
+                }
+
+                sizes[t * columns + slot_count] = 0;
+
+                /* The next bucket is the closest one that isn't empty in any thread */
+                for (next = 1; next < slot_count && sizes[t * columns + ((curr + next) % slot_count)] == 0; next++);
+
+                offsets[t] = next;
+
+                #ifdef _OPENMP
+                    #pragma omp barrier
+                    #pragma omp single
+                #endif
+                {
+                    for (i = 1, next = offsets[0]; i < team; i++)
+                    {
+                        next = (offsets[i] < next) ? offsets[i] : next;
+                    }
+
+                    curr = (next == slot_count) ? ERROR_INDEX : curr + next;
+                }
+            }
+        }
+    }
+
+    /* Previous edges: any edge u -> v with dist[u] + weight = dist[v] lies on a shortest path */
+    #ifdef _OPENMP
+        #pragma omp parallel for private(e, v) schedule(dynamic, 256)
+    #endif
+    for (u = 0; u < n; u++)
+    {
+        if (sssp->dist[u] != GRAPH_DIST_INF)
+        {
+            for (e = csr->offsets[u]; e < csr->offsets[u + 1]; e++)
+            {
+                v = csr->targets[e];
+
+                if (csr->weights[e] > 0 && sssp->dist[u] + csr->weights[e] == sssp->dist[v])
+                {
+                    #ifdef _OPENMP
+                        #pragma omp atomic write
+                    #endif
+                    sssp->prev_edge[v] = e;
+                }
+            }
+        }
+    }
+
+    /* 
+     *  Edges of weight 0 could close a cycle, so the nodes only reachable through them 
+     *  are linked with a breadth-first visit from the nodes that already have an edge
+     */
+    if (csr->min_weight == 0)
+    {
+        for (u = 0, frontier_size = 0; u < n; u++)
+        {
+            if (u == src || sssp->prev_edge[u] != ERROR_INDEX)
+            {
+                sssp->queue[frontier_size] = u;
+                frontier_size++;
+            }
+        }
+
+        for (i = 0; i < frontier_size; i++)
+        {
+            u = sssp->queue[i];
+
+            for (e = csr->offsets[u]; e < csr->offsets[u + 1]; e++)
+            {
+                v = csr->targets[e];
+
+                if (csr->weights[e] == 0 && v != src && sssp->prev_edge[v] == ERROR_INDEX && sssp->dist[u] == sssp->dist[v])
+                {
+                    sssp->prev_edge[v] = e;
+                    sssp->queue[frontier_size] = v;
+                    frontier_size++;
+                }
+            }
+        }
+    }
+
+    for (i = 0; i < threads * columns; i++)
+    {
+        free(buckets[i]);
+    }
+
+    free(buckets);
+    free(sizes);
+    free(capacities);
+    free(offsets);
+    free(frontier);
+
+    if (!allocated)
+    {
+        printf("[delta_stepping_sssp()] ERROR: Memory allocation was unsuccessful\n");
+    }
+
+    return allocated;
+}
+
+
+/*
+ *  Computes the shortest distance between every pair of nodes of a sparse graph, whose
+ *  edge weights can be negative, using Johnson's Algorithm:
+ * 
+ *      (1) - A single Bellman-Ford search from a virtual node linked to every node computes
+ *            the potential h(v) of each node (and detects negative cycles)
+ *      (2) - Each edge (u, v) is reweighted as w(u, v) + h(u) - h(v), which is never negative
+ *      (3) - A Dijkstra search is run from every node on the reweighted edges, and the
+ *            distances are corrected back as d(u, v) - h(u) + h(v)
+ * 
+ *  which takes O(V E log V) instead of the O(V^3) of floyd_warshall_apsp(). The V searches
+ *  of step (3) are independent: when compiled with OpenMP they are spread among the threads,
+ *  each one with its own workspace, and the graph is only read.
+ * 
+ *  Returns a node_count x node_count matrix of distances (the cell (i, j) holds the distance 
+ *  from the node with index i to the node with index j, GRAPH_DIST_INF if unreachable), 
+ *  or NULL if the graph contains a negative cycle
+ */
+long int * johnson_apsp(graph_csr_t *csr)
+{
+    graph_sssp_t *potentials, *sssp;
+    graph_sssp_t **workspaces;
+    long int *dist, *weights;
+    int n, e, t, threads, src, v;
+    bool_t allocated;
+
+
+    dist = NULL;
+
+    if (csr && ( potentials = create_sssp(csr->node_count) ))
+    {
+        n = csr->node_count;
+        threads = get_thread_count();
+        weights = NULL;
+        workspaces = NULL;
+
+        if ( !bellman_ford_search(csr, potentials, ERROR_INDEX) )
+        {
+            printf("[johnson_apsp()] ERROR: The graph contains a negative cycle\n");
+        }
+        else if (
+            ( dist = (long int*)malloc(sizeof(long int) * n * n) )
+            && ( weights = (long int*)malloc(sizeof(long int) * (csr->edge_count + 1)) )
+            && ( workspaces = (graph_sssp_t**)calloc(threads, sizeof(graph_sssp_t*)) )
+        )
+        {
+            /* One workspace for each thread */
+            allocated = true;
+
+            for (t = 0; t < threads && allocated; t++)
+            {
+                allocated = (( workspaces[t] = create_sssp(n) ) != NULL);
+            }
+
+            if (allocated)
+            {
+                /* Reweighting */
+                for (e = 0; e < csr->edge_count; e++)
+                {
+                    weights[e] = csr->weights[e] + potentials->dist[csr->sources[e]] - potentials->dist[csr->targets[e]];
+                }
+
+                #ifdef _OPENMP
+                    #pragma omp parallel for schedule(dynamic, 16) private(sssp, v)
+                #endif
+                for (src = 0; src < n; src++)
+                {
+                    sssp = workspaces[get_thread_id()];
+                    dijkstra_search(csr, weights, sssp, src);
+
+                    for (v = 0; v < n; v++)
+                    {
+                        if (sssp_dist(sssp, v) == GRAPH_DIST_INF)
+                        {
+                            dist[v + (src * n)] = GRAPH_DIST_INF;
+                        }
+                        else
+                        {
+                            dist[v + (src * n)] = sssp->dist[v] - potentials->dist[src] + potentials->dist[v];
+                        }
+                    }
+                }
+            }
+            else
+            {
+                free(dist);
+                dist = NULL;
+            }
+
+            for (t = 0; t < threads; t++)
+            {
+                workspaces[t] = delete_sssp(workspaces[t]);
+            }
+        }
+        else
+        {
+            printf("[johnson_apsp()] ERROR: Memory allocation was unsuccessful\n");
+            free(dist);
+            dist = NULL;
+        }
+
+        free(weights);
+        free(workspaces);
+        potentials = delete_sssp(potentials);
+    }
+
+    return dist;
+}
+
+
+/*
+ *  Helper function that advances a Dijkstra search (forward on the compact view or backward 
+ *  on its transpose) by one node: it extracts the closest node from the heap of 'sssp' and 
+ *  relaxes its edges. Every time a relaxed node has already been reached by the opposite 
+ *  search ('other'), the path through it is compared to the best one found so far
+ */
+static void bidirectional_dijkstra_step(graph_csr_t *csr, graph_sssp_t *sssp, graph_sssp_t *other, long int *best, int *meet)
+{
+    int u, v, e;
+    long int new_dist;
+
+
+    u = sssp_heap_pop(sssp);
+
+    for (e = csr->offsets[u]; e < csr->offsets[u + 1]; e++)
+    {
+        v = csr->targets[e];
+        new_dist = sssp->dist[u] + csr->weights[e];
+        sssp_reach(sssp, v);
+
+        if (new_dist < sssp->dist[v])
+        {
+            sssp->dist[v] = new_dist;
+            sssp->prev_edge[v] = e;
+            sssp_heap_push(sssp, v, new_dist);
+        }
+
+        if (sssp_dist(other, v) != GRAPH_DIST_INF && sssp->dist[v] + other->dist[v] < *best)
+        {
+            *best = sssp->dist[v] + other->dist[v];
+            *meet = v;
+        }
+    }
+}
+
+
+/*
+ *  Computes the shortest path from the node with ID 'src_nid' to the node with ID 'dest_nid'
+ *  with the Bidirectional Dijkstra's Algorithm: a forward search from the source on the compact
+ *  view and a backward search from the destination on its transpose (see 
+ *  create_graph_csr_transpose()) run at the same time, always advancing the one whose closest 
+ *  node is nearer. The best path through a node reached by both is kept, and the searches
+ *  stop as soon as the sum of the two closest distances can't improve it anymore, so only the
+ *  nodes "around" the two endpoints get explored instead of the whole tree of dijkstra_mst().
+ * 
+ *  The two workspaces keep the state of the searches, so the views are only read.
+ *  The length of the path is stored in 'dist' (GRAPH_DIST_INF if the destination is
+ *  unreachable) and the function returns the list of the edge IDs (EIDs) of the path,
+ *  NULL if the path is empty or doesn't exist
+ */
+id_list_t * bidirectional_dijkstra(graph_csr_t *csr, graph_csr_t *reverse, id_t src_nid, id_t dest_nid, graph_sssp_t *forward, graph_sssp_t *backward, long int *dist)
+{
+    id_list_t *path;
+    int src, dest, meet, v, e, count;
+    long int best;
+
+
+    path = NULL;
+    best = GRAPH_DIST_INF;
+    src = get_csr_index_from_id(csr, src_nid);
+    dest = get_csr_index_from_id(csr, dest_nid);
+
+    if (
+        src == ERROR_INDEX || dest == ERROR_INDEX || reverse == NULL 
+        || forward == NULL || forward->node_count < csr->node_count 
+        || backward == NULL || backward->node_count < csr->node_count
+    )
+    {
+        printf("[bidirectional_dijkstra()] ERROR: Invalid node IDs, views or workspaces\n");
+    }
+    else if (csr->min_weight < 0)
+    {
+        printf("[bidirectional_dijkstra()] ERROR: Dijkstra's Algorithm can only be applied on graphs with positive edge weights\n");
+    }
+    else
+    {
+        /* Initialization */
+        sssp_begin_search(forward);
+        sssp_begin_search(backward);
+        sssp_reach(forward, src);
+        sssp_reach(backward, dest);
+
+        forward->src = src;
+        forward->dist[src] = 0;
+        sssp_heap_push(forward, src, 0);
+
+        backward->src = dest;
+        backward->dist[dest] = 0;
+        sssp_heap_push(backward, dest, 0);
+
+        meet = (src == dest) ? src : ERROR_INDEX;
+        best = (src == dest) ? 0 : GRAPH_DIST_INF;
+
+        /* Beginning of algorithm */
+        while (
+            forward->heap_size > 0 && backward->heap_size > 0
+            && (best == GRAPH_DIST_INF || forward->dist[forward->queue[0]] + backward->dist[backward->queue[0]] < best)
+        )
+        {
+            if (forward->dist[forward->queue[0]] <= backward->dist[backward->queue[0]])
+            {
+                bidirectional_dijkstra_step(csr, forward, backward, &best, &meet);
+            }
+            else
+            {
+                bidirectional_dijkstra_step(reverse, backward, forward, &best, &meet);
+            }
+        }
+
+        if (meet != ERROR_INDEX)
+        {
+            /* 
+             *  The backward half (meet -> dest) is walked first and its EIDs are stored in the 
+             *  (now empty) heap array of the backward workspace, so that they can be pushed in 
+             *  reverse order; then the forward half (src -> meet) is pushed in front of them
+             */
+            count = 0;
+
+            for (v = meet; backward->prev_edge[v] != ERROR_INDEX; v = reverse->sources[e])
+            {
+                e = backward->prev_edge[v];
+                backward->queue[count] = e;
+                count++;
+            }
+
+            while (count > 0)
+            {
+                count--;
+                path = push_id(path, reverse->edges[backward->queue[count]]->id);
+            }
+
+            for (v = meet; forward->prev_edge[v] != ERROR_INDEX; v = csr->sources[e])
+            {
+                e = forward->prev_edge[v];
+                path = push_id(path, csr->edges[e]->id);
+            }
+        }
+    }
+
+    if (dist)
+    {
+        *(dist) = best;
+    }
+
+    return path;
+}
+
+
+/*
+ *  Computes the shortest path from the node with ID 'src_nid' to the node with ID 'dest_nid'
+ *  with the A* Algorithm: like Dijkstra's Algorithm, but the nodes are extracted from the heap
+ *  in order of (distance from the source + estimated distance to the destination), where the
+ *  estimate is given by the heuristic function (see graph_heuristic_t), called with 'data' as
+ *  its last parameter. The better the estimate, the fewer nodes get explored: for example 
+ *  landmark_heuristic() with a table from create_landmarks() (ALT), or a function based on 
+ *  the coordinates of the nodes. A NULL heuristic is the same as Dijkstra's Algorithm.
+ * 
+ *  The heuristic of each node is only computed the first time the node is reached, and
+ *  nodes are reopened if a shorter path to them is found, so the result is correct as long
+ *  as the heuristic never overestimates.
+ * 
+ *  The length of the path is stored in 'dist' (GRAPH_DIST_INF if the destination is
+ *  unreachable) and the function returns the list of the edge IDs (EIDs) of the path,
+ *  NULL if the path is empty or doesn't exist
+ */
+id_list_t * astar_search(graph_csr_t *csr, id_t src_nid, id_t dest_nid, graph_heuristic_t heuristic, void *data, graph_sssp_t *sssp, long int *dist)
+{
+    id_list_t *path;
+    int src, dest, u, v, e;
+    long int new_dist, estimate, best;
+    bool_t found;
+
+
+    path = NULL;
+    best = GRAPH_DIST_INF;
+    src = get_csr_index_from_id(csr, src_nid);
+    dest = get_csr_index_from_id(csr, dest_nid);
+
+    if (src == ERROR_INDEX || dest == ERROR_INDEX || sssp == NULL || sssp->node_count < csr->node_count)
+    {
+        printf("[astar_search()] ERROR: Invalid node IDs or workspace\n");
+    }
+    else if (csr->min_weight < 0)
+    {
+        printf("[astar_search()] ERROR: The A* Algorithm can only be applied on graphs with positive edge weights\n");
+    }
+    else
+    {
+        /* Initialization */
+        sssp_begin_search(sssp);
+        sssp_reach(sssp, src);
+
+        sssp->src = src;
+        sssp->dist[src] = 0;
+        estimate = heuristic ? heuristic(csr, src, dest, data) : 0;
+        found = false;
+
+        if (estimate != GRAPH_DIST_INF)
+        {
+            sssp_heap_push(sssp, src, estimate);
+        }
+
+        /* Beginning of algorithm */
+        while (sssp->heap_size > 0 && !found)
+        {
+            u = sssp_heap_pop(sssp);
+
+            if (u == dest)
+            {
+                found = true;
+            }
+            else
+            {
+                for (e = csr->offsets[u]; e < csr->offsets[u + 1]; e++)
+                {
+                    v = csr->targets[e];
+                    new_dist = sssp->dist[u] + csr->weights[e];
+                    sssp_reach(sssp, v);
+
+                    if (new_dist < sssp->dist[v])
+                    {
+                        /* The estimate of an already reached node is kept inside its heap key */
+                        if (sssp->dist[v] == GRAPH_DIST_INF)
+                        {
+                            estimate = heuristic ? heuristic(csr, v, dest, data) : 0;
+                        }
+                        else
+                        {
+                            estimate = (sssp->heap_key[v] == GRAPH_DIST_INF) ? GRAPH_DIST_INF : sssp->heap_key[v] - sssp->dist[v];
+                        }
+
+                        sssp->dist[v] = new_dist;
+                        sssp->prev_edge[v] = e;
+
+                        if (estimate == GRAPH_DIST_INF)
+                        {
+                            sssp->heap_key[v] = GRAPH_DIST_INF;
+                        }
+                        else
+                        {
+                            sssp_heap_push(sssp, v, new_dist + estimate);
+                        }
+                    }
+                }
+            }
+        }
+
+        if (found)
+        {
+            best = sssp->dist[dest];
+            path = get_sssp_path(csr, sssp, dest_nid);
+        }
+    }
+
+    if (dist)
+    {
+        *(dist) = best;
+    }
+
+    return path;
+}
+
+
+/*
+ *  Creates the landmarks table used by the ALT heuristic (A*, Landmarks, Triangle inequality)
+ *  choosing 'landmark_count' nodes with the farthest-point selection: the first landmark is the
+ *  node farthest from the first node of the view, and each following one is the node farthest 
+ *  from all the landmarks chosen so far (unreachable nodes count as the farthest ones, so that
+ *  every part of the graph gets covered). For each landmark, a Dijkstra search on the view and 
+ *  one on its transpose compute the distances from and to every node.
+ * 
+ *  The table only depends on the graph, so it can be saved with save_landmarks() and loaded 
+ *  again with load_landmarks() instead of repeating the preprocessing
+ */
+graph_landmarks_t * create_landmarks(graph_csr_t *csr, int landmark_count)
+{
+    graph_landmarks_t *landmarks;
+    graph_csr_t *reverse;
+    graph_sssp_t *sssp;
+    long int *min_dist;
+    bool_t *chosen;
+    int n, l, v, next;
+
+
+    landmarks = NULL;
+
+    if (csr && landmark_count > 0 && csr->min_weight >= 0)
+    {
+        n = csr->node_count;
+        landmark_count = (landmark_count < n) ? landmark_count : n;
+        reverse = create_graph_csr_transpose(csr);
+        sssp = create_sssp(n);
+        min_dist = NULL;
+        chosen = NULL;
+
+        if (
+            reverse && sssp
+            && ( min_dist = (long int*)malloc(sizeof(long int) * n) )
+            && ( chosen = (bool_t*)calloc(n, sizeof(bool_t)) )
+            && ( landmarks = (graph_landmarks_t*)calloc(1, sizeof(graph_landmarks_t)) )
+            && ( landmarks->landmarks = (int*)malloc(sizeof(int) * landmark_count) )
+            && ( landmarks->dist_from = (long int*)malloc(sizeof(long int) * n * landmark_count) )
+            && ( landmarks->dist_to = (long int*)malloc(sizeof(long int) * n * landmark_count) )
+        )
+        {
+            landmarks->node_count = n;
+            landmarks->landmark_count = landmark_count;
+
+            /* The first landmark is the farthest node from node 0 */
+            dijkstra_search(csr, NULL, sssp, 0);
+            next = 0;
+
+            for (v = 0; v < n; v++)
+            {
+                if (sssp_dist(sssp, v) != GRAPH_DIST_INF && sssp_dist(sssp, v) > sssp_dist(sssp, next))
+                {
+                    next = v;
+                }
+
+                min_dist[v] = GRAPH_DIST_INF;
+            }
+
+            for (l = 0; l < landmark_count; l++)
+            {
+                landmarks->landmarks[l] = next;
+                chosen[next] = true;
+
+                dijkstra_search(csr, NULL, sssp, next);
+
+                for (v = 0; v < n; v++)
+                {
+                    landmarks->dist_from[l + (v * landmark_count)] = sssp_dist(sssp, v);
+                }
+
+                dijkstra_search(reverse, NULL, sssp, next);
+
+                for (v = 0; v < n; v++)
+                {
+                    landmarks->dist_to[l + (v * landmark_count)] = sssp_dist(sssp, v);
+                }
+
+                /* Farthest-point selection of the next landmark */
+                next = ERROR_INDEX;
+
+                for (v = 0; v < n; v++)
+                {
+                    if (landmarks->dist_from[l + (v * landmark_count)] < min_dist[v])
+                    {
+                        min_dist[v] = landmarks->dist_from[l + (v * landmark_count)];
+                    }
+
+                    if (min_dist[v] > 0 && (next == ERROR_INDEX || min_dist[v] > min_dist[next]))
+                    {
+                        next = v;
+                    }
+                }
+
+                if (next == ERROR_INDEX)
+                {
+                    /* Every node is at distance 0 from a landmark, so any node not chosen yet will do */
+                    for (v = 0; v < n && next == ERROR_INDEX; v++)
+                    {
+                        if (!chosen[v])
+                        {
+                            next = v;
+                        }
+                    }
+                }
+            }
+        }
+        else
+        {
+            printf("[create_landmarks()] ERROR: Memory allocation was unsuccessful\n");
+            landmarks = delete_landmarks(landmarks);
+        }
+
+        free(min_dist);
+        free(chosen);
+        sssp = delete_sssp(sssp);
+        reverse = delete_graph_csr(reverse);
+    }
+    else if (csr && csr->min_weight < 0)
+    {
+        printf("[create_landmarks()] ERROR: Landmarks can only be computed on graphs with positive edge weights\n");
+    }
+
+    return landmarks;
+}
+
+
+/*
+ *  Deletes the given landmarks table
+ */
+graph_landmarks_t * delete_landmarks(graph_landmarks_t *landmarks)
+{
+    if (landmarks)
+    {
+        free(landmarks->landmarks);
+        free(landmarks->dist_from);
+        free(landmarks->dist_to);
+        free(landmarks);
+    }
+
+    return NULL;
+}
+
+
+/*
+ *  ALT heuristic for astar_search(), where 'data' must be a landmarks table of the same
+ *  graph. By the triangle inequality, for each landmark L:
+ * 
+ *      d(node, dest) >= d(L, dest) - d(L, node)
+ *      d(node, dest) >= d(node, L) - d(dest, L)
+ * 
+ *  and the estimate is the largest of these lower bounds. If a landmark proves that 'dest'
+ *  can't be reached from 'node' (e.g. 'node' can't reach L but 'dest' can), GRAPH_DIST_INF 
+ *  is returned so that A* doesn't explore 'node' at all
+ */
+long int landmark_heuristic(graph_csr_t *csr, int node, int dest, void *data)
+{
+    graph_landmarks_t *landmarks;
+    long int estimate, from_node, from_dest, to_node, to_dest;
+    int l, k;
+
+
+    landmarks = (graph_landmarks_t*)data;
+    estimate = 0;
+
+    if (landmarks && csr && landmarks->node_count == csr->node_count)
+    {
+        k = landmarks->landmark_count;
+
+        for (l = 0; l < k && estimate != GRAPH_DIST_INF; l++)
+        {
+            from_node = landmarks->dist_from[l + (node * k)];
+            from_dest = landmarks->dist_from[l + (dest * k)];
+            to_node = landmarks->dist_to[l + (node * k)];
+            to_dest = landmarks->dist_to[l + (dest * k)];
+
+            if (
+                (from_node != GRAPH_DIST_INF && from_dest == GRAPH_DIST_INF)
+                || (to_node == GRAPH_DIST_INF && to_dest != GRAPH_DIST_INF)
+            )
+            {
+                estimate = GRAPH_DIST_INF;
+            }
+            else
+            {
+                if (from_node != GRAPH_DIST_INF && from_dest - from_node > estimate)
+                {
+                    estimate = from_dest - from_node;
+                }
+
+                if (to_dest != GRAPH_DIST_INF && to_node - to_dest > estimate)
+                {
+                    estimate = to_node - to_dest;
+                }
+            }
+        }
+    }
+
+    return estimate;
+}
+
+
+/*
+ *  Helper function that appends an edge to the hierarchy under construction, growing its 
+ *  arrays when they are full, and links it to the outgoing list of 'src' and to the incoming
+ *  list of 'dest' (see create_graph_ch()). Returns false if the allocation was unsuccessful
+ */
+static bool_t ch_add_edge(graph_ch_t *ch, int *capacity, int src, int dest, long int weight, int first, int second, int csr_edge)
+{
+    int *sources, *targets, *children, *csr_edges, *up_edges, *down_edges;
+    long int *weights;
+    int e;
+
+
+    if (ch->edge_count == *capacity)
+    {
+        *capacity = 2 * (*capacity) + 1;
+
+        if (( sources = (int*)realloc(ch->sources, sizeof(int) * (*capacity)) ))
+        {
+            ch->sources = sources;
+        }
+
+        if (( targets = (int*)realloc(ch->targets, sizeof(int) * (*capacity)) ))
+        {
+            ch->targets = targets;
+        }
+
+        if (( weights = (long int*)realloc(ch->weights, sizeof(long int) * (*capacity)) ))
+        {
+            ch->weights = weights;
+        }
+
+        if (( children = (int*)realloc(ch->children, sizeof(int) * 2 * (*capacity)) ))
+        {
+            ch->children = children;
+        }
+
+        if (( csr_edges = (int*)realloc(ch->csr_edges, sizeof(int) * (*capacity)) ))
+        {
+            ch->csr_edges = csr_edges;
+        }
+
+        if (( up_edges = (int*)realloc(ch->up_edges, sizeof(int) * (*capacity)) ))
+        {
+            ch->up_edges = up_edges;
+        }
+
+        if (( down_edges = (int*)realloc(ch->down_edges, sizeof(int) * (*capacity)) ))
+        {
+            ch->down_edges = down_edges;
+        }
+
+        if (!(sources && targets && weights && children && csr_edges && up_edges && down_edges))
+        {
+            return false;
+        }
+    }
+
+    e = ch->edge_count;
+    ch->edge_count++;
+
+    ch->sources[e] = src;
+    ch->targets[e] = dest;
+    ch->weights[e] = weight;
+    ch->children[2 * e] = first;
+    ch->children[2 * e + 1] = second;
+    ch->csr_edges[e] = csr_edge;
+
+    ch->up_edges[e] = ch->up_offsets[src];
+    ch->up_offsets[src] = e;
+    ch->down_edges[e] = ch->down_offsets[dest];
+    ch->down_offsets[dest] = e;
+
+    return true;
+}
+
+
+/*
+ *  Helper function that removes from the outgoing and incoming lists of the node with
+ *  index 'v' the edges whose other endpoint has already been contracted
+ */
+static void ch_unlink_contracted(graph_ch_t *ch, int v)
+{
+    int *link;
+
+
+    for (link = &(ch->up_offsets[v]); *link != ERROR_INDEX; )
+    {
+        if (ch->rank[ch->targets[*link]] != ERROR_INDEX)
+        {
+            *link = ch->up_edges[*link];
+        }
+        else
+        {
+            link = &(ch->up_edges[*link]);
+        }
+    }
+
+    for (link = &(ch->down_offsets[v]); *link != ERROR_INDEX; )
+    {
+        if (ch->rank[ch->sources[*link]] != ERROR_INDEX)
+        {
+            *link = ch->down_edges[*link];
+        }
+        else
+        {
+            link = &(ch->down_edges[*link]);
+        }
+    }
+}
+
+
+/*
+ *  Helper function that runs the witness search of the contraction: a Dijkstra's Algorithm
+ *  from the node with index 'src' on the nodes not contracted yet, which ignores the node 
+ *  'skip' and stops after 'limit' distance or CH_WITNESS_SETTLE_LIMIT extracted nodes. 
+ *  Any node found within a distance is connected by a path that makes a shortcut useless
+ */
+static void ch_witness_search(graph_ch_t *ch, graph_sssp_t *sssp, int src, int skip, long int limit)
+{
+    int u, v, e, settled;
+    long int new_dist;
+
+
+    sssp_begin_search(sssp);
+    sssp_reach(sssp, src);
+
+    sssp->dist[src] = 0;
+    sssp_heap_push(sssp, src, 0);
+    settled = 0;
+
+    while (sssp->heap_size > 0 && settled < CH_WITNESS_SETTLE_LIMIT)
+    {
+        u = sssp_heap_pop(sssp);
+        settled++;
+
+        if (sssp->dist[u] > limit)
+        {
+            settled = CH_WITNESS_SETTLE_LIMIT;
+        }
+        else
+        {
+            for (e = ch->up_offsets[u]; e != ERROR_INDEX; e = ch->up_edges[e])
+            {
+                v = ch->targets[e];
+
+                if (v != skip && ch->rank[v] == ERROR_INDEX)
+                {
+                    new_dist = sssp->dist[u] + ch->weights[e];
+                    sssp_reach(sssp, v);
+
+                    if (new_dist < sssp->dist[v])
+                    {
+                        sssp->dist[v] = new_dist;
+                        sssp_heap_push(sssp, v, new_dist);
+                    }
+                }
+            }
+        }
+    }
+}
+
+
+/*
+ *  Helper function that contracts the node with index 'w': for every pair of edges u -> w -> v
+ *  without a witness path, a shortcut u -> v is added. If 'simulate' is true the shortcuts are
+ *  only counted, otherwise they're added to the hierarchy. Returns the amount of shortcuts,
+ *  or ERROR_INDEX if the allocation of a shortcut was unsuccessful
+ */
+static int ch_contract(graph_ch_t *ch, graph_sssp_t *sssp, int *capacity, int w, bool_t simulate)
+{
+    int in, out, u, v, count;
+    long int limit;
+
+
+    count = 0;
+
+    for (in = ch->down_offsets[w]; in != ERROR_INDEX && count != ERROR_INDEX; in = ch->down_edges[in])
+    {
+        u = ch->sources[in];
+        limit = 0;
+
+        for (out = ch->up_offsets[w]; out != ERROR_INDEX; out = ch->up_edges[out])
+        {
+            if (ch->targets[out] != u && ch->weights[out] > limit)
+            {
+                limit = ch->weights[out];
+            }
+        }
+
+        ch_witness_search(ch, sssp, u, w, ch->weights[in] + limit);
+
+        for (out = ch->up_offsets[w]; out != ERROR_INDEX && count != ERROR_INDEX; out = ch->up_edges[out])
+        {
+            v = ch->targets[out];
+
+            if (v != u && sssp_dist(sssp, v) > ch->weights[in] + ch->weights[out])
+            {
+                if (simulate)
+                {
+                    count++;
+                }
+                else if (ch_add_edge(ch, capacity, u, v, ch->weights[in] + ch->weights[out], in, out, ERROR_INDEX))
+                {
+                    count++;
+                    ch->shortcut_count++;
+                }
+                else
+                {
+                    count = ERROR_INDEX;
+                }
+            }
+        }
+    }
+
+    return count;
+}
+
+
+/*
+ *  Helper function that returns the contraction priority of the node with index 'w' (the
+ *  lower, the sooner it gets contracted): its edge difference, meaning the shortcuts that its
+ *  contraction would add minus the edges it would remove, plus the amount of its neighbours 
+ *  already contracted, which spreads the contractions uniformly across the graph
+ */
+static long int ch_priority(graph_ch_t *ch, graph_sssp_t *sssp, int *deleted_neighbours, int w)
+{
+    int e, degree;
+
+
+    degree = 0;
+
+    for (e = ch->up_offsets[w]; e != ERROR_INDEX; e = ch->up_edges[e])
+    {
+        degree++;
+    }
+
+    for (e = ch->down_offsets[w]; e != ERROR_INDEX; e = ch->down_edges[e])
+    {
+        degree++;
+    }
+
+    return (long int)ch_contract(ch, sssp, NULL, w, true) - degree + deleted_neighbours[w];
+}
+
+
+/*
+ *  Helper function that replaces the outgoing and incoming lists used during the contraction
+ *  with the upward and downward graphs of the hierarchy (see graph_ch_t), stored like the
+ *  compact views. Returns false if the allocation was unsuccessful
+ */
+static bool_t ch_build_search_graphs(graph_ch_t *ch)
+{
+    int *up_offsets, *up_edges, *down_offsets, *down_edges;
+    int n, e, v;
+
+
+    n = ch->node_count;
+    up_edges = NULL;
+    down_offsets = NULL;
+    down_edges = NULL;
+
+    if (
+        ( up_offsets = (int*)calloc(n + 1, sizeof(int)) )
+        && ( down_offsets = (int*)calloc(n + 1, sizeof(int)) )
+        && ( up_edges = (int*)malloc(sizeof(int) * (ch->edge_count + 1)) )
+        && ( down_edges = (int*)malloc(sizeof(int) * (ch->edge_count + 1)) )
+    )
+    {
+        for (e = 0; e < ch->edge_count; e++)
+        {
+            if (ch->rank[ch->sources[e]] < ch->rank[ch->targets[e]])
+            {
+                up_offsets[ch->sources[e] + 1]++;
+            }
+            else
+            {
+                down_offsets[ch->targets[e] + 1]++;
+            }
+        }
+
+        for (v = 0; v < n; v++)
+        {
+            up_offsets[v + 1] += up_offsets[v];
+            down_offsets[v + 1] += down_offsets[v];
+        }
+
+        /* The offsets are used as insertion cursors, then shifted back */
+        for (e = 0; e < ch->edge_count; e++)
+        {
+            if (ch->rank[ch->sources[e]] < ch->rank[ch->targets[e]])
+            {
+                up_edges[up_offsets[ch->sources[e]]] = e;
+                up_offsets[ch->sources[e]]++;
+            }
+            else
+            {
+                down_edges[down_offsets[ch->targets[e]]] = e;
+                down_offsets[ch->targets[e]]++;
+            }
+        }
+
+        for (v = n; v > 0; v--)
+        {
+            up_offsets[v] = up_offsets[v - 1];
+            down_offsets[v] = down_offsets[v - 1];
+        }
+
+        up_offsets[0] = 0;
+        down_offsets[0] = 0;
+
+        free(ch->up_offsets);
+        free(ch->up_edges);
+        free(ch->down_offsets);
+        free(ch->down_edges);
+
+        ch->up_offsets = up_offsets;
+        ch->up_edges = up_edges;
+        ch->down_offsets = down_offsets;
+        ch->down_edges = down_edges;
+
+        return true;
+    }
+
+    free(up_offsets);
+    free(up_edges);
+    free(down_offsets);
+    free(down_edges);
+
+    return false;
+}
+
+
+/*
+ *  Creates the Contraction Hierarchy of the given compact view, which answers shortest path
+ *  queries (see ch_query()) orders of magnitude faster than Dijkstra's Algorithm on large 
+ *  sparse graphs such as road networks.
+ * 
+ *  The nodes are contracted one at a time in order of priority (see ch_priority()), kept in a
+ *  binary heap with lazy updates: the priority of the extracted node is computed again, and if
+ *  it's no longer the smallest the node is pushed back (recomputing the priorities of all the 
+ *  neighbours after every contraction gives a similar order at several times the cost).
+ *  Contracting a node works like vertex_contraction() without modifying the graph: the node
+ *  is ranked and its paths u -> w -> v are preserved by shortcuts, unless a witness search 
+ *  finds a path u -> v that isn't longer.
+ * 
+ *  During the contraction, the upward and downward arrays hold the outgoing and incoming 
+ *  lists of the nodes still to be contracted (offsets = first edge, edges = next edge)
+ */
+graph_ch_t * create_graph_ch(graph_csr_t *csr)
+{
+    graph_ch_t *ch;
+    graph_sssp_t *witness, *order;
+    int *deleted_neighbours, *mark;
+    int n, capacity, level, e, w, x;
+    long int priority;
+    bool_t allocated;
+
+
+    ch = NULL;
+
+    if (csr && csr->min_weight < 0)
+    {
+        printf("[create_graph_ch()] ERROR: Contraction Hierarchies can only be applied on graphs with positive edge weights\n");
+    }
+    else if (csr)
+    {
+        n = csr->node_count;
+        capacity = csr->edge_count;
+        witness = create_sssp(n);
+        order = create_sssp(n);
+        deleted_neighbours = NULL;
+        mark = NULL;
+        allocated = false;
+
+        if (
+            witness && order
+            && ( deleted_neighbours = (int*)calloc(n + 1, sizeof(int)) )
+            && ( mark = (int*)malloc(sizeof(int) * (n + 1)) )
+            && ( ch = (graph_ch_t*)calloc(1, sizeof(graph_ch_t)) )
+            && ( ch->rank = (int*)malloc(sizeof(int) * (n + 1)) )
+            && ( ch->up_offsets = (int*)malloc(sizeof(int) * (n + 1)) )
+            && ( ch->down_offsets = (int*)malloc(sizeof(int) * (n + 1)) )
+            && ( ch->sources = (int*)malloc(sizeof(int) * (capacity + 1)) )
+            && ( ch->targets = (int*)malloc(sizeof(int) * (capacity + 1)) )
+            && ( ch->weights = (long int*)malloc(sizeof(long int) * (capacity + 1)) )
+            && ( ch->children = (int*)malloc(sizeof(int) * 2 * (capacity + 1)) )
+            && ( ch->csr_edges = (int*)malloc(sizeof(int) * (capacity + 1)) )
+            && ( ch->up_edges = (int*)malloc(sizeof(int) * (capacity + 1)) )
+            && ( ch->down_edges = (int*)malloc(sizeof(int) * (capacity + 1)) )
+        )
+        {
+            ch->node_count = n;
+            capacity++;
+            allocated = true;
+
+            for (w = 0; w < n; w++)
+            {
+                ch->rank[w] = ERROR_INDEX;
+                ch->up_offsets[w] = ERROR_INDEX;
+                ch->down_offsets[w] = ERROR_INDEX;
+                mark[w] = ERROR_INDEX;
+            }
+
+            /* The edges of the view (self loops are never part of a shortest path) */
+            for (e = 0; e < csr->edge_count; e++)
+            {
+                if (csr->sources[e] != csr->targets[e])
+                {
+                    ch_add_edge(ch, &capacity, csr->sources[e], csr->targets[e], csr->weights[e], ERROR_INDEX, ERROR_INDEX, e);
+                }
+            }
+
+            /* Initial priorities */
+            sssp_begin_search(order);
+
+            for (w = 0; w < n; w++)
+            {
+                sssp_reach(order, w);
+                sssp_heap_push(order, w, ch_priority(ch, witness, deleted_neighbours, w));
+            }
+
+            /* Contraction */
+            level = 0;
+
+            while (order->heap_size > 0 && allocated)
+            {
+                w = sssp_heap_pop(order);
+                priority = ch_priority(ch, witness, deleted_neighbours, w);
+
+                if (order->heap_size > 0 && priority > order->heap_key[order->queue[0]])
+                {
+                    sssp_heap_push(order, w, priority);
+                }
+                else if (ch_contract(ch, witness, &capacity, w, false) == ERROR_INDEX)
+                {
+                    allocated = false;
+                }
+                else
+                {
+                    ch->rank[w] = level;
+                    level++;
+
+                    /* The priorities of the neighbours are only updated when they get extracted */
+                    for (e = ch->up_offsets[w]; e != ERROR_INDEX; e = ch->up_edges[e])
+                    {
+                        x = ch->targets[e];
+
+                        if (mark[x] != w)
+                        {
+                            mark[x] = w;
+                            deleted_neighbours[x]++;
+                            ch_unlink_contracted(ch, x);
+                        }
+                    }
+
+                    for (e = ch->down_offsets[w]; e != ERROR_INDEX; e = ch->down_edges[e])
+                    {
+                        x = ch->sources[e];
+
+                        if (mark[x] != w)
+                        {
+                            mark[x] = w;
+                            deleted_neighbours[x]++;
+                            ch_unlink_contracted(ch, x);
+                        }
+                    }
+                }
+            }
+
+            allocated = allocated && ch_build_search_graphs(ch);
+        }
+
+        if (!allocated)
+        {
+            printf("[create_graph_ch()] ERROR: Memory allocation was unsuccessful\n");
+            ch = delete_graph_ch(ch);
+        }
+
+        free(deleted_neighbours);
+        free(mark);
+        witness = delete_sssp(witness);
+        order = delete_sssp(order);
+    }
+
+    return ch;
+}
+
+
+/*
+ *  Deletes the given Contraction Hierarchy
+ */
+graph_ch_t * delete_graph_ch(graph_ch_t *ch)
+{
+    if (ch)
+    {
+        free(ch->rank);
+        free(ch->sources);
+        free(ch->targets);
+        free(ch->weights);
+        free(ch->children);
+        free(ch->csr_edges);
+        free(ch->up_offsets);
+        free(ch->up_edges);
+        free(ch->down_offsets);
+        free(ch->down_edges);
+        free(ch);
+    }
+
+    return NULL;
+}
+
+
+/*
+ *  Helper function that advances one of the two upward searches of ch_query() by one node.
+ *  The forward search follows the upward graph, while the backward search follows the
+ *  downward graph in reverse. A node is "stalled" (its edges aren't relaxed) when a higher 
+ *  ranked node already reached by the same search proves that its distance isn't optimal
+ */
+static void ch_query_step(graph_ch_t *ch, graph_sssp_t *sssp, graph_sssp_t *other, bool_t upward, long int *best, int *meet)
+{
+    const int *offsets, *edges, *stall_offsets, *stall_edges, *heads, *stall_heads;
+    int u, v, e, i;
+    long int new_dist;
+    bool_t stalled;
+
+
+    offsets = upward ? ch->up_offsets : ch->down_offsets;
+    edges = upward ? ch->up_edges : ch->down_edges;
+    heads = upward ? ch->targets : ch->sources;
+    stall_offsets = upward ? ch->down_offsets : ch->up_offsets;
+    stall_edges = upward ? ch->down_edges : ch->up_edges;
+    stall_heads = upward ? ch->sources : ch->targets;
+
+    u = sssp_heap_pop(sssp);
+    stalled = false;
+
+    for (i = stall_offsets[u]; i < stall_offsets[u + 1] && !stalled; i++)
+    {
+        e = stall_edges[i];
+        stalled = (sssp_dist(sssp, stall_heads[e]) != GRAPH_DIST_INF && sssp->dist[stall_heads[e]] + ch->weights[e] < sssp->dist[u]);
+    }
+
+    for (i = offsets[u]; i < offsets[u + 1] && !stalled; i++)
+    {
+        e = edges[i];
+        v = heads[e];
+        new_dist = sssp->dist[u] + ch->weights[e];
+        sssp_reach(sssp, v);
+
+        if (new_dist < sssp->dist[v])
+        {
+            sssp->dist[v] = new_dist;
+            sssp->prev_edge[v] = e;
+            sssp_heap_push(sssp, v, new_dist);
+        }
+
+        if (sssp_dist(other, v) != GRAPH_DIST_INF && sssp->dist[v] + other->dist[v] < *best)
+        {
+            *best = sssp->dist[v] + other->dist[v];
+            *meet = v;
+        }
+    }
+}
+
+
+/*
+ *  Helper function that pushes in front of 'path' the EIDs of the edges of the compact view
+ *  replaced by the edge 'e' of the hierarchy, expanding the shortcuts recursively
+ */
+static id_list_t * ch_unpack_edge(graph_csr_t *csr, graph_ch_t *ch, int e, id_list_t *path)
+{
+    if (ch->csr_edges[e] != ERROR_INDEX)
+    {
+        path = push_id(path, csr->edges[ch->csr_edges[e]]->id);
+    }
+    else
+    {
+        path = ch_unpack_edge(csr, ch, ch->children[2 * e + 1], path);
+        path = ch_unpack_edge(csr, ch, ch->children[2 * e], path);
+    }
+
+    return path;
+}
+
+
+/*
+ *  Computes the shortest path from the node with ID 'src_nid' to the node with ID 'dest_nid' 
+ *  on the Contraction Hierarchy of the compact view (see create_graph_ch()). A forward search
+ *  from the source and a backward search from the destination only move towards higher ranked
+ *  nodes, so each one explores a few hundred nodes even on huge graphs; every search stops 
+ *  when its closest node is farther than the best path found through a node reached by both.
+ *  The shortcuts of the resulting path are then expanded into the edges of the view.
+ * 
+ *  The two workspaces keep the state of the searches, so the view and the hierarchy are only 
+ *  read. The length of the path is stored in 'dist' (GRAPH_DIST_INF if the destination is 
+ *  unreachable) and the function returns the list of the edge IDs (EIDs) of the path,
+ *  NULL if the path is empty or doesn't exist
+ */
+id_list_t * ch_query(graph_csr_t *csr, graph_ch_t *ch, id_t src_nid, id_t dest_nid, graph_sssp_t *forward, graph_sssp_t *backward, long int *dist)
+{
+    id_list_t *path;
+    int src, dest, meet, v, e, count;
+    long int best;
+    bool_t forward_open, backward_open;
+
+
+    path = NULL;
+    best = GRAPH_DIST_INF;
+    src = get_csr_index_from_id(csr, src_nid);
+    dest = get_csr_index_from_id(csr, dest_nid);
+
+    if (
+        src == ERROR_INDEX || dest == ERROR_INDEX || ch == NULL || ch->node_count != csr->node_count 
+        || forward == NULL || forward->node_count < csr->node_count 
+        || backward == NULL || backward->node_count < csr->node_count
+    )
+    {
+        printf("[ch_query()] ERROR: Invalid node IDs, hierarchy or workspaces\n");
+    }
+    else
+    {
+        /* Initialization */
+        sssp_begin_search(forward);
+        sssp_begin_search(backward);
+        sssp_reach(forward, src);
+        sssp_reach(backward, dest);
+
+        forward->src = src;
+        forward->dist[src] = 0;
+        sssp_heap_push(forward, src, 0);
+
+        backward->src = dest;
+        backward->dist[dest] = 0;
+        sssp_heap_push(backward, dest, 0);
+
+        meet = (src == dest) ? src : ERROR_INDEX;
+        best = (src == dest) ? 0 : GRAPH_DIST_INF;
+        forward_open = true;
+        backward_open = true;
+
+        /* Beginning of algorithm */
+        while (forward_open || backward_open)
+        {
+            forward_open = (forward->heap_size > 0 && forward->dist[forward->queue[0]] < best);
+            backward_open = (backward->heap_size > 0 && backward->dist[backward->queue[0]] < best);
+
+            if (forward_open && (!backward_open || forward->dist[forward->queue[0]] <= backward->dist[backward->queue[0]]))
+            {
+                ch_query_step(ch, forward, backward, true, &best, &meet);
+            }
+            else if (backward_open)
+            {
+                ch_query_step(ch, backward, forward, false, &best, &meet);
+            }
+        }
+
+        if (meet != ERROR_INDEX)
+        {
+            /* Same order of bidirectional_dijkstra(): the backward half first, then the forward one */
+            count = 0;
+
+            for (v = meet; backward->prev_edge[v] != ERROR_INDEX; v = ch->targets[e])
+            {
+                e = backward->prev_edge[v];
+                backward->queue[count] = e;
+                count++;
+            }
+
+            while (count > 0)
+            {
+                count--;
+                path = ch_unpack_edge(csr, ch, backward->queue[count], path);
+            }
+
+            for (v = meet; forward->prev_edge[v] != ERROR_INDEX; v = ch->sources[e])
+            {
+                e = forward->prev_edge[v];
+                path = ch_unpack_edge(csr, ch, e, path);
+            }
+        }
+    }
+
+    if (dist)
+    {
+        *(dist) = best;
+    }
+
+    return path;
+}
+
+
+/*
+ *  Helper function that runs Dijkstra's Algorithm from the node with index 'src' until the node
+ *  'dest' is extracted, ignoring the nodes and the edges whose bit is set in the given masks
+ *  (either mask can be NULL). Returns the distance of 'dest' (GRAPH_DIST_INF if unreachable)
+ */
+static long int masked_dijkstra_search(graph_csr_t *csr, graph_sssp_t *sssp, int src, int dest, const bitset_word_t *node_mask, const bitset_word_t *edge_mask)
+{
+    int u, v, e;
+    long int new_dist;
+
+
+    sssp_begin_search(sssp);
+    sssp_reach(sssp, src);
+
+    sssp->src = src;
+    sssp->dist[src] = 0;
+    sssp_heap_push(sssp, src, 0);
+    u = ERROR_INDEX;
+
+    while (sssp->heap_size > 0 && u != dest)
+    {
+        u = sssp_heap_pop(sssp);
+
+        for (e = csr->offsets[u]; e < csr->offsets[u + 1] && u != dest; e++)
+        {
+            v = csr->targets[e];
+
+            if (!(edge_mask && BITSET_GET(edge_mask, e)) && !(node_mask && BITSET_GET(node_mask, v)))
+            {
+                new_dist = sssp->dist[u] + csr->weights[e];
+                sssp_reach(sssp, v);
+
+                if (new_dist < sssp->dist[v])
+                {
+                    sssp->dist[v] = new_dist;
+                    sssp->prev_edge[v] = e;
+                    sssp_heap_push(sssp, v, new_dist);
+                }
+            }
+        }
+    }
+
+    return sssp_dist(sssp, dest);
+}
+
+
+/*
+ *  Helper function that moves the candidate stored at position 'pos' of the candidates heap
+ *  of Yen's Algorithm towards the root, until its parent has a smaller (or equal) cost
+ */
+static void yen_heap_sift_up(int *heap, const long int *costs, int pos)
+{
+    int candidate;
+
+
+    candidate = heap[pos];
+
+    while (pos > 0 && costs[heap[(pos - 1) / 2]] > costs[candidate])
+    {
+        heap[pos] = heap[(pos - 1) / 2];
+        pos = (pos - 1) / 2;
+    }
+
+    heap[pos] = candidate;
+}
+
+
+/*
+ *  Helper function that removes and returns the cheapest candidate 
+ *  from the candidates heap of Yen's Algorithm
+ */
+static int yen_heap_pop(int *heap, const long int *costs, int *size)
+{
+    int top, candidate, pos, child;
+
+
+    top = heap[0];
+    (*size)--;
+    candidate = heap[*size];
+    pos = 0;
+    child = 1;
+
+    while (child < *size)
+    {
+        if (child + 1 < *size && costs[heap[child + 1]] < costs[heap[child]])
+        {
+            child++;
+        }
+
+        if (costs[heap[child]] < costs[candidate])
+        {
+            heap[pos] = heap[child];
+            pos = child;
+            child = 2 * pos + 1;
+        }
+        else
+        {
+            child = *size;
+        }
+    }
+
+    heap[pos] = candidate;
+
+    return top;
+}
+
+
+/*
+ *  Deletes the given set of paths
+ */
+graph_paths_t * delete_graph_paths(graph_paths_t *paths)
+{
+    int i;
+
+
+    if (paths)
+    {
+        for (i = 0; paths->paths && i < paths->count; i++)
+        {
+            paths->paths[i] = delete_all_revoked_id(paths->paths[i]);
+        }
+
+        free(paths->paths);
+        free(paths->dists);
+        free(paths);
+    }
+
+    return NULL;
+}
+
+
+/*
+ *  Computes the 'k' shortest loopless paths from the node with ID 'src_nid' to the node with
+ *  ID 'dest_nid' using Yen's Algorithm: every new path is the cheapest candidate obtained by 
+ *  leaving one of the previous paths at some spur node, and reaching the destination with a 
+ *  spur search that can't use the nodes of the root path (which keeps the paths loopless) nor
+ *  the edges taken at the spur node by the paths sharing the same root. The candidates are 
+ *  kept in a binary heap ordered by cost.
+ * 
+ *  Instead of removing nodes and edges from the graph, the spur searches skip the ones whose
+ *  bit is set in two bitsets, and only the bits set for a search are cleared afterwards. The
+ *  many searches also share the same workspace, whose epoch stamps avoid any reset, so the
+ *  cost of a spur search only depends on the nodes it explores.
+ * 
+ *  Returns the paths (at most 'k', sorted by length) as lists of edge IDs (EIDs), or NULL if
+ *  the parameters are invalid or the destination is unreachable
+ */
+graph_paths_t * yen_k_shortest_paths(graph_csr_t *csr, id_t src_nid, id_t dest_nid, int k, graph_sssp_t *sssp)
+{
+    graph_paths_t *result;
+    bitset_word_t *node_mask, *edge_mask;
+    int **paths, *lengths, *heap, *edges, *swap, *grown_lengths, *grown_heap, **grown_paths;
+    long int *costs, *grown_costs, cost, root_cost, spur_cost;
+    int src, dest, found, count, capacity, heap_size, len, i, j, p, v, c, spur, best;
+    bool_t same_root, duplicate, allocated;
+
+
+    result = NULL;
+    src = get_csr_index_from_id(csr, src_nid);
+    dest = get_csr_index_from_id(csr, dest_nid);
+
+    if (src == ERROR_INDEX || dest == ERROR_INDEX || k <= 0 || sssp == NULL || sssp->node_count < csr->node_count)
+    {
+        printf("[yen_k_shortest_paths()] ERROR: Invalid node IDs, amount of paths or workspace\n");
+        return NULL;
+    }
+
+    if (csr->min_weight < 0)
+    {
+        printf("[yen_k_shortest_paths()] ERROR: Yen's Algorithm can only be applied on graphs with positive edge weights\n");
+        return NULL;
+    }
+
+    /* 
+     *  Every path (found or candidate) is stored as an array of edge indices of the view,
+     *  the first 'found' ones being the accepted paths in order of cost
+     */
+    capacity = k + 1;
+    paths = NULL;
+    lengths = NULL;
+    costs = NULL;
+    heap = NULL;
+    edges = NULL;
+    node_mask = NULL;
+    edge_mask = NULL;
+    allocated = false;
+
+    if (
+        ( paths = (int**)calloc(capacity, sizeof(int*)) )
+        && ( lengths = (int*)malloc(sizeof(int) * capacity) )
+        && ( costs = (long int*)malloc(sizeof(long int) * capacity) )
+        && ( heap = (int*)malloc(sizeof(int) * capacity) )
+        && ( edges = (int*)malloc(sizeof(int) * (csr->node_count + 1)) )
+        && ( node_mask = (bitset_word_t*)calloc(BITSET_WORDS(csr->node_count), sizeof(bitset_word_t)) )
+        && ( edge_mask = (bitset_word_t*)calloc(BITSET_WORDS(csr->edge_count), sizeof(bitset_word_t)) )
+    )
+    {
+        allocated = true;
+        found = 0;
+        count = 0;
+        heap_size = 0;
+
+        /* The shortest path is the first candidate */
+        if (masked_dijkstra_search(csr, sssp, src, dest, NULL, NULL) != GRAPH_DIST_INF)
+        {
+            for (len = 0, v = dest; sssp->prev_edge[v] != ERROR_INDEX; v = csr->sources[sssp->prev_edge[v]])
+            {
+                len++;
+            }
+
+            if (( paths[0] = (int*)malloc(sizeof(int) * (len + 1)) ))
+            {
+                for (i = len - 1, v = dest; i >= 0; i--, v = csr->sources[sssp->prev_edge[v]])
+                {
+                    paths[0][i] = sssp->prev_edge[v];
+                }
+
+                lengths[0] = len;
+                costs[0] = sssp->dist[dest];
+                heap[0] = 0;
+                heap_size = 1;
+                count = 1;
+            }
+            else
+            {
+                allocated = false;
+            }
+        }
+
+        while (found < k && heap_size > 0 && allocated)
+        {
+            /* The cheapest candidate is accepted, moving it right after the previous accepted paths */
+            best = yen_heap_pop(heap, costs, &heap_size);
+
+            for (i = 0; i < heap_size; i++)
+            {
+                heap[i] = (heap[i] == found) ? best : heap[i];
+            }
+
+            len = lengths[found];
+            lengths[found] = lengths[best];
+            lengths[best] = len;
+            cost = costs[found];
+            costs[found] = costs[best];
+            costs[best] = cost;
+            swap = paths[found];
+            paths[found] = paths[best];
+            paths[best] = swap;
+            found++;
+
+            /* Spur searches from every node of the last accepted path (except the destination) */
+            root_cost = 0;
+
+            for (j = 0; j < lengths[found - 1] && found < k && allocated; j++)
+            {
+                spur = csr->sources[paths[found - 1][j]];
+
+                for (p = 0; p < found; p++)
+                {
+                    for (i = 0, same_root = (lengths[p] > j); i < j && same_root; i++)
+                    {
+                        same_root = (paths[p][i] == paths[found - 1][i]);
+                    }
+
+                    if (same_root)
+                    {
+                        BITSET_SET(edge_mask, paths[p][j]);
+                    }
+                }
+
+                for (i = 0; i < j; i++)
+                {
+                    BITSET_SET(node_mask, csr->sources[paths[found - 1][i]]);
+                }
+
+                spur_cost = masked_dijkstra_search(csr, sssp, spur, dest, node_mask, edge_mask);
+
+                if (spur_cost != GRAPH_DIST_INF)
+                {
+                    /* Root path + spur path */
+                    for (i = 0; i < j; i++)
+                    {
+                        edges[i] = paths[found - 1][i];
+                    }
+
+                    for (len = j, v = dest; sssp->prev_edge[v] != ERROR_INDEX; v = csr->sources[sssp->prev_edge[v]])
+                    {
+                        len++;
+                    }
+
+                    for (i = len - 1, v = dest; i >= j; i--, v = csr->sources[sssp->prev_edge[v]])
+                    {
+                        edges[i] = sssp->prev_edge[v];
+                    }
+
+                    for (c = found, duplicate = false; c < count && !duplicate; c++)
+                    {
+                        if (lengths[c] == len && costs[c] == root_cost + spur_cost)
+                        {
+                            for (i = 0, duplicate = true; i < len && duplicate; i++)
+                            {
+                                duplicate = (paths[c][i] == edges[i]);
+                            }
+                        }
+                    }
+
+                    if (!duplicate)
+                    {
+                        if (count == capacity)
+                        {
+                            capacity *= 2;
+
+                            if (( grown_paths = (int**)realloc(paths, sizeof(int*) * capacity) ))
+                            {
+                                paths = grown_paths;
+                            }
+
+                            if (( grown_lengths = (int*)realloc(lengths, sizeof(int) * capacity) ))
+                            {
+                                lengths = grown_lengths;
+                            }
+
+                            if (( grown_costs = (long int*)realloc(costs, sizeof(long int) * capacity) ))
+                            {
+                                costs = grown_costs;
+                            }
+
+                            if (( grown_heap = (int*)realloc(heap, sizeof(int) * capacity) ))
+                            {
+                                heap = grown_heap;
+                            }
+
+                            allocated = (grown_paths && grown_lengths && grown_costs && grown_heap);
+                        }
+
+                        if (allocated && ( paths[count] = (int*)malloc(sizeof(int) * (len + 1)) ))
+                        {
+                            memcpy(paths[count], edges, sizeof(int) * len);
+                            lengths[count] = len;
+                            costs[count] = root_cost + spur_cost;
+                            heap[heap_size] = count;
+                            heap_size++;
+                            yen_heap_sift_up(heap, costs, heap_size - 1);
+                            count++;
+                        }
+                        else
+                        {
+                            allocated = false;
+                        }
+                    }
+                }
+
+                /* Only the bits set for this search are cleared */
+                for (p = 0; p < found; p++)
+                {
+                    if (lengths[p] > j)
+                    {
+                        BITSET_CLEAR(edge_mask, paths[p][j]);
+                    }
+                }
+
+                for (i = 0; i < j; i++)
+                {
+                    BITSET_CLEAR(node_mask, csr->sources[paths[found - 1][i]]);
+                }
+
+                root_cost += csr->weights[paths[found - 1][j]];
+            }
+        }
+
+        /* Conversion of the accepted paths to lists of EIDs */
+        if (allocated && found > 0 && ( result = (graph_paths_t*)calloc(1, sizeof(graph_paths_t)) ))
+        {
+            if (
+                ( result->paths = (id_list_t**)calloc(found, sizeof(id_list_t*)) )
+                && ( result->dists = (long int*)malloc(sizeof(long int) * found) )
+            )
+            {
+                result->count = found;
+
+                for (p = 0; p < found; p++)
+                {
+                    result->dists[p] = costs[p];
+
+                    for (i = lengths[p] - 1; i >= 0; i--)
+                    {
+                        result->paths[p] = push_id(result->paths[p], csr->edges[paths[p][i]]->id);
+                    }
+                }
+            }
+            else
+            {
+                allocated = false;
+                result = delete_graph_paths(result);
+            }
+        }
+
+        for (i = 0; i < count; i++)
+        {
+            free(paths[i]);
+        }
+    }
+
+    if (!allocated)
+    {
+        printf("[yen_k_shortest_paths()] ERROR: Memory allocation was unsuccessful\n");
+    }
+
+    free(paths);
+    free(lengths);
+    free(costs);
+    free(heap);
+    free(edges);
+    free(node_mask);
+    free(edge_mask);
+
+    return result;
+}
+
+
+/*
+ *  Helper function that splits the rows of a compact view into 'parts' ranges with about
+ *  the same amount of work (rows + edges), so that each thread gets a contiguous range even
+ *  when the degrees are very skewed. The range of part p goes from bounds[p] to bounds[p + 1]
+ */
+static void partition_rows(graph_csr_t *csr, int parts, int *bounds)
+{
+    long int total, target;
+    int p, low, high, mid;
+
+
+    total = (long int)csr->node_count + csr->edge_count;
+    bounds[0] = 0;
+
+    for (p = 1; p < parts; p++)
+    {
+        target = (total * p) / parts;
+        low = bounds[p - 1];
+        high = csr->node_count;
+
+        /* First row whose work prefix reaches the target */
+        while (low < high)
+        {
+            mid = low + (high - low) / 2;
+
+            if ((long int)mid + csr->offsets[mid] < target)
+            {
+                low = mid + 1;
+            }
+            else
+            {
+                high = mid;
+            }
+        }
+
+        bounds[p] = low;
+    }
+
+    bounds[parts] = csr->node_count;
+}
+
+
+/*
+ *  Computes the PageRank of every node of the compact view with the power iteration:
+ * 
+ *      rank'(v) = (1 - damping) / n + damping * (sum of rank(u) / out_degree(u) for u -> v + dangling / n)
+ * 
+ *  where 'dangling' is the total rank of the nodes without outward edges, which is spread 
+ *  uniformly instead of being lost. Every iteration is a sparse matrix-vector product over the 
+ *  rows of the transpose view, on float arrays: the contributions rank(u) / out_degree(u) are 
+ *  computed once per iteration, so each row is a plain sum of gathered values. The rows are 
+ *  split among the threads in ranges of equal work (see partition_rows()), and the sums are
+ *  accumulated in double precision to keep the residual meaningful on large graphs.
+ * 
+ *  The iterations stop when the L1 distance between two consecutive rank vectors is below
+ *  'tolerance', or after 'max_iterations'. If 'report' is true, the residual and the time of
+ *  every iteration are printed, which helps estimating the cost on larger graphs.
+ * 
+ *  NOTE: The edge weights are ignored, and parallel edges count as many times as they appear
+ * 
+ *  Returns the array of the ranks (summing to 1) indexed by node index, NULL on error
+ */
+float * pagerank(graph_csr_t *csr, float damping, float tolerance, int max_iterations, bool_t report)
+{
+    graph_csr_t *transpose;
+    float *rank, *next, *contrib, *swap;
+    int *bounds;
+    int n, threads, iteration, t, u, v, e;
+    double residual, dangling, sum, start;
+
+
+    rank = NULL;
+
+    if (csr == NULL || csr->node_count == 0 || damping < 0 || damping >= 1)
+    {
+        printf("[pagerank()] ERROR: Invalid compact view or damping factor\n");
+        return NULL;
+    }
+
+    n = csr->node_count;
+    threads = get_thread_count();
+    transpose = create_graph_csr_transpose(csr);
+    next = NULL;
+    contrib = NULL;
+    bounds = NULL;
+
+    if (
+        transpose
+        && ( rank = (float*)malloc(sizeof(float) * n) )
+        && ( next = (float*)malloc(sizeof(float) * n) )
+        && ( contrib = (float*)malloc(sizeof(float) * n) )
+        && ( bounds = (int*)malloc(sizeof(int) * (threads + 1)) )
+    )
+    {
+        partition_rows(transpose, threads, bounds);
+
+        for (v = 0; v < n; v++)
+        {
+            rank[v] = 1.0f / n;
+        }
+
+        residual = tolerance + 1;
+
+        for (iteration = 0; iteration < max_iterations && residual >= tolerance; iteration++)
+        {
+            start = get_wall_time();
+            dangling = 0;
+            residual = 0;
+
+            /* Contributions of every node, and total rank of the dangling nodes */
+            #ifdef _OPENMP
+                #pragma omp parallel for schedule(static) reduction(+:dangling)
+            #endif
+            for (u = 0; u < n; u++)
+            {
+                if (csr->offsets[u + 1] > csr->offsets[u])
+                {
+                    contrib[u] = rank[u] / (csr->offsets[u + 1] - csr->offsets[u]);
+                }
+                else
+                {
+                    contrib[u] = 0;
+                    dangling += rank[u];
+                }
+            }
+
+            /* Sparse matrix-vector product, one range of rows per thread */
+            #ifdef _OPENMP
+                #pragma omp parallel for private(v, e, sum) reduction(+:residual) schedule(static, 1)
+            #endif
+            for (t = 0; t < threads; t++)
+            {
+                for (v = bounds[t]; v < bounds[t + 1]; v++)
+                {
+                    sum = 0;
+
+                    for (e = transpose->offsets[v]; e < transpose->offsets[v + 1]; e++)
+                    {
+                        sum += contrib[transpose->targets[e]];
+                    }
+
+                    sum = (1 - damping) / n + damping * (sum + dangling / n);
+                    residual += fabs(sum - rank[v]);
+                    next[v] = (float)sum;
+                }
+            }
+
+            swap = rank;
+            rank = next;
+            next = swap;
+
+            if (report)
+            {
+                printf("[pagerank()] Iteration %d: residual %.3e, %.3f ms\n", iteration + 1, residual, 1000 * (get_wall_time() - start));
+            }
+        }
+    }
+    else
+    {
+        printf("[pagerank()] ERROR: Memory allocation was unsuccessful\n");
+        free(rank);
+        rank = NULL;
+    }
+
+    free(next);
+    free(contrib);
+    free(bounds);
+    transpose = delete_graph_csr(transpose);
+
+    return rank;
+}
+
+
+/*
+ *  Helper function of personalized_pagerank() that adds 'mass' to the residual of the node 
+ *  with index w, and appends the node to the circular queue when its residual exceeds 
+ *  'epsilon' times its outward degree (a dangling node counts as having degree 1)
+ */
+static void ppr_add_residual(graph_csr_t *csr, double *residual, int *queue, bool_t *in_queue, int *tail, int w, double mass, float epsilon)
+{
+    int degree;
+
+
+    residual[w] += mass;
+    degree = csr->offsets[w + 1] - csr->offsets[w];
+
+    if (in_queue[w] == false && residual[w] > (double)epsilon * (degree > 0 ? degree : 1))
+    {
+        queue[*tail] = w;
+        *tail = (*tail + 1) % (csr->node_count + 1);
+        in_queue[w] = true;
+    }
+}
+
+
+/*
+ *  Computes an approximation of the personalized PageRank of every node with respect to the
+ *  'seed' node, that is the PageRank where the random jumps always land on the seed, with the
+ *  local push algorithm (Andersen, Chung and Lang): every node keeps an estimate and a residual
+ *  mass, and a node whose residual exceeds 'epsilon' times its outward degree keeps (1 - damping)
+ *  of it and pushes the rest to its outward neighbours. The residual of a dangling node goes back
+ *  to the seed. Only the nodes around the seed are ever touched, so the cost depends on 
+ *  'epsilon' and not on the size of the graph.
+ * 
+ *  The estimates never exceed the exact values, and the missing mass is the sum of the 
+ *  residuals left, each below 'epsilon' times the outward degree of its node.
+ * 
+ *  NOTE: The edge weights are ignored, and parallel edges count as many times as they appear
+ * 
+ *  Returns the array of the estimates indexed by node index, NULL on error
+ */
+float * personalized_pagerank(graph_csr_t *csr, id_t seed_nid, float damping, float epsilon)
+{
+    float *rank;
+    double *residual;
+    bool_t *in_queue;
+    int *queue;
+    int n, seed, head, tail, u, e, degree;
+    double share;
+
+
+    rank = NULL;
+    seed = get_csr_index_from_id(csr, seed_nid);
+
+    if (seed == ERROR_INDEX || damping < 0 || damping >= 1 || epsilon <= 0)
+    {
+        printf("[personalized_pagerank()] ERROR: Invalid seed node or parameters\n");
+        return NULL;
+    }
+
+    n = csr->node_count;
+    residual = NULL;
+    in_queue = NULL;
+    queue = NULL;
+
+    if (
+        ( rank = (float*)calloc(n, sizeof(float)) )
+        && ( residual = (double*)calloc(n, sizeof(double)) )
+        && ( in_queue = (bool_t*)calloc(n, sizeof(bool_t)) )
+        && ( queue = (int*)malloc(sizeof(int) * (n + 1)) )
+    )
+    {
+        /* Circular FIFO queue: a node is never in the queue twice, so n + 1 slots are enough */
+        residual[seed] = 1;
+        queue[0] = seed;
+        in_queue[seed] = true;
+        head = 0;
+        tail = 1;
+
+        while (head != tail)
+        {
+            u = queue[head];
+            head = (head + 1) % (n + 1);
+            in_queue[u] = false;
+
+            degree = csr->offsets[u + 1] - csr->offsets[u];
+            rank[u] += (float)((1 - damping) * residual[u]);
+            share = damping * residual[u];
+            residual[u] = 0;
+
+            if (degree == 0)
+            {
+                ppr_add_residual(csr, residual, queue, in_queue, &tail, seed, share, epsilon);
+            }
+            else
+            {
+                for (e = csr->offsets[u]; e < csr->offsets[u + 1]; e++)
+                {
+                    ppr_add_residual(csr, residual, queue, in_queue, &tail, csr->targets[e], share / degree, epsilon);
+                }
+            }
+        }
+    }
+    else
+    {
+        printf("[personalized_pagerank()] ERROR: Memory allocation was unsuccessful\n");
+        free(rank);
+        rank = NULL;
+    }
+
+    free(residual);
+    free(in_queue);
+    free(queue);
+
+    return rank;
+}
+
+
+/*
+ *  Helper function of betweenness_centrality() that runs the forward phase of Brandes' 
+ *  Algorithm from the node with index 'src': a BFS if 'weighted' is false, Dijkstra's 
+ *  Algorithm otherwise. It stores in 'order' the nodes in the order they're settled, 
+ *  in 'sigma' the amount of shortest paths from the source to each of them, and in the 
+ *  'path_len' entry of the workspace the position of each node in 'order' plus one 
+ *  (0 for the nodes that weren't settled). Returns the amount of settled nodes
+ */
+static int brandes_search(graph_csr_t *csr, bool_t weighted, graph_sssp_t *sssp, double *sigma, int *order, int src)
+{
+    int u, v, e, count, head;
+    long int new_dist;
+
+
+    sssp_begin_search(sssp);
+    sssp_reach(sssp, src);
+
+    sssp->src = src;
+    sssp->dist[src] = 0;
+    sigma[src] = 1;
+    count = 0;
+
+    if (weighted)
+    {
+        sssp_heap_push(sssp, src, 0);
+
+        while (sssp->heap_size > 0)
+        {
+            u = sssp_heap_pop(sssp);
+            order[count] = u;
+            count++;
+            sssp->path_len[u] = count;
+
+            for (e = csr->offsets[u]; e < csr->offsets[u + 1]; e++)
+            {
+                v = csr->targets[e];
+                new_dist = sssp->dist[u] + csr->weights[e];
+                sssp_reach(sssp, v);
+
+                /* The weights are positive, so a settled node can't get more shortest paths */
+                if (sssp->path_len[v] == 0)
+                {
+                    if (new_dist < sssp->dist[v])
+                    {
+                        sssp->dist[v] = new_dist;
+                        sigma[v] = sigma[u];
+                        sssp_heap_push(sssp, v, new_dist);
+                    }
+                    else if (new_dist == sssp->dist[v])
+                    {
+                        sigma[v] += sigma[u];
+                    }
+                }
+            }
+        }
+    }
+    else
+    {
+        /* The settle order of a BFS is its own queue */
+        order[0] = src;
+        sssp->path_len[src] = 1;
+        count = 1;
+
+        for (head = 0; head < count; head++)
+        {
+            u = order[head];
+
+            for (e = csr->offsets[u]; e < csr->offsets[u + 1]; e++)
+            {
+                v = csr->targets[e];
+                sssp_reach(sssp, v);
+
+                if (sssp->dist[v] == GRAPH_DIST_INF)
+                {
+                    sssp->dist[v] = sssp->dist[u] + 1;
+                    sigma[v] = 0;
+                    order[count] = v;
+                    count++;
+                    sssp->path_len[v] = count;
+                }
+
+                if (sssp->dist[v] == sssp->dist[u] + 1)
+                {
+                    sigma[v] += sigma[u];
+                }
+            }
+        }
+    }
+
+    return count;
+}
+
+
+/*
+ *  Helper function of betweenness_centrality() that runs the backward phase of Brandes'
+ *  Algorithm after brandes_search(): the nodes are visited in reverse settle order, and the
+ *  dependency of each node is accumulated from the successors on its shortest paths, which
+ *  are found again by checking the distances (so no predecessor lists are needed). The
+ *  dependencies are added to 'scores', except the one of the source
+ */
+static void brandes_accumulate(graph_csr_t *csr, bool_t weighted, graph_sssp_t *sssp, double *sigma, double *delta, int *order, int count, double *scores)
+{
+    int i, u, v, e;
+    double dependency;
+
+
+    for (i = count - 1; i >= 0; i--)
+    {
+        u = order[i];
+        dependency = 0;
+
+        for (e = csr->offsets[u]; e < csr->offsets[u + 1]; e++)
+        {
+            v = csr->targets[e];
+
+            /* Every outward neighbour of a settled node was reached by the forward phase */
+            if (
+                sssp->path_len[v] > sssp->path_len[u] 
+                && sssp->dist[v] == sssp->dist[u] + (weighted ? csr->weights[e] : 1)
+            )
+            {
+                dependency += (sigma[u] / sigma[v]) * (1 + delta[v]);
+            }
+        }
+
+        delta[u] = dependency;
+
+        if (u != sssp->src)
+        {
+            scores[u] += dependency;
+        }
+    }
+}
+
+
+/*
+ *  Computes the betweenness centrality of every node with Brandes' Algorithm, that is, for
+ *  each node v, the sum over all pairs (s, t) of the fraction of the shortest paths from s 
+ *  to t that pass through v. A single-source search is run from each source (a BFS if 
+ *  'weighted' is false, Dijkstra's Algorithm on the edge weights otherwise), and the 
+ *  dependencies are then accumulated backwards, in O(V E) (or O(V E log V) if weighted).
+ * 
+ *  If 'samples' is between 1 and node_count - 1, only that many distinct sources are picked 
+ *  at random (with the given seed) and the scores are scaled by node_count / samples, which 
+ *  gives an unbiased estimate in a fraction of the time. Otherwise every node is a source.
+ * 
+ *  The searches are independent: when compiled with OpenMP they are spread among the threads,
+ *  each one with its own workspace and array of scores, which are summed at the end.
+ * 
+ *  NOTE:
+ *   - The graph is treated as directed, so on undirected graphs (with both directions 
+ *     of every edge) each pair is counted twice
+ * 
+ *   - If 'weighted' is true, every edge weight must be positive: the number of shortest paths
+ *     of a node is final when it's settled, which doesn't hold with 0-weight edges (a node 
+ *     settled later at the same distance could still lead to it)
+ * 
+ *  Returns the array of the scores indexed by node index, NULL on error
+ */
+double * betweenness_centrality(graph_csr_t *csr, bool_t weighted, int samples, unsigned int seed)
+{
+    graph_sssp_t **workspaces;
+    double *scores, *thread_scores, *sigma, *delta;
+    int *order, *sources;
+    int n, t, threads, i, j, swap, source_count;
+    bool_t allocated;
+
+
+    if (csr == NULL || csr->node_count == 0 || (weighted && csr->min_weight <= 0))
+    {
+        printf("[betweenness_centrality()] ERROR: Invalid compact view or non-positive edge weights\n");
+        return NULL;
+    }
+
+    n = csr->node_count;
+    threads = get_thread_count();
+    source_count = (samples > 0 && samples < n) ? samples : n;
+    scores = NULL;
+    thread_scores = NULL;
+    sigma = NULL;
+    delta = NULL;
+    order = NULL;
+    sources = NULL;
+    workspaces = NULL;
+
+    if (
+        ( scores = (double*)calloc(n, sizeof(double)) )
+        && ( thread_scores = (double*)calloc((size_t)n * threads, sizeof(double)) )
+        && ( sigma = (double*)malloc(sizeof(double) * n * threads) )
+        && ( delta = (double*)malloc(sizeof(double) * n * threads) )
+        && ( order = (int*)malloc(sizeof(int) * n * threads) )
+        && ( sources = (int*)malloc(sizeof(int) * n) )
+        && ( workspaces = (graph_sssp_t**)calloc(threads, sizeof(graph_sssp_t*)) )
+    )
+    {
+        /* One workspace for each thread */
+        allocated = true;
+
+        for (t = 0; t < threads && allocated; t++)
+        {
+            allocated = (( workspaces[t] = create_sssp(n) ) != NULL);
+        }
+
+        if (allocated)
+        {
+            for (i = 0; i < n; i++)
+            {
+                sources[i] = i;
+            }
+
+            /* The sampled sources are the first ones of a partial shuffle */
+            if (source_count < n)
+            {
+                srand(seed);
+
+                for (i = 0; i < source_count; i++)
+                {
+                    j = i + (int)(((unsigned long int)rand() * ((unsigned long int)RAND_MAX + 1) + rand()) % (n - i));
+                    swap = sources[i];
+                    sources[i] = sources[j];
+                    sources[j] = swap;
+                }
+            }
+
+            #ifdef _OPENMP
+                #pragma omp parallel for schedule(dynamic, 4) private(t, j)
+            #endif
+            for (i = 0; i < source_count; i++)
+            {
+                t = get_thread_id();
+                j = brandes_search(csr, weighted, workspaces[t], sigma + (size_t)t * n, order + (size_t)t * n, sources[i]);
+                brandes_accumulate(
+                    csr, weighted, workspaces[t], sigma + (size_t)t * n, delta + (size_t)t * n, 
+                    order + (size_t)t * n, j, thread_scores + (size_t)t * n
+                );
+            }
+
+            /* Merge of the per-thread scores */
+            #ifdef _OPENMP
+                #pragma omp parallel for schedule(static) private(t)
+            #endif
+            for (i = 0; i < n; i++)
+            {
+                for (t = 0; t < threads; t++)
+                {
+                    scores[i] += thread_scores[(size_t)t * n + i];
+                }
+
+                scores[i] *= (double)n / source_count;
+            }
+        }
+        else
+        {
+            printf("[betweenness_centrality()] ERROR: Memory allocation was unsuccessful\n");
+            free(scores);
+            scores = NULL;
+        }
+
+        for (t = 0; t < threads; t++)
+        {
+            workspaces[t] = delete_sssp(workspaces[t]);
+        }
+    }
+    else
+    {
+        printf("[betweenness_centrality()] ERROR: Memory allocation was unsuccessful\n");
+        free(scores);
+        scores = NULL;
+    }
+
+    free(thread_scores);
+    free(sigma);
+    free(delta);
+    free(order);
+    free(sources);
+    free(workspaces);
+
+    return scores;
+}
+
+
+/*
+ *  Helper function that builds the sorted array of the distinct neighbours of every node of
+ *  the compact view, taking its edges without direction and leaving out the self loops. The
+ *  neighbours of the node with index v are stored in neighbours[offsets[v]] .. 
+ *  neighbours[offsets[v + 1] - 1], and their amount in degrees[v], where 'offsets' has 
+ *  node_count + 1 elements and 'neighbours' 2 * edge_count. No sorting is needed: while 
+ *  visiting the nodes in increasing order, each one is appended to the arrays of its 
+ *  neighbours (found on the compact view and on its transpose), and the repeated ones end 
+ *  up next to each other, to be removed by compacting the arrays.
+ * 
+ *  Returns true if the arrays were built, false otherwise
+ */
+static bool_t build_undirected_neighbours(graph_csr_t *csr, int *offsets, int *neighbours, int *degrees)
+{
+    graph_csr_t *transpose;
+    int n, u, v, e, i, degree, start;
+
+
+    if (( transpose = create_graph_csr_transpose(csr) ) == NULL)
+    {
+        return false;
+    }
+
+    n = csr->node_count;
+    memset(offsets, 0, sizeof(int) * (n + 1));
+
+    for (e = 0; e < csr->edge_count; e++)
+    {
+        if (csr->sources[e] != csr->targets[e])
+        {
+            offsets[csr->sources[e] + 1]++;
+            offsets[csr->targets[e] + 1]++;
+        }
+    }
+
+    /* The degrees are used as insertion cursors first */
+    for (v = 0; v < n; v++)
+    {
+        offsets[v + 1] += offsets[v];
+        degrees[v] = offsets[v];
+    }
+
+    for (u = 0; u < n; u++)
+    {
+        for (e = csr->offsets[u]; e < csr->offsets[u + 1]; e++)
+        {
+            if (csr->targets[e] != u)
+            {
+                neighbours[degrees[csr->targets[e]]++] = u;
+            }
+        }
+
+        for (e = transpose->offsets[u]; e < transpose->offsets[u + 1]; e++)
+        {
+            if (transpose->targets[e] != u)
+            {
+                neighbours[degrees[transpose->targets[e]]++] = u;
+            }
+        }
+    }
+
+    /* Removal of the repeated neighbours, moving the arrays back to close the gaps */
+    start = 0;
+
+    for (v = 0; v < n; v++)
+    {
+        degree = 0;
+
+        for (i = offsets[v]; i < offsets[v + 1]; i++)
+        {
+            if (degree == 0 || neighbours[start + degree - 1] != neighbours[i])
+            {
+                neighbours[start + degree] = neighbours[i];
+                degree++;
+            }
+        }
+
+        offsets[v] = start;
+        degrees[v] = degree;
+        start += degree;
+    }
+
+    offsets[n] = start;
+    transpose = delete_graph_csr(transpose);
+
+    return true;
+}
+
+
+/*
+ *  Helper function of count_triangles() that returns the amount of common elements of two 
+ *  sorted arrays of node indexes, and adds one triangle to each of them in 'triangles'. 
+ *  The arrays are merged, unless one is TRIANGLE_GALLOP_RATIO times longer than the other:
+ *  then each element of the short one is looked for in the long one with a galloping 
+ *  (exponential, then binary) search, starting from the position of the previous match
+ */
+static long int intersect_neighbours(const int *a, int a_len, const int *b, int b_len, long int *triangles)
+{
+    const int *swap;
+    int i, j, step, low, high, mid, swap_len;
+    long int count;
+
+
+    count = 0;
+
+    if (a_len > b_len)
+    {
+        swap = a;
+        a = b;
+        b = swap;
+        swap_len = a_len;
+        a_len = b_len;
+        b_len = swap_len;
+    }
+
+    if ((long int)a_len * TRIANGLE_GALLOP_RATIO < b_len)
+    {
+        j = 0;
+
+        for (i = 0; i < a_len && j < b_len; i++)
+        {
+            /* Exponential search for a range of 'b' that contains a[i] */
+            step = 1;
+            low = j;
+
+            while (j + step < b_len && b[j + step] < a[i])
+            {
+                low = j + step;
+                step *= 2;
+            }
+
+            high = (j + step < b_len) ? j + step : b_len - 1;
+
+            /* Binary search for the first element of the range that isn't smaller */
+            while (low < high)
+            {
+                mid = low + (high - low) / 2;
+
+                if (b[mid] < a[i])
+                {
+                    low = mid + 1;
+                }
+                else
+                {
+                    high = mid;
+                }
+            }
+
+            j = low;
+
+            if (b[j] == a[i])
+            {
+                triangles[a[i]]++;
+                count++;
+                j++;
+            }
+        }
+    }
+    else
+    {
+        i = 0;
+        j = 0;
+
+        while (i < a_len && j < b_len)
+        {
+            if (a[i] < b[j])
+            {
+                i++;
+            }
+            else if (a[i] > b[j])
+            {
+                j++;
+            }
+            else
+            {
+                triangles[a[i]]++;
+                count++;
+                i++;
+                j++;
+            }
+        }
+    }
+
+    return count;
+}
+
+
+/*
+ *  Counts the triangles of the graph, considering its edges without direction (self loops 
+ *  and parallel edges are ignored), and computes the local clustering coefficient of every
+ *  node, that is the fraction of the pairs of its neighbours that are linked too:
+ * 
+ *      (1) - The sorted neighbour array of every node is built from the compact view and 
+ *            its transpose, without sorting: the nodes are appended in increasing order
+ *      (2) - Each edge is oriented from the node with smaller degree to the one with larger
+ *            degree (by index on ties), so every node keeps at most O(sqrt(E)) neighbours
+ *      (3) - For every oriented edge (u, v), the common neighbours w of u and v are the 
+ *            triangles (u, v, w), each of them found exactly once
+ * 
+ *  which takes O(E sqrt(E)) time and O(V + E) memory. The nodes of step (3) are spread among
+ *  the threads when compiled with OpenMP, each one counting on its own array.
+ * 
+ *  Returns the triangle counts (see graph_triangles_t), NULL on error
+ */
+graph_triangles_t * count_triangles(graph_csr_t *csr)
+{
+    graph_triangles_t *result;
+    int *offsets, *neighbours, *up_offsets, *up;
+    long int *thread_triangles;
+    int n, t, threads, u, v, i, k, degree;
+    long int total, wedges;
+
+
+    if (csr == NULL)
+    {
+        return NULL;
+    }
+
+    n = csr->node_count;
+    threads = get_thread_count();
+    result = NULL;
+    offsets = NULL;
+    neighbours = NULL;
+    up_offsets = NULL;
+    up = NULL;
+    thread_triangles = NULL;
+
+    if (
+        ( result = (graph_triangles_t*)calloc(1, sizeof(graph_triangles_t)) )
+        && ( result->degrees = (int*)calloc(n + 1, sizeof(int)) )
+        && ( result->triangles = (long int*)calloc(n + 1, sizeof(long int)) )
+        && ( result->clustering = (double*)malloc(sizeof(double) * (n + 1)) )
+        && ( offsets = (int*)malloc(sizeof(int) * (n + 1)) )
+        && ( neighbours = (int*)malloc(sizeof(int) * (2 * csr->edge_count + 1)) )
+        && ( up_offsets = (int*)malloc(sizeof(int) * (n + 1)) )
+        && ( up = (int*)malloc(sizeof(int) * (csr->edge_count + 1)) )
+        && ( thread_triangles = (long int*)calloc((size_t)n * threads + 1, sizeof(long int)) )
+        && build_undirected_neighbours(csr, offsets, neighbours, result->degrees)
+    )
+    {
+        result->node_count = n;
+
+        /* (2) - Orientation towards the larger degree, which keeps the arrays sorted */
+        up_offsets[0] = 0;
+
+        for (u = 0; u < n; u++)
+        {
+            up_offsets[u + 1] = up_offsets[u];
+
+            for (i = offsets[u]; i < offsets[u + 1]; i++)
+            {
+                v = neighbours[i];
+
+                if (result->degrees[v] > result->degrees[u] || (result->degrees[v] == result->degrees[u] && v > u))
+                {
+                    up[up_offsets[u + 1]++] = v;
+                }
+            }
+        }
+
+        /* (3) - Intersections, one per oriented edge */
+        total = 0;
+
+        #ifdef _OPENMP
+            #pragma omp parallel for schedule(dynamic, 64) private(t, i, v, k) reduction(+:total)
+        #endif
+        for (u = 0; u < n; u++)
+        {
+            t = get_thread_id();
+
+            for (i = up_offsets[u]; i < up_offsets[u + 1]; i++)
+            {
+                v = up[i];
+                k = (int)intersect_neighbours(
+                    up + up_offsets[u], up_offsets[u + 1] - up_offsets[u], 
+                    up + up_offsets[v], up_offsets[v + 1] - up_offsets[v], 
+                    thread_triangles + (size_t)t * n
+                );
+
+                thread_triangles[(size_t)t * n + u] += k;
+                thread_triangles[(size_t)t * n + v] += k;
+                total += k;
+            }
+        }
+
+        /* Merge of the per-thread counts, and clustering coefficients */
+        wedges = 0;
+
+        for (v = 0; v < n; v++)
+        {
+            for (t = 0; t < threads; t++)
+            {
+                result->triangles[v] += thread_triangles[(size_t)t * n + v];
+            }
+
+            degree = result->degrees[v];
+            wedges += (long int)degree * (degree - 1) / 2;
+
+            if (degree > 1)
+            {
+                result->clustering[v] = (2.0 * result->triangles[v]) / ((double)degree * (degree - 1));
+            }
+            else
+            {
+                result->clustering[v] = 0;
+            }
+        }
+
+        result->total = total;
+        result->transitivity = (wedges > 0) ? (3.0 * total) / wedges : 0;
+    }
+    else
+    {
+        printf("[count_triangles()] ERROR: Memory allocation was unsuccessful\n");
+        result = delete_graph_triangles(result);
+    }
+
+    free(offsets);
+    free(neighbours);
+    free(up_offsets);
+    free(up);
+    free(thread_triangles);
+
+    return result;
+}
+
+
+/*
+ *  Deletes the triangle counts returned by count_triangles()
+ * 
+ *  Returns NULL
+ */
+graph_triangles_t * delete_graph_triangles(graph_triangles_t *triangles)
+{
+    if (triangles)
+    {
+        free(triangles->degrees);
+        free(triangles->triangles);
+        free(triangles->clustering);
+        free(triangles);
+    }
+
+    return NULL;
+}
+
+
+/*
+ *  Helper function that removes the nodes one at a time, always taking one with the smallest
+ *  degree among the remaining ones, with the bucket-based algorithm of Batagelj and Zaversnik:
+ *  the nodes are kept sorted by their current degree in an array divided in buckets (one per
+ *  degree), and each removal moves the neighbours with larger degree to the previous bucket 
+ *  with a swap, so it all takes O(V + E). The neighbour arrays are the ones built by 
+ *  build_undirected_neighbours(), and 'core' holds the degrees at first, and the core numbers
+ *  at the end. The nodes are stored in 'order' in the order they were removed.
+ * 
+ *  Returns true if the nodes were removed, false otherwise
+ */
+static bool_t peel_min_degree(int n, const int *offsets, const int *neighbours, int *core, int *order)
+{
+    int *bin, *pos;
+    int i, u, v, w, max_degree, start, count, du, pu, pw;
+
+
+    bin = NULL;
+
+    if (
+        ( pos = (int*)malloc(sizeof(int) * (n + 1)) )
+        && ( bin = (int*)calloc(n + 1, sizeof(int)) )
+    )
+    {
+        /* bin[d] is where the bucket of the nodes with degree d starts */
+        max_degree = 0;
+
+        for (v = 0; v < n; v++)
+        {
+            bin[core[v]]++;
+
+            if (core[v] > max_degree)
+            {
+                max_degree = core[v];
+            }
+        }
+
+        start = 0;
+
+        for (i = 0; i <= max_degree; i++)
+        {
+            count = bin[i];
+            bin[i] = start;
+            start += count;
+        }
+
+        for (v = 0; v < n; v++)
+        {
+            pos[v] = bin[core[v]];
+            order[pos[v]] = v;
+            bin[core[v]]++;
+        }
+
+        for (i = max_degree; i > 0; i--)
+        {
+            bin[i] = bin[i - 1];
+        }
+
+        bin[0] = 0;
+
+        for (i = 0; i < n; i++)
+        {
+            v = order[i];
+
+            for (u = offsets[v]; u < offsets[v + 1]; u++)
+            {
+                w = neighbours[u];
+
+                if (core[w] > core[v])
+                {
+                    /* Swap of w with the first node of its bucket, which then shrinks */
+                    du = core[w];
+                    pu = pos[w];
+                    pw = bin[du];
+
+                    if (order[pw] != w)
+                    {
+                        order[pu] = order[pw];
+                        pos[order[pu]] = pu;
+                        order[pw] = w;
+                        pos[w] = pw;
+                    }
+
+                    bin[du]++;
+                    core[w]--;
+                }
+            }
+        }
+    }
+
+    free(bin);
+    free(pos);
+
+    return (bin != NULL);
+}
+
+
+/*
+ *  Computes the core number of every node, taking the edges without direction (see 
+ *  build_undirected_neighbours()). The k-core of a graph is its largest subgraph whose
+ *  nodes all have at least k neighbours inside it, and the core number of a node is the
+ *  largest k of the cores it belongs to. Removing the nodes by smallest degree (see
+ *  peel_min_degree()) gives all of them in O(V + E): the core number of a node is its
+ *  degree at the time of its removal.
+ * 
+ *  Returns the array of the core numbers indexed by node index, NULL on error
+ */
+int * core_numbers(graph_csr_t *csr)
+{
+    int *core, *offsets, *neighbours, *order;
+
+
+    if (csr == NULL)
+    {
+        return NULL;
+    }
+
+    offsets = NULL;
+    neighbours = NULL;
+    order = NULL;
+
+    if (
+        !( core = (int*)malloc(sizeof(int) * (csr->node_count + 1)) )
+        || !( offsets = (int*)malloc(sizeof(int) * (csr->node_count + 1)) )
+        || !( neighbours = (int*)malloc(sizeof(int) * (2 * csr->edge_count + 1)) )
+        || !( order = (int*)malloc(sizeof(int) * (csr->node_count + 1)) )
+        || !build_undirected_neighbours(csr, offsets, neighbours, core)
+        || !peel_min_degree(csr->node_count, offsets, neighbours, core, order)
+    )
+    {
+        printf("[core_numbers()] ERROR: Memory allocation was unsuccessful\n");
+        free(core);
+        core = NULL;
+    }
+
+    free(offsets);
+    free(neighbours);
+    free(order);
+
+    return core;
+}
+
+
+/*
+ *  Creates a new graph with the k-core of the given one (see core_numbers()), that is the
+ *  subgraph induced by the nodes whose core number is at least 'k': every one of them is
+ *  copied with its label, together with its edges towards the other copied nodes (with 
+ *  their weights and labels). The copies get new IDs and the original graph isn't modified,
+ *  so no node has to be deleted, and the order of the nodes and edges is kept.
+ * 
+ *  Returns the k-core, which is NULL if no node has a core number of at least 'k'
+ */
+graph_t * extract_k_core(graph_t *graph, int k)
+{
+    graph_csr_t *csr;
+    graph_t *core_graph, **copies;
+    graph_edge_t edge;
+    id_t endpoints[2];
+    int *core;
+    int u, e;
+
+
+    core_graph = NULL;
+    csr = create_graph_csr(graph);
+    core = core_numbers(csr);
+    copies = NULL;
+
+    if (csr && core && ( copies = (graph_t**)malloc(sizeof(graph_t*) * (csr->node_count + 1)) ))
+    {
+        /* The nodes are pushed starting from the last one, so that their order is kept */
+        for (u = csr->node_count - 1; u >= 0; u--)
+        {
+            copies[u] = NULL;
+
+            if (core[u] >= k)
+            {
+                core_graph = core_graph ? push_node(core_graph, create_new_node(csr->nodes[u]->label)) : append_node(core_graph, create_new_node(csr->nodes[u]->label));
+                copies[u] = core_graph;
+            }
+        }
+
+        for (u = 0; u < csr->node_count; u++)
+        {
+            if (copies[u])
+            {
+                for (e = csr->offsets[u + 1] - 1; e >= csr->offsets[u]; e--)
+                {
+                    if (copies[csr->targets[e]])
+                    {
+                        endpoints[0] = copies[u]->node.id;
+                        endpoints[1] = copies[csr->targets[e]]->node.id;
+                        edge = create_new_edge(csr->edges[e]->weight, csr->edges[e]->label, endpoints);
+                        edge.is_in_mst = false;
+
+                        copies[u]->node.edges = copies[u]->node.edges ? push_edge(copies[u]->node.edges, edge) : append_edge(NULL, edge);
+                    }
+                }
+            }
+        }
+    }
+    else if (graph)
+    {
+        printf("[extract_k_core()] ERROR: Memory allocation was unsuccessful\n");
+    }
+
+    free(copies);
+    free(core);
+    csr = delete_graph_csr(csr);
+
+    return core_graph;
+}
+
+
+/*
+ *  Returns the k-core of the graph (see extract_k_core()), 
+ *  where k is asked to the user at runtime
+ */
+graph_t * extract_k_core_input(graph_t *graph)
+{
+    int k;
+
+
+    if (graph)
+    {
+        printf("\n[CURRENT OPERATION]\n - Extracting the k-core of the graph\n");
+
+        k = *((int*)safe_input(INT, STRING_BUFFER_SIZE, "Insert the minimum core number (k): "));
+
+        return extract_k_core(graph, k);
+    }
+
+    return NULL;
+}
+
+
+/*
+ *  Helper function that deletes a residual network
+ * 
+ *  Returns NULL
+ */
+static graph_flow_network_t * delete_flow_network(graph_flow_network_t *net)
+{
+    if (net)
+    {
+        free(net->offsets);
+        free(net->heads);
+        free(net->reverse);
+        free(net->edge_arc);
+        free(net->capacity);
+        free(net);
+    }
+
+    return NULL;
+}
+
+
+/*
+ *  Helper function that creates the residual network of the compact view, where every edge 
+ *  becomes a forward arc with its weight as capacity and a reverse arc with no capacity, 
+ *  paired through 'reverse'. The arcs leaving each node are stored contiguously.
+ * 
+ *  Returns the residual network, NULL on error
+ */
+static graph_flow_network_t * create_flow_network(graph_csr_t *csr)
+{
+    graph_flow_network_t *net;
+    int n, e, u, v, forward, backward;
+
+
+    n = csr->node_count;
+
+    if (
+        ( net = (graph_flow_network_t*)calloc(1, sizeof(graph_flow_network_t)) )
+        && ( net->offsets = (int*)calloc(n + 2, sizeof(int)) )
+        && ( net->heads = (int*)malloc(sizeof(int) * (2 * csr->edge_count + 1)) )
+        && ( net->reverse = (int*)malloc(sizeof(int) * (2 * csr->edge_count + 1)) )
+        && ( net->edge_arc = (int*)malloc(sizeof(int) * (csr->edge_count + 1)) )
+        && ( net->capacity = (long int*)malloc(sizeof(long int) * (2 * csr->edge_count + 1)) )
+    )
+    {
+        net->node_count = n;
+        net->arc_count = 2 * csr->edge_count;
+
+        /* offsets[u + 2] counts the arcs of u, so that offsets[u + 1] can be used as a cursor */
+        for (e = 0; e < csr->edge_count; e++)
+        {
+            net->offsets[csr->sources[e] + 2]++;
+            net->offsets[csr->targets[e] + 2]++;
+        }
+
+        for (u = 0; u < n; u++)
+        {
+            net->offsets[u + 2] += net->offsets[u + 1];
+        }
+
+        for (e = 0; e < csr->edge_count; e++)
+        {
+            u = csr->sources[e];
+            v = csr->targets[e];
+            forward = net->offsets[u + 1]++;
+            backward = net->offsets[v + 1]++;
+
+            net->heads[forward] = v;
+            net->heads[backward] = u;
+            net->reverse[forward] = backward;
+            net->reverse[backward] = forward;
+            net->capacity[forward] = csr->weights[e];
+            net->capacity[backward] = 0;
+            net->edge_arc[e] = forward;
+        }
+    }
+    else
+    {
+        printf("[create_flow_network()] ERROR: Memory allocation was unsuccessful\n");
+        net = delete_flow_network(net);
+    }
+
+    return net;
+}
+
+
+/*
+ *  Helper function that collects the result of a maximum flow computed on the residual 
+ *  network: the flow of each edge is the capacity it lost, and the source side of the 
+ *  minimum cut is made of the nodes still reachable from the source in the residual 
+ *  network (found with a BFS that uses 'queue' and 'visited' as scratch)
+ * 
+ *  Returns the result, NULL on error
+ */
+static graph_flow_t * create_flow_result(graph_csr_t *csr, graph_flow_network_t *net, int src, long int value)
+{
+    graph_flow_t *result;
+    int *queue;
+    int head, tail, u, a, e;
+
+
+    queue = NULL;
+
+    if (
+        ( result = (graph_flow_t*)calloc(1, sizeof(graph_flow_t)) )
+        && ( result->flow = (long int*)malloc(sizeof(long int) * (csr->edge_count + 1)) )
+        && ( result->source_side = (bool_t*)calloc(csr->node_count + 1, sizeof(bool_t)) )
+        && ( queue = (int*)malloc(sizeof(int) * (csr->node_count + 1)) )
+    )
+    {
+        result->node_count = csr->node_count;
+        result->edge_count = csr->edge_count;
+        result->value = value;
+        result->cut = NULL;
+
+        for (e = 0; e < csr->edge_count; e++)
+        {
+            result->flow[e] = csr->weights[e] - net->capacity[net->edge_arc[e]];
+        }
+
+        queue[0] = src;
+        result->source_side[src] = true;
+        tail = 1;
+
+        for (head = 0; head < tail; head++)
+        {
+            u = queue[head];
+
+            for (a = net->offsets[u]; a < net->offsets[u + 1]; a++)
+            {
+                if (net->capacity[a] > 0 && result->source_side[net->heads[a]] == false)
+                {
+                    result->source_side[net->heads[a]] = true;
+                    queue[tail] = net->heads[a];
+                    tail++;
+                }
+            }
+        }
+
+        for (e = csr->edge_count - 1; e >= 0; e--)
+        {
+            if (result->source_side[csr->sources[e]] && !result->source_side[csr->targets[e]] && csr->weights[e] > 0)
+            {
+                result->cut = push_id(result->cut, csr->edges[e]->id);
+            }
+        }
+    }
+    else
+    {
+        printf("[create_flow_result()] ERROR: Memory allocation was unsuccessful\n");
+        result = delete_graph_flow(result);
+    }
+
+    free(queue);
+
+    return result;
+}
+
+
+/*
+ *  Helper function that checks the parameters of the maximum flow algorithms, and
+ *  returns true if the source and the sink are valid and distinct, and no edge has
+ *  a negative capacity (weight)
+ */
+static bool_t check_flow_input(graph_csr_t *csr, int src, int sink, char *caller)
+{
+    if (src == ERROR_INDEX || sink == ERROR_INDEX || src == sink)
+    {
+        printf("[%s()] ERROR: The source and the sink must be two distinct nodes of the graph\n", caller);
+        return false;
+    }
+
+    if (csr->min_weight < 0)
+    {
+        printf("[%s()] ERROR: The edge weights (capacities) can't be negative\n", caller);
+        return false;
+    }
+
+    return true;
+}
+
+
+/*
+ *  Computes the maximum flow from the node with ID 'src_nid' to the node with ID 'sink_nid'
+ *  with Dinic's Algorithm, using the edge weights as capacities. Each phase builds the level 
+ *  graph with a BFS from the source (the distance of each node in the residual network), and
+ *  then saturates it with a blocking flow, found with an iterative DFS that only follows 
+ *  arcs towards the next level. Every node keeps a pointer to its current arc, so that the 
+ *  arcs found useless during a phase are never scanned again, in O(V^2 E) overall (much 
+ *  less in practice, and O(E sqrt(V)) on unit capacities).
+ * 
+ *  Returns the flow of each edge and the minimum cut (see graph_flow_t), NULL on error
+ */
+graph_flow_t * dinic_max_flow(graph_csr_t *csr, id_t src_nid, id_t sink_nid)
+{
+    graph_flow_network_t *net;
+    graph_flow_t *result;
+    int *level, *current, *queue, *path;
+    int src, sink, head, tail, u, v, a, depth, i;
+    long int value, bottleneck;
+
+
+    src = get_csr_index_from_id(csr, src_nid);
+    sink = get_csr_index_from_id(csr, sink_nid);
+
+    if (csr == NULL || !check_flow_input(csr, src, sink, "dinic_max_flow"))
+    {
+        return NULL;
+    }
+
+    result = NULL;
+    level = NULL;
+    current = NULL;
+    queue = NULL;
+    path = NULL;
+
+    if (
+        ( net = create_flow_network(csr) )
+        && ( level = (int*)malloc(sizeof(int) * csr->node_count) )
+        && ( current = (int*)malloc(sizeof(int) * csr->node_count) )
+        && ( queue = (int*)malloc(sizeof(int) * csr->node_count) )
+        && ( path = (int*)malloc(sizeof(int) * csr->node_count) )
+    )
+    {
+        value = 0;
+
+        while (true)
+        {
+            /* Level graph */
+            for (u = 0; u < csr->node_count; u++)
+            {
+                level[u] = ERROR_INDEX;
+            }
+
+            level[src] = 0;
+            queue[0] = src;
+            tail = 1;
+
+            for (head = 0; head < tail && level[sink] == ERROR_INDEX; head++)
+            {
+                u = queue[head];
+
+                for (a = net->offsets[u]; a < net->offsets[u + 1]; a++)
+                {
+                    if (net->capacity[a] > 0 && level[net->heads[a]] == ERROR_INDEX)
+                    {
+                        level[net->heads[a]] = level[u] + 1;
+                        queue[tail] = net->heads[a];
+                        tail++;
+                    }
+                }
+            }
+
+            if (level[sink] == ERROR_INDEX)
+            {
+                break;
+            }
+
+            for (u = 0; u < csr->node_count; u++)
+            {
+                current[u] = net->offsets[u];
+            }
+
+            /* Blocking flow: the arcs of the current path are kept in 'path' */
+            u = src;
+            depth = 0;
+
+            while (true)
+            {
+                if (u == sink)
+                {
+                    bottleneck = net->capacity[path[0]];
+
+                    for (i = 1; i < depth; i++)
+                    {
+                        if (net->capacity[path[i]] < bottleneck)
+                        {
+                            bottleneck = net->capacity[path[i]];
+                        }
+                    }
+
+                    for (i = 0; i < depth; i++)
+                    {
+                        net->capacity[path[i]] -= bottleneck;
+                        net->capacity[net->reverse[path[i]]] += bottleneck;
+                    }
+
+                    value += bottleneck;
+
+                    /* Back to the tail of the first saturated arc */
+                    i = 0;
+
+                    while (net->capacity[path[i]] > 0)
+                    {
+                        i++;
+                    }
+
+                    depth = i;
+                    u = net->heads[net->reverse[path[i]]];
+                }
+
+                while (
+                    current[u] < net->offsets[u + 1]
+                    && ( net->capacity[current[u]] == 0 || level[net->heads[current[u]]] != level[u] + 1 )
+                )
+                {
+                    current[u]++;
+                }
+
+                if (current[u] < net->offsets[u + 1])
+                {
+                    /* Advance */
+                    path[depth] = current[u];
+                    depth++;
+                    u = net->heads[current[u]];
+                }
+                else if (u == src)
+                {
+                    break;
+                }
+                else
+                {
+                    /* Retreat: the node is a dead end for the rest of the phase */
+                    level[u] = ERROR_INDEX;
+                    depth--;
+                    v = net->heads[net->reverse[path[depth]]];
+                    current[v]++;
+                    u = v;
+                }
+            }
+        }
+
+        result = create_flow_result(csr, net, src, value);
+    }
+    else
+    {
+        printf("[dinic_max_flow()] ERROR: Memory allocation was unsuccessful\n");
+    }
+
+    free(level);
+    free(current);
+    free(queue);
+    free(path);
+    net = delete_flow_network(net);
+
+    return result;
+}
+
+
+/*
+ *  Helper function of push_relabel_max_flow() that inserts the node with index 'v' 
+ *  in the bucket of the active nodes with its height, and updates the highest one
+ */
+static void activate_node(int *buckets, int *next, int *heights, int *highest, int v)
+{
+    next[v] = buckets[heights[v]];
+    buckets[heights[v]] = v;
+
+    if (heights[v] > *highest)
+    {
+        *highest = heights[v];
+    }
+}
+
+
+/*
+ *  Computes the maximum flow from the node with ID 'src_nid' to the node with ID 'sink_nid'
+ *  with the highest-label Push-Relabel Algorithm, using the edge weights as capacities. The
+ *  source starts by saturating all its arcs, and then the active node (with excess flow) with
+ *  the highest label is discharged: its excess is pushed along the arcs to the nodes one 
+ *  level lower, and its label is raised when no such arc is left. The labels start as the
+ *  exact distances to the sink (from a backward BFS), and the gap heuristic lifts above the 
+ *  source all the nodes over an empty label at once, since they can't reach the sink anymore.
+ *  The excess that can't reach the sink flows back to the source, so the final result is a
+ *  valid flow. It takes O(V^2 sqrt(E)), and works better than dinic_max_flow() on dense graphs.
+ * 
+ *  Returns the flow of each edge and the minimum cut (see graph_flow_t), NULL on error
+ */
+graph_flow_t * push_relabel_max_flow(graph_csr_t *csr, id_t src_nid, id_t sink_nid)
+{
+    graph_flow_network_t *net;
+    graph_flow_t *result;
+    long int *excess;
+    int *heights, *counts, *current, *buckets, *next, *queue;
+    int n, src, sink, head, tail, u, v, a, highest, min_height, old_height;
+    long int amount;
+
+
+    src = get_csr_index_from_id(csr, src_nid);
+    sink = get_csr_index_from_id(csr, sink_nid);
+
+    if (csr == NULL || !check_flow_input(csr, src, sink, "push_relabel_max_flow"))
+    {
+        return NULL;
+    }
+
+    n = csr->node_count;
+    result = NULL;
+    excess = NULL;
+    heights = NULL;
+    counts = NULL;
+    current = NULL;
+    buckets = NULL;
+    next = NULL;
+    queue = NULL;
+
+    if (
+        ( net = create_flow_network(csr) )
+        && ( excess = (long int*)calloc(n, sizeof(long int)) )
+        && ( heights = (int*)malloc(sizeof(int) * n) )
+        && ( counts = (int*)calloc(2 * n + 1, sizeof(int)) )
+        && ( current = (int*)malloc(sizeof(int) * n) )
+        && ( buckets = (int*)malloc(sizeof(int) * (2 * n + 1)) )
+        && ( next = (int*)malloc(sizeof(int) * n) )
+        && ( queue = (int*)malloc(sizeof(int) * n) )
+    )
+    {
+        /* Initial labels: distances to the sink, or n for the nodes that can't reach it */
+        for (u = 0; u < n; u++)
+        {
+            heights[u] = n;
+            current[u] = net->offsets[u];
+        }
+
+        for (u = 0; u <= 2 * n; u++)
+        {
+            buckets[u] = ERROR_INDEX;
+        }
+
+        heights[sink] = 0;
+        queue[0] = sink;
+        tail = 1;
+
+        for (head = 0; head < tail; head++)
+        {
+            v = queue[head];
+
+            for (a = net->offsets[v]; a < net->offsets[v + 1]; a++)
+            {
+                u = net->heads[a];
+
+                if (net->capacity[net->reverse[a]] > 0 && heights[u] == n && u != sink && u != src)
+                {
+                    heights[u] = heights[v] + 1;
+                    queue[tail] = u;
+                    tail++;
+                }
+            }
+        }
+
+        heights[src] = n;
+
+        for (u = 0; u < n; u++)
+        {
+            counts[heights[u]]++;
+        }
+
+        /* Preflow: all the arcs of the source are saturated */
+        highest = 0;
+
+        for (a = net->offsets[src]; a < net->offsets[src + 1]; a++)
+        {
+            v = net->heads[a];
+            amount = net->capacity[a];
+
+            if (amount > 0 && v != src)
+            {
+                net->capacity[a] = 0;
+                net->capacity[net->reverse[a]] += amount;
+
+                if (excess[v] == 0 && v != sink)
+                {
+                    activate_node(buckets, next, heights, &highest, v);
+                }
+
+                excess[v] += amount;
+            }
+        }
+
+        while (highest >= 0)
+        {
+            u = buckets[highest];
+
+            if (u == ERROR_INDEX)
+            {
+                highest--;
+                continue;
+            }
+
+            buckets[highest] = next[u];
+
+            /* The gap heuristic may have lifted the node after it was inserted */
+            if (heights[u] != highest)
+            {
+                activate_node(buckets, next, heights, &highest, u);
+                continue;
+            }
+
+            /* Discharge */
+            while (excess[u] > 0)
+            {
+                if (current[u] == net->offsets[u + 1])
+                {
+                    /* Relabel */
+                    min_height = 2 * n;
+
+                    for (a = net->offsets[u]; a < net->offsets[u + 1]; a++)
+                    {
+                        if (net->capacity[a] > 0 && heights[net->heads[a]] < min_height)
+                        {
+                            min_height = heights[net->heads[a]];
+                        }
+                    }
+
+                    old_height = heights[u];
+                    counts[old_height]--;
+                    heights[u] = min_height + 1;
+                    current[u] = net->offsets[u];
+
+                    /* Gap: the nodes above an empty label below n can't reach the sink */
+                    if (old_height < n && counts[old_height] == 0)
+                    {
+                        for (v = 0; v < n; v++)
+                        {
+                            if (heights[v] > old_height && heights[v] < n && v != src)
+                            {
+                                counts[heights[v]]--;
+                                heights[v] = n + 1;
+                                counts[n + 1]++;
+                                current[v] = net->offsets[v];
+                            }
+                        }
+
+                        if (heights[u] < n + 1)
+                        {
+                            heights[u] = n + 1;
+                        }
+                    }
+
+                    counts[heights[u]]++;
+                }
+                else
+                {
+                    a = current[u];
+                    v = net->heads[a];
+
+                    if (net->capacity[a] > 0 && heights[u] == heights[v] + 1)
+                    {
+                        /* Push */
+                        amount = (excess[u] < net->capacity[a]) ? excess[u] : net->capacity[a];
+                        net->capacity[a] -= amount;
+                        net->capacity[net->reverse[a]] += amount;
+
+                        if (excess[v] == 0 && v != src && v != sink)
+                        {
+                            activate_node(buckets, next, heights, &highest, v);
+                        }
+
+                        excess[u] -= amount;
+                        excess[v] += amount;
+                    }
+                    else
+                    {
+                        current[u]++;
+                    }
+                }
+            }
+        }
+
+        result = create_flow_result(csr, net, src, excess[sink]);
+    }
+    else
+    {
+        printf("[push_relabel_max_flow()] ERROR: Memory allocation was unsuccessful\n");
+    }
+
+    free(excess);
+    free(heights);
+    free(counts);
+    free(current);
+    free(buckets);
+    free(next);
+    free(queue);
+    net = delete_flow_network(net);
+
+    return result;
+}
+
+
+/*
+ *  Deletes the result of a maximum flow computation
+ * 
+ *  Returns NULL
+ */
+graph_flow_t * delete_graph_flow(graph_flow_t *flow)
+{
+    if (flow)
+    {
+        free(flow->flow);
+        free(flow->source_side);
+        flow->cut = delete_all_revoked_id(flow->cut);
+        free(flow);
+    }
+
+    return NULL;
+}
+
+
+/*
+ *  Helper function of stoer_wagner_min_cut() that returns the representative of the
+ *  merged node that contains the node with index v, compressing the path to it
+ */
+static int find_merged_node(int *parent, int v)
+{
+    int root, next;
+
+
+    root = v;
+
+    while (parent[root] != root)
+    {
+        root = parent[root];
+    }
+
+    while (parent[v] != root)
+    {
+        next = parent[v];
+        parent[v] = root;
+        v = next;
+    }
+
+    return root;
+}
+
+
+/*
+ *  Computes the global minimum cut of the graph, taking its edges without direction (the
+ *  weights of the edges between two nodes in both directions are summed, and self loops are
+ *  ignored), with the Stoer-Wagner Algorithm. Each phase orders the remaining nodes by maximum
+ *  adjacency: starting from any node, the next one is always the most tightly connected to
+ *  those already taken, which is found with a binary heap (the one of the shortest paths 
+ *  workspaces, on negated keys). The weight that links the last node to all the others is 
+ *  a cut, and the last two nodes are then merged, until a single node is left.
+ * 
+ *  The nodes are merged in place on compact arrays: each node keeps a linked list of its
+ *  (neighbour, weight) entries, two lists are merged by linking them in O(1), and the entries
+ *  towards nodes that were merged are redirected with a union-find structure. The whole
+ *  algorithm takes O(V E log V) time and O(V + E) memory. The side of the best cut is
+ *  rebuilt at the end by replaying the merges that preceded it.
+ * 
+ *  NOTE: The edge weights can't be negative
+ * 
+ *  Returns the minimum cut (see graph_cut_t), NULL on error
+ */
+graph_cut_t * stoer_wagner_min_cut(graph_csr_t *csr)
+{
+    graph_cut_t *result;
+    graph_sssp_t *heap;
+    int *parent, *head, *tail, *next_entry, *targets, *active, *taken, *merged_from, *merged_into;
+    long int *entry_weights, *keys;
+    int n, e, u, v, i, phase, last, previous, best_phase, count;
+    long int best;
+
+
+    if (csr == NULL || csr->node_count < 2 || csr->min_weight < 0)
+    {
+        printf("[stoer_wagner_min_cut()] ERROR: The graph needs at least two nodes and non-negative edge weights\n");
+        return NULL;
+    }
+
+    n = csr->node_count;
+    result = NULL;
+    parent = NULL;
+    head = NULL;
+    tail = NULL;
+    next_entry = NULL;
+    targets = NULL;
+    active = NULL;
+    taken = NULL;
+    merged_from = NULL;
+    merged_into = NULL;
+    entry_weights = NULL;
+    keys = NULL;
+
+    if (
+        ( heap = create_sssp(n) )
+        && ( parent = (int*)malloc(sizeof(int) * n) )
+        && ( head = (int*)malloc(sizeof(int) * n) )
+        && ( tail = (int*)malloc(sizeof(int) * n) )
+        && ( next_entry = (int*)malloc(sizeof(int) * (2 * csr->edge_count + 1)) )
+        && ( targets = (int*)malloc(sizeof(int) * (2 * csr->edge_count + 1)) )
+        && ( entry_weights = (long int*)malloc(sizeof(long int) * (2 * csr->edge_count + 1)) )
+        && ( active = (int*)malloc(sizeof(int) * n) )
+        && ( taken = (int*)malloc(sizeof(int) * n) )
+        && ( merged_from = (int*)malloc(sizeof(int) * n) )
+        && ( merged_into = (int*)malloc(sizeof(int) * n) )
+        && ( keys = (long int*)malloc(sizeof(long int) * n) )
+        && ( result = (graph_cut_t*)calloc(1, sizeof(graph_cut_t)) )
+        && ( result->side = (bool_t*)calloc(n, sizeof(bool_t)) )
+    )
+    {
+        for (u = 0; u < n; u++)
+        {
+            parent[u] = u;
+            head[u] = ERROR_INDEX;
+            tail[u] = ERROR_INDEX;
+            active[u] = u;
+            taken[u] = ERROR_INDEX;
+        }
+
+        /* Two entries for every edge, one in the list of each endpoint */
+        count = 0;
+
+        for (e = 0; e < csr->edge_count; e++)
+        {
+            u = csr->sources[e];
+            v = csr->targets[e];
+
+            if (u != v)
+            {
+                targets[count] = v;
+                entry_weights[count] = csr->weights[e];
+                next_entry[count] = head[u];
+                tail[u] = (head[u] == ERROR_INDEX) ? count : tail[u];
+                head[u] = count;
+                count++;
+
+                targets[count] = u;
+                entry_weights[count] = csr->weights[e];
+                next_entry[count] = head[v];
+                tail[v] = (head[v] == ERROR_INDEX) ? count : tail[v];
+                head[v] = count;
+                count++;
+            }
+        }
+
+        best = GRAPH_DIST_INF;
+        best_phase = 0;
+
+        /* The nodes still active during a phase are active[0 .. n - phase - 1] */
+        for (phase = 0; phase < n - 1; phase++)
+        {
+            /* Maximum adjacency ordering, on a min-heap of the negated keys */
+            sssp_begin_search(heap);
+
+            for (i = 0; i < n - phase; i++)
+            {
+                sssp_reach(heap, active[i]);
+                keys[active[i]] = 0;
+                sssp_heap_push(heap, active[i], 0);
+            }
+
+            last = ERROR_INDEX;
+            previous = ERROR_INDEX;
+
+            while (heap->heap_size > 0)
+            {
+                previous = last;
+                last = sssp_heap_pop(heap);
+                taken[last] = phase;
+
+                for (i = head[last]; i != ERROR_INDEX; i = next_entry[i])
+                {
+                    v = find_merged_node(parent, targets[i]);
+
+                    if (v != last && taken[v] != phase)
+                    {
+                        keys[v] += entry_weights[i];
+                        sssp_heap_push(heap, v, -keys[v]);
+                    }
+                }
+            }
+
+            /* Cut of the phase: the last node against all the others */
+            if (keys[last] < best)
+            {
+                best = keys[last];
+                best_phase = phase;
+            }
+
+            /* Merge of the last node into the previous one, linking their entry lists */
+            merged_from[phase] = last;
+            merged_into[phase] = previous;
+            parent[last] = previous;
+
+            if (head[last] != ERROR_INDEX)
+            {
+                if (head[previous] == ERROR_INDEX)
+                {
+                    head[previous] = head[last];
+                }
+                else
+                {
+                    next_entry[tail[previous]] = head[last];
+                }
+
+                tail[previous] = tail[last];
+            }
+
+            i = 0;
+
+            while (active[i] != last)
+            {
+                i++;
+            }
+
+            active[i] = active[n - phase - 1];
+        }
+
+        /* The side of the best cut is made of the nodes merged into its last node before it */
+        for (u = 0; u < n; u++)
+        {
+            parent[u] = u;
+        }
+
+        for (phase = 0; phase < best_phase; phase++)
+        {
+            parent[merged_from[phase]] = merged_into[phase];
+        }
+
+        last = merged_from[best_phase];
+
+        for (u = 0; u < n; u++)
+        {
+            result->side[u] = (find_merged_node(parent, u) == last);
+        }
+
+        for (e = csr->edge_count - 1; e >= 0; e--)
+        {
+            if (result->side[csr->sources[e]] != result->side[csr->targets[e]])
+            {
+                result->cut = push_id(result->cut, csr->edges[e]->id);
+            }
+        }
+
+        result->node_count = n;
+        result->value = best;
+    }
+    else
+    {
+        printf("[stoer_wagner_min_cut()] ERROR: Memory allocation was unsuccessful\n");
+        result = delete_graph_cut(result);
+    }
+
+    heap = delete_sssp(heap);
+    free(parent);
+    free(head);
+    free(tail);
+    free(next_entry);
+    free(targets);
+    free(entry_weights);
+    free(active);
+    free(taken);
+    free(merged_from);
+    free(merged_into);
+    free(keys);
+
+    return result;
+}
+
+
+/*
+ *  Deletes a minimum cut returned by stoer_wagner_min_cut()
+ * 
+ *  Returns NULL
+ */
+graph_cut_t * delete_graph_cut(graph_cut_t *cut)
+{
+    if (cut)
+    {
+        free(cut->side);
+        cut->cut = delete_all_revoked_id(cut->cut);
+        free(cut);
+    }
+
+    return NULL;
+}
+
+
+/*
+ *  Helper function that colors with 0 and 1 the nodes of the neighbour arrays built by
+ *  build_undirected_neighbours(), with a BFS from every uncolored node, so that the two
+ *  endpoints of every edge get different colors. 'queue' is used as scratch.
+ * 
+ *  Returns true if the coloring exists (the graph is bipartite), false otherwise
+ */
+static bool_t color_bipartite(int n, const int *offsets, const int *neighbours, int *colors, int *queue)
+{
+    int root, head, tail, u, v, i;
+
+
+    for (u = 0; u < n; u++)
+    {
+        colors[u] = ERROR_INDEX;
+    }
+
+    for (root = 0; root < n; root++)
+    {
+        if (colors[root] == ERROR_INDEX)
+        {
+            colors[root] = 0;
+            queue[0] = root;
+            tail = 1;
+
+            for (head = 0; head < tail; head++)
+            {
+                u = queue[head];
+
+                for (i = offsets[u]; i < offsets[u + 1]; i++)
+                {
+                    v = neighbours[i];
+
+                    if (colors[v] == ERROR_INDEX)
+                    {
+                        colors[v] = 1 - colors[u];
+                        queue[tail] = v;
+                        tail++;
+                    }
+                    else if (colors[v] == colors[u])
+                    {
+                        return false;
+                    }
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+
+/*
+ *  Checks whether the graph is bipartite, taking its edges without direction, that is
+ *  whether its nodes can be split in two sides with no edge inside the same side (self
+ *  loops excluded). If it is, and 'colors' isn't NULL, the side (0 or 1) of every node 
+ *  index is stored in it: the first node of every connected component is on side 0
+ * 
+ *  Returns true if the graph is bipartite, false otherwise
+ */
+bool_t is_bipartite(graph_csr_t *csr, int *colors)
+{
+    int *offsets, *neighbours, *degrees, *queue, *sides;
+    bool_t bipartite;
+
+
+    bipartite = false;
+
+    if (csr == NULL)
+    {
+        return false;
+    }
+
+    neighbours = NULL;
+    degrees = NULL;
+    queue = NULL;
+    sides = NULL;
+
+    if (
+        ( offsets = (int*)malloc(sizeof(int) * (csr->node_count + 1)) )
+        && ( neighbours = (int*)malloc(sizeof(int) * (2 * csr->edge_count + 1)) )
+        && ( degrees = (int*)malloc(sizeof(int) * (csr->node_count + 1)) )
+        && ( queue = (int*)malloc(sizeof(int) * (csr->node_count + 1)) )
+        && ( sides = (int*)malloc(sizeof(int) * (csr->node_count + 1)) )
+        && build_undirected_neighbours(csr, offsets, neighbours, degrees)
+    )
+    {
+        bipartite = color_bipartite(csr->node_count, offsets, neighbours, sides, queue);
+
+        if (bipartite && colors)
+        {
+            memcpy(colors, sides, sizeof(int) * csr->node_count);
+        }
+    }
+    else
+    {
+        printf("[is_bipartite()] ERROR: Memory allocation was unsuccessful\n");
+    }
+
+    free(offsets);
+    free(neighbours);
+    free(degrees);
+    free(queue);
+    free(sides);
+
+    return bipartite;
+}
+
+
+/*
+ *  Helper function of the matching algorithms that creates their result from the mates of
+ *  the nodes: for every matched pair, the lightest edge between the two nodes (in either 
+ *  direction) is the one reported, and its weight is added to the cost of the matching
+ * 
+ *  Returns the matching, NULL on error
+ */
+static graph_matching_t * create_matching_result(graph_csr_t *csr, const int *colors, const int *mates)
+{
+    graph_matching_t *result;
+    int *pair_edge;
+    int u, e, left;
+
+
+    pair_edge = NULL;
+
+    if (
+        ( result = (graph_matching_t*)calloc(1, sizeof(graph_matching_t)) )
+        && ( result->mate = (int*)malloc(sizeof(int) * (csr->node_count + 1)) )
+        && ( pair_edge = (int*)malloc(sizeof(int) * (csr->node_count + 1)) )
+    )
+    {
+        result->node_count = csr->node_count;
+        memcpy(result->mate, mates, sizeof(int) * csr->node_count);
+
+        for (u = 0; u < csr->node_count; u++)
+        {
+            pair_edge[u] = ERROR_INDEX;
+        }
+
+        /* The pairs are identified by their node on side 0 */
+        for (e = 0; e < csr->edge_count; e++)
+        {
+            left = (colors[csr->sources[e]] == 0) ? csr->sources[e] : csr->targets[e];
+
+            if (
+                mates[csr->sources[e]] == csr->targets[e] 
+                && ( pair_edge[left] == ERROR_INDEX || csr->weights[e] < csr->weights[pair_edge[left]] )
+            )
+            {
+                pair_edge[left] = e;
+            }
+        }
+
+        for (u = csr->node_count - 1; u >= 0; u--)
+        {
+            if (pair_edge[u] != ERROR_INDEX)
+            {
+                result->size++;
+                result->cost += csr->weights[pair_edge[u]];
+                result->edges = push_id(result->edges, csr->edges[pair_edge[u]]->id);
+            }
+        }
+    }
+    else
+    {
+        printf("[create_matching_result()] ERROR: Memory allocation was unsuccessful\n");
+        result = delete_graph_matching(result);
+    }
+
+    free(pair_edge);
+
+    return result;
+}
+
+
+/*
+ *  Computes a maximum cardinality matching of a bipartite graph (see is_bipartite()) with the
+ *  Hopcroft-Karp Algorithm, in O(E sqrt(V)): each phase finds with a BFS from the free nodes
+ *  of side 0 the length of the shortest augmenting paths, and then augments along a maximal
+ *  set of disjoint paths of that length, found with an iterative DFS on the layers of the BFS
+ *  (every node keeps its current position in its neighbour array, as in dinic_max_flow())
+ * 
+ *  Returns the matching (see graph_matching_t), NULL if the graph isn't bipartite or on error
+ */
+graph_matching_t * hopcroft_karp_matching(graph_csr_t *csr)
+{
+    graph_matching_t *result;
+    int *offsets, *neighbours, *degrees, *colors, *mates, *dist, *current, *queue, *stack;
+    int n, u, v, w, i, root, head, tail, depth;
+    bool_t found;
+
+
+    if (csr == NULL)
+    {
+        return NULL;
+    }
+
+    n = csr->node_count;
+    result = NULL;
+    neighbours = NULL;
+    degrees = NULL;
+    colors = NULL;
+    mates = NULL;
+    dist = NULL;
+    current = NULL;
+    queue = NULL;
+    stack = NULL;
+
+    if (
+        ( offsets = (int*)malloc(sizeof(int) * (n + 1)) )
+        && ( neighbours = (int*)malloc(sizeof(int) * (2 * csr->edge_count + 1)) )
+        && ( degrees = (int*)malloc(sizeof(int) * (n + 1)) )
+        && ( colors = (int*)malloc(sizeof(int) * (n + 1)) )
+        && ( mates = (int*)malloc(sizeof(int) * (n + 1)) )
+        && ( dist = (int*)malloc(sizeof(int) * (n + 1)) )
+        && ( current = (int*)malloc(sizeof(int) * (n + 1)) )
+        && ( queue = (int*)malloc(sizeof(int) * (n + 1)) )
+        && ( stack = (int*)malloc(sizeof(int) * (n + 1)) )
+        && build_undirected_neighbours(csr, offsets, neighbours, degrees)
+    )
+    {
+        if (color_bipartite(n, offsets, neighbours, colors, queue))
+        {
+            for (u = 0; u < n; u++)
+            {
+                mates[u] = ERROR_INDEX;
+            }
+
+            found = true;
+
+            while (found)
+            {
+                /* Layers of the alternating paths, from the free nodes of side 0 */
+                tail = 0;
+
+                for (u = 0; u < n; u++)
+                {
+                    dist[u] = INT_MAX;
+
+                    if (colors[u] == 0 && mates[u] == ERROR_INDEX)
+                    {
+                        dist[u] = 0;
+                        queue[tail] = u;
+                        tail++;
+                    }
+                }
+
+                found = false;
+
+                for (head = 0; head < tail; head++)
+                {
+                    u = queue[head];
+
+                    for (i = offsets[u]; i < offsets[u + 1]; i++)
+                    {
+                        w = mates[neighbours[i]];
+
+                        if (w == ERROR_INDEX)
+                        {
+                            found = true;
+                        }
+                        else if (dist[w] == INT_MAX)
+                        {
+                            dist[w] = dist[u] + 1;
+                            queue[tail] = w;
+                            tail++;
+                        }
+                    }
+                }
+
+                if (!found)
+                {
+                    break;
+                }
+
+                for (u = 0; u < n; u++)
+                {
+                    current[u] = offsets[u];
+                }
+
+                /* Disjoint augmenting paths, the nodes of side 0 of each one kept in 'stack' */
+                for (root = 0; root < n; root++)
+                {
+                    if (colors[root] != 0 || mates[root] != ERROR_INDEX)
+                    {
+                        continue;
+                    }
+
+                    stack[0] = root;
+                    depth = 1;
+
+                    while (depth > 0)
+                    {
+                        u = stack[depth - 1];
+
+                        if (current[u] == offsets[u + 1])
+                        {
+                            /* Dead end for the rest of the phase */
+                            dist[u] = INT_MAX;
+                            depth--;
+
+                            if (depth > 0)
+                            {
+                                current[stack[depth - 1]]++;
+                            }
+                        }
+                        else
+                        {
+                            v = neighbours[current[u]];
+                            w = mates[v];
+
+                            if (w == ERROR_INDEX)
+                            {
+                                /* Augmentation along the path */
+                                for (i = depth - 1; i >= 0; i--)
+                                {
+                                    u = stack[i];
+                                    v = neighbours[current[u]];
+                                    mates[u] = v;
+                                    mates[v] = u;
+                                }
+
+                                depth = 0;
+                            }
+                            else if (dist[w] == dist[u] + 1)
+                            {
+                                stack[depth] = w;
+                                depth++;
+                            }
+                            else
+                            {
+                                current[u]++;
+                            }
+                        }
+                    }
+                }
+            }
+
+            result = create_matching_result(csr, colors, mates);
+        }
+        else
+        {
+            printf("[hopcroft_karp_matching()] ERROR: The graph isn't bipartite\n");
+        }
+    }
+    else
+    {
+        printf("[hopcroft_karp_matching()] ERROR: Memory allocation was unsuccessful\n");
+    }
+
+    free(offsets);
+    free(neighbours);
+    free(degrees);
+    free(colors);
+    free(mates);
+    free(dist);
+    free(current);
+    free(queue);
+    free(stack);
+
+    return result;
+}
+
+
+/*
+ *  Computes a minimum cost assignment of a bipartite graph (see is_bipartite()) with the 
+ *  Hungarian Algorithm, using the edge weights as costs: every node of the smaller side is
+ *  assigned to a different node of the other side, so that the total cost is the smallest.
+ *  The costs are stored in a dense rows x columns matrix (the lightest edge between each
+ *  pair, in either direction), where the pairs without an edge get a cost higher than any
+ *  assignment made of edges only, so as many nodes as possible are matched and those pairs
+ *  are left out of the result. The version with potentials takes O(rows^2 columns) time,
+ *  which suits dense graphs, while hopcroft_karp_matching() suits the sparse ones.
+ * 
+ *  NOTE: The matrix holds rows x columns long integers, and at most ASSIGNMENT_MAX_CELLS
+ * 
+ *  Returns the matching (see graph_matching_t), NULL if the graph isn't bipartite or on error
+ */
+graph_matching_t * hungarian_assignment(graph_csr_t *csr)
+{
+    graph_matching_t *result;
+    long int *cost, *row_potential, *column_potential, *min_slack;
+    int *colors, *index_of, *row_node, *column_node, *assigned, *way, *mates;
+    bool_t *used;
+    int n, rows, columns, u, v, e, i, j, row, column, next_column, side;
+    long int missing, delta, reduced;
+
+
+    if (csr == NULL || !( colors = (int*)malloc(sizeof(int) * (csr->node_count + 1)) ))
+    {
+        return NULL;
+    }
+
+    if (!is_bipartite(csr, colors))
+    {
+        printf("[hungarian_assignment()] ERROR: The graph isn't bipartite\n");
+        free(colors);
+        return NULL;
+    }
+
+    n = csr->node_count;
+    result = NULL;
+    cost = NULL;
+    row_potential = NULL;
+    column_potential = NULL;
+    min_slack = NULL;
+    index_of = NULL;
+    row_node = NULL;
+    column_node = NULL;
+    assigned = NULL;
+    way = NULL;
+    mates = NULL;
+    used = NULL;
+
+    /* The rows are the nodes of the smaller side */
+    rows = 0;
+
+    for (u = 0; u < n; u++)
+    {
+        rows += (colors[u] == 0);
+    }
+
+    side = (rows <= n - rows) ? 0 : 1;
+    rows = (side == 0) ? rows : n - rows;
+    columns = n - rows;
+
+    if ((double)rows * columns > ASSIGNMENT_MAX_CELLS)
+    {
+        printf("[hungarian_assignment()] ERROR: The cost matrix would have more than %d cells\n", ASSIGNMENT_MAX_CELLS);
+    }
+    else if (
+        ( cost = (long int*)malloc(sizeof(long int) * ((size_t)rows * columns + 1)) )
+        && ( row_potential = (long int*)calloc(rows + 1, sizeof(long int)) )
+        && ( column_potential = (long int*)calloc(columns + 1, sizeof(long int)) )
+        && ( min_slack = (long int*)malloc(sizeof(long int) * (columns + 1)) )
+        && ( index_of = (int*)malloc(sizeof(int) * (n + 1)) )
+        && ( row_node = (int*)malloc(sizeof(int) * (rows + 1)) )
+        && ( column_node = (int*)malloc(sizeof(int) * (columns + 1)) )
+        && ( assigned = (int*)calloc(columns + 1, sizeof(int)) )
+        && ( way = (int*)calloc(columns + 1, sizeof(int)) )
+        && ( mates = (int*)malloc(sizeof(int) * (n + 1)) )
+        && ( used = (bool_t*)malloc(sizeof(bool_t) * (columns + 1)) )
+    )
+    {
+        /* Rows and columns are numbered from 1, as the 0 column is the virtual start */
+        row = 0;
+        column = 0;
+
+        for (u = 0; u < n; u++)
+        {
+            mates[u] = ERROR_INDEX;
+
+            if (colors[u] == side)
+            {
+                row++;
+                index_of[u] = row;
+                row_node[row] = u;
+            }
+            else
+            {
+                column++;
+                index_of[u] = column;
+                column_node[column] = u;
+            }
+        }
+
+        /* Higher than the difference between the costs of any two assignments of the rows */
+        missing = 1 + (long int)(rows + 1) * (labs((long int)csr->max_weight) + labs((long int)csr->min_weight) + 1);
+
+        for (i = 0; i < rows * columns; i++)
+        {
+            cost[i] = missing;
+        }
+
+        for (e = 0; e < csr->edge_count; e++)
+        {
+            u = (colors[csr->sources[e]] == side) ? csr->sources[e] : csr->targets[e];
+            v = (colors[csr->sources[e]] == side) ? csr->targets[e] : csr->sources[e];
+
+            if (u != v)
+            {
+                i = (index_of[u] - 1) * columns + (index_of[v] - 1);
+
+                if (csr->weights[e] < cost[i])
+                {
+                    cost[i] = csr->weights[e];
+                }
+            }
+        }
+
+        /* Each row is added with a shortest augmenting path on the reduced costs */
+        for (row = 1; row <= rows; row++)
+        {
+            assigned[0] = row;
+            column = 0;
+
+            for (j = 0; j <= columns; j++)
+            {
+                min_slack[j] = GRAPH_DIST_INF;
+                used[j] = false;
+            }
+
+            do
+            {
+                used[column] = true;
+                i = assigned[column];
+                delta = GRAPH_DIST_INF;
+                next_column = 0;
+
+                for (j = 1; j <= columns; j++)
+                {
+                    if (!used[j])
+                    {
+                        reduced = cost[(i - 1) * columns + (j - 1)] - row_potential[i] - column_potential[j];
+
+                        if (reduced < min_slack[j])
+                        {
+                            min_slack[j] = reduced;
+                            way[j] = column;
+                        }
+
+                        if (min_slack[j] < delta)
+                        {
+                            delta = min_slack[j];
+                            next_column = j;
+                        }
+                    }
+                }
+
+                for (j = 0; j <= columns; j++)
+                {
+                    if (used[j])
+                    {
+                        row_potential[assigned[j]] += delta;
+                        column_potential[j] -= delta;
+                    }
+                    else
+                    {
+                        min_slack[j] -= delta;
+                    }
+                }
+
+                column = next_column;
+            }
+            while (assigned[column] != 0);
+
+            /* Augmentation along the alternating path */
+            do
+            {
+                next_column = way[column];
+                assigned[column] = assigned[next_column];
+                column = next_column;
+            }
+            while (column != 0);
+        }
+
+        /* Only the assigned pairs linked by an edge are kept */
+        for (j = 1; j <= columns; j++)
+        {
+            if (assigned[j] != 0 && cost[(assigned[j] - 1) * columns + (j - 1)] != missing)
+            {
+                mates[row_node[assigned[j]]] = column_node[j];
+                mates[column_node[j]] = row_node[assigned[j]];
+            }
+        }
+
+        result = create_matching_result(csr, colors, mates);
+    }
+    else
+    {
+        printf("[hungarian_assignment()] ERROR: Memory allocation was unsuccessful\n");
+    }
+
+    free(colors);
+    free(cost);
+    free(row_potential);
+    free(column_potential);
+    free(min_slack);
+    free(index_of);
+    free(row_node);
+    free(column_node);
+    free(assigned);
+    free(way);
+    free(mates);
+    free(used);
+
+    return result;
+}
+
+
+/*
+ *  Deletes a matching returned by hopcroft_karp_matching() or hungarian_assignment()
+ * 
+ *  Returns NULL
+ */
+graph_matching_t * delete_graph_matching(graph_matching_t *matching)
+{
+    if (matching)
+    {
+        free(matching->mate);
+        matching->edges = delete_all_revoked_id(matching->edges);
+        free(matching);
+    }
+
+    return NULL;
+}
+
+
+/*
+ *  Helper function of the coloring algorithms that returns the smallest color not used by
+ *  the already colored neighbours of the node with index v, marking their colors in 
+ *  'forbidden' with the stamp v + 1 (so the array never needs to be cleared)
+ */
+static int smallest_free_color(const int *offsets, const int *neighbours, const int *colors, int *forbidden, int v)
+{
+    int i, color;
+
+
+    for (i = offsets[v]; i < offsets[v + 1]; i++)
+    {
+        if (colors[neighbours[i]] != ERROR_INDEX)
+        {
+            forbidden[colors[neighbours[i]]] = v + 1;
+        }
+    }
+
+    color = 0;
+
+    while (forbidden[color] == v + 1)
+    {
+        color++;
+    }
+
+    return color;
+}
+
+
+/*
+ *  Colors the nodes of the graph so that the endpoints of every edge get different colors,
+ *  taking the edges without direction (see build_undirected_neighbours()), with the greedy 
+ *  algorithm: each node, in the given order, gets the smallest color not used by its
+ *  neighbours, so at most max_degree + 1 colors are used. The orders are:
+ * 
+ *      - NATURAL_ORDER: the order of the nodes in the graph
+ *      - LARGEST_FIRST_ORDER: by decreasing degree (sorted with buckets)
+ *      - SMALLEST_LAST_ORDER: the reverse of the removal order by smallest degree (see 
+ *        peel_min_degree()), which uses at most degeneracy + 1 colors
+ * 
+ *  all of which take O(V + E).
+ * 
+ *  Returns the array of the colors (0, 1, ...) indexed by node index, NULL on error
+ */
+int * greedy_coloring(graph_csr_t *csr, coloring_order_t ordering)
+{
+    int *colors, *offsets, *neighbours, *degrees, *order, *forbidden, *bucket;
+    int n, i, v, max_degree, start, count;
+
+
+    if (csr == NULL)
+    {
+        return NULL;
+    }
+
+    n = csr->node_count;
+    offsets = NULL;
+    neighbours = NULL;
+    degrees = NULL;
+    order = NULL;
+    forbidden = NULL;
+
+    if (
+        ( colors = (int*)malloc(sizeof(int) * (n + 1)) )
+        && ( offsets = (int*)malloc(sizeof(int) * (n + 1)) )
+        && ( neighbours = (int*)malloc(sizeof(int) * (2 * csr->edge_count + 1)) )
+        && ( degrees = (int*)malloc(sizeof(int) * (n + 1)) )
+        && ( order = (int*)malloc(sizeof(int) * (n + 1)) )
+        && ( forbidden = (int*)calloc(n + 1, sizeof(int)) )
+        && build_undirected_neighbours(csr, offsets, neighbours, degrees)
+    )
+    {
+        if (ordering == LARGEST_FIRST_ORDER)
+        {
+            /* Counting sort by decreasing degree, with 'colors' as the buckets */
+            bucket = colors;
+            max_degree = 0;
+
+            for (v = 0; v < n; v++)
+            {
+                max_degree = (degrees[v] > max_degree) ? degrees[v] : max_degree;
+            }
+
+            for (i = 0; i <= max_degree; i++)
+            {
+                bucket[i] = 0;
+            }
+
+            for (v = 0; v < n; v++)
+            {
+                bucket[max_degree - degrees[v]]++;
+            }
+
+            start = 0;
+
+            for (i = 0; i <= max_degree; i++)
+            {
+                count = bucket[i];
+                bucket[i] = start;
+                start += count;
+            }
+
+            for (v = 0; v < n; v++)
+            {
+                order[bucket[max_degree - degrees[v]]++] = v;
+            }
+        }
+        else if (ordering == SMALLEST_LAST_ORDER)
+        {
+            if (!peel_min_degree(n, offsets, neighbours, degrees, order))
+            {
+                free(colors);
+                colors = NULL;
+            }
+
+            /* The last removed node is colored first */
+            for (i = 0; colors && i < n / 2; i++)
+            {
+                v = order[i];
+                order[i] = order[n - 1 - i];
+                order[n - 1 - i] = v;
+            }
+        }
+        else
+        {
+            for (v = 0; v < n; v++)
+            {
+                order[v] = v;
+            }
+        }
+
+        for (v = 0; colors && v < n; v++)
+        {
+            colors[v] = ERROR_INDEX;
+        }
+
+        for (i = 0; colors && i < n; i++)
+        {
+            colors[order[i]] = smallest_free_color(offsets, neighbours, colors, forbidden, order[i]);
+        }
+    }
+    else
+    {
+        free(colors);
+        colors = NULL;
+    }
+
+    if (colors == NULL)
+    {
+        printf("[greedy_coloring()] ERROR: Memory allocation was unsuccessful\n");
+    }
+
+    free(offsets);
+    free(neighbours);
+    free(degrees);
+    free(order);
+    free(forbidden);
+
+    return colors;
+}
+
+
+/*
+ *  Colors the nodes of the graph so that the endpoints of every edge get different colors,
+ *  taking the edges without direction, with the DSatur Algorithm: the next node to color is
+ *  always the one whose neighbours already use the most distinct colors (its saturation), 
+ *  with ties broken by degree, and it gets the smallest color they don't use. The nodes are 
+ *  kept in a binary heap (the one of the shortest paths workspaces, on negated keys), and 
+ *  the colors seen by each node are marked in a bitset with degree + 1 bits, which is enough
+ *  for all the colors it could get; only larger colors are looked for among its neighbours. 
+ *  It usually uses fewer colors than greedy_coloring(), in O((V + E) log V).
+ * 
+ *  Returns the array of the colors (0, 1, ...) indexed by node index, NULL on error
+ */
+int * dsatur_coloring(graph_csr_t *csr)
+{
+    graph_sssp_t *heap;
+    bitset_word_t *seen;
+    int *colors, *offsets, *neighbours, *degrees, *saturation, *forbidden;
+    int n, i, j, v, w, color;
+    long int bit;
+    bool_t found;
+
+
+    if (csr == NULL)
+    {
+        return NULL;
+    }
+
+    n = csr->node_count;
+    colors = NULL;
+    offsets = NULL;
+    neighbours = NULL;
+    degrees = NULL;
+    saturation = NULL;
+    forbidden = NULL;
+    seen = NULL;
+
+    if (
+        ( heap = create_sssp(n + 1) )
+        && ( colors = (int*)malloc(sizeof(int) * (n + 1)) )
+        && ( offsets = (int*)malloc(sizeof(int) * (n + 1)) )
+        && ( neighbours = (int*)malloc(sizeof(int) * (2 * csr->edge_count + 1)) )
+        && ( degrees = (int*)malloc(sizeof(int) * (n + 1)) )
+        && ( saturation = (int*)calloc(n + 1, sizeof(int)) )
+        && ( forbidden = (int*)calloc(n + 1, sizeof(int)) )
+        && ( seen = (bitset_word_t*)calloc(BITSET_WORDS(2 * csr->edge_count + n + 1), sizeof(bitset_word_t)) )
+        && build_undirected_neighbours(csr, offsets, neighbours, degrees)
+    )
+    {
+        /* The bits of the node v go from offsets[v] + v to offsets[v + 1] + v */
+        sssp_begin_search(heap);
+
+        for (v = 0; v < n; v++)
+        {
+            colors[v] = ERROR_INDEX;
+            sssp_reach(heap, v);
+            sssp_heap_push(heap, v, -(long int)degrees[v]);
+        }
+
+        while (heap->heap_size > 0)
+        {
+            v = sssp_heap_pop(heap);
+            color = smallest_free_color(offsets, neighbours, colors, forbidden, v);
+            colors[v] = color;
+
+            for (i = offsets[v]; i < offsets[v + 1]; i++)
+            {
+                w = neighbours[i];
+
+                if (colors[w] != ERROR_INDEX)
+                {
+                    continue;
+                }
+
+                /* Is the color new among the neighbours of w? */
+                if (color <= degrees[w])
+                {
+                    bit = (long int)offsets[w] + w + color;
+                    found = BITSET_GET(seen, bit) ? true : false;
+                    BITSET_SET(seen, bit);
+                }
+                else
+                {
+                    found = false;
+
+                    for (j = offsets[w]; j < offsets[w + 1] && !found; j++)
+                    {
+                        found = (neighbours[j] != v && colors[neighbours[j]] == color);
+                    }
+                }
+
+                if (!found)
+                {
+                    saturation[w]++;
+                    sssp_heap_push(heap, w, -((long int)saturation[w] * (n + 1) + degrees[w]));
+                }
+            }
+        }
+    }
+    else
+    {
+        printf("[dsatur_coloring()] ERROR: Memory allocation was unsuccessful\n");
+        free(colors);
+        colors = NULL;
+    }
+
+    heap = delete_sssp(heap);
+    free(offsets);
+    free(neighbours);
+    free(degrees);
+    free(saturation);
+    free(forbidden);
+    free(seen);
+
+    return colors;
+}
+
+
+/*
+ *  Helper function of jones_plassmann_coloring() that returns the random priority of the 
+ *  node with index v, obtained by mixing its index with the seed (the same pair always 
+ *  gives the same priority, so no array is needed and every thread can compute it)
+ */
+static unsigned int coloring_priority(unsigned int seed, int v)
+{
+    unsigned int x;
+
+
+    x = (unsigned int)v * 0x9E3779B1u + seed;
+    x ^= x >> 16;
+    x *= 0x85EBCA6Bu;
+    x ^= x >> 13;
+    x *= 0xC2B2AE35u;
+    x ^= x >> 16;
+
+    return x;
+}
+
+
+/*
+ *  Colors the nodes of the graph so that the endpoints of every edge get different colors,
+ *  taking the edges without direction, with the parallel Jones-Plassmann Algorithm: every 
+ *  node gets a random priority, and in each round the uncolored nodes whose priority is 
+ *  higher than the one of all their uncolored neighbours (which can't be adjacent) get the 
+ *  smallest color not used by their neighbours, all at the same time. Each round first marks
+ *  the nodes to color and then colors them, so no thread reads a color while it's written.
+ *  The result is the same for every number of threads, and uses about as many colors as
+ *  greedy_coloring() with a random order.
+ * 
+ *  Returns the array of the colors (0, 1, ...) indexed by node index, NULL on error
+ */
+int * jones_plassmann_coloring(graph_csr_t *csr, unsigned int seed)
+{
+    int *colors, *offsets, *neighbours, *degrees, *pending, *forbidden;
+    bool_t *selected;
+    int n, t, threads, i, j, v, w, remaining, kept;
+    unsigned int priority, other;
+
+
+    if (csr == NULL)
+    {
+        return NULL;
+    }
+
+    n = csr->node_count;
+    threads = get_thread_count();
+    offsets = NULL;
+    neighbours = NULL;
+    degrees = NULL;
+    pending = NULL;
+    forbidden = NULL;
+    selected = NULL;
+
+    if (
+        ( colors = (int*)malloc(sizeof(int) * (n + 1)) )
+        && ( offsets = (int*)malloc(sizeof(int) * (n + 1)) )
+        && ( neighbours = (int*)malloc(sizeof(int) * (2 * csr->edge_count + 1)) )
+        && ( degrees = (int*)malloc(sizeof(int) * (n + 1)) )
+        && ( pending = (int*)malloc(sizeof(int) * (n + 1)) )
+        && ( forbidden = (int*)calloc((size_t)(n + 1) * threads, sizeof(int)) )
+        && ( selected = (bool_t*)calloc(n + 1, sizeof(bool_t)) )
+        && build_undirected_neighbours(csr, offsets, neighbours, degrees)
+    )
+    {
+        for (v = 0; v < n; v++)
+        {
+            colors[v] = ERROR_INDEX;
+            pending[v] = v;
+        }
+
+        remaining = n;
+
+        while (remaining > 0)
+        {
+            /* Local maxima of the priorities among the uncolored nodes (ties by index) */
+            #ifdef _OPENMP
+                #pragma omp parallel for schedule(dynamic, 256) private(v, w, j, priority, other)
+            #endif
+            for (i = 0; i < remaining; i++)
+            {
+                v = pending[i];
+                priority = coloring_priority(seed, v);
+                selected[v] = true;
+
+                for (j = offsets[v]; j < offsets[v + 1] && selected[v]; j++)
+                {
+                    w = neighbours[j];
+                    other = coloring_priority(seed, w);
+
+                    if (colors[w] == ERROR_INDEX && (other > priority || (other == priority && w > v)))
+                    {
+                        selected[v] = false;
+                    }
+                }
+            }
+
+            #ifdef _OPENMP
+                #pragma omp parallel for schedule(dynamic, 256) private(v, t)
+            #endif
+            for (i = 0; i < remaining; i++)
+            {
+                v = pending[i];
+
+                if (selected[v])
+                {
+                    t = get_thread_id();
+                    colors[v] = smallest_free_color(offsets, neighbours, colors, forbidden + (size_t)t * (n + 1), v);
+                }
+            }
+
+            kept = 0;
+
+            for (i = 0; i < remaining; i++)
+            {
+                if (colors[pending[i]] == ERROR_INDEX)
+                {
+                    pending[kept] = pending[i];
+                    kept++;
+                }
+            }
+
+            remaining = kept;
+        }
+    }
+    else
+    {
+        printf("[jones_plassmann_coloring()] ERROR: Memory allocation was unsuccessful\n");
+        free(colors);
+        colors = NULL;
+    }
+
+    free(offsets);
+    free(neighbours);
+    free(degrees);
+    free(pending);
+    free(forbidden);
+    free(selected);
+
+    return colors;
+}
+
+
+/*
+ *  Helper function that deletes the given community level graph
+ */
+static graph_community_level_t * delete_community_level(graph_community_level_t *level)
+{
+    if (level)
+    {
+        free(level->offsets);
+        free(level->targets);
+        free(level->weights);
+        free(level->strength);
+        free(level);
+    }
+
+    return NULL;
+}
+
+
+/*
+ *  Helper function that builds the level graph of the compact view, where every edge u -> v
+ *  of weight w is stored as w in the rows of both u and v (a self loop as 2w in its row, so
+ *  that it counts twice in the strength of its node). Parallel edges are left as separate
+ *  entries, and are summed by aggregate_community_level()
+ * 
+ *  Returns the level graph, NULL on error
+ */
+static graph_community_level_t * create_community_level(graph_csr_t *csr)
+{
+    graph_community_level_t *level;
+    int *position;
+    int n, u, v, e;
+
+
+    n = csr->node_count;
+    position = NULL;
+
+    if (
+        !( level = (graph_community_level_t*)calloc(1, sizeof(graph_community_level_t)) )
+        || !( level->offsets = (int*)calloc(n + 1, sizeof(int)) )
+        || !( level->targets = (int*)malloc(sizeof(int) * (2 * csr->edge_count + 1)) )
+        || !( level->weights = (long int*)malloc(sizeof(long int) * (2 * csr->edge_count + 1)) )
+        || !( level->strength = (long int*)calloc(n + 1, sizeof(long int)) )
+        || !( position = (int*)malloc(sizeof(int) * (n + 1)) )
+    )
+    {
+        printf("[create_community_level()] ERROR: Memory allocation was unsuccessful\n");
+        level = delete_community_level(level);
+    }
+    else
+    {
+        level->node_count = n;
+
+        for (e = 0; e < csr->edge_count; e++)
+        {
+            level->offsets[csr->sources[e] + 1]++;
+
+            if (csr->sources[e] != csr->targets[e])
+            {
+                level->offsets[csr->targets[e] + 1]++;
+            }
+        }
+
+        for (u = 0; u < n; u++)
+        {
+            level->offsets[u + 1] += level->offsets[u];
+            position[u] = level->offsets[u];
+        }
+
+        for (e = 0; e < csr->edge_count; e++)
+        {
+            u = csr->sources[e];
+            v = csr->targets[e];
+
+            level->targets[position[u]] = v;
+            level->weights[position[u]] = (u == v) ? 2L * csr->weights[e] : csr->weights[e];
+            position[u]++;
+
+            if (u != v)
+            {
+                level->targets[position[v]] = u;
+                level->weights[position[v]] = csr->weights[e];
+                position[v]++;
+            }
+        }
+
+        for (u = 0; u < n; u++)
+        {
+            for (e = level->offsets[u]; e < level->offsets[u + 1]; e++)
+            {
+                level->strength[u] += level->weights[e];
+            }
+
+            level->total += level->strength[u];
+        }
+    }
+
+    free(position);
+
+    return level;
+}
+
+
+/*
+ *  Helper function that builds the next level graph of the Louvain Method, where every 
+ *  community of the given level becomes a single node: the entries of all the members of 
+ *  a community are gathered into its row, summing the ones that go to the same community
+ *  (those inside the community become a self loop). The rows are built in parallel, each
+ *  in a region sized by the degrees of its members, and are compacted at the end.
+ *  With every node in its own community, it just sums the parallel entries of the level.
+ * 
+ *  Returns the new level graph, NULL on error
+ */
+static graph_community_level_t * aggregate_community_level(graph_community_level_t *level, const int *community, int count)
+{
+    graph_community_level_t *next;
+    int *members, *first, *lengths, *position;
+    int threads, t, c, i, u, e, d, length;
+    long int start;
+
+
+    threads = get_thread_count();
+    members = NULL;
+    first = NULL;
+    lengths = NULL;
+    position = NULL;
+
+    if (
+        !( next = (graph_community_level_t*)calloc(1, sizeof(graph_community_level_t)) )
+        || !( next->offsets = (int*)calloc(count + 1, sizeof(int)) )
+        || !( next->targets = (int*)malloc(sizeof(int) * (level->offsets[level->node_count] + 1)) )
+        || !( next->weights = (long int*)malloc(sizeof(long int) * (level->offsets[level->node_count] + 1)) )
+        || !( next->strength = (long int*)calloc(count + 1, sizeof(long int)) )
+        || !( members = (int*)malloc(sizeof(int) * (level->node_count + 1)) )
+        || !( first = (int*)calloc(count + 1, sizeof(int)) )
+        || !( lengths = (int*)malloc(sizeof(int) * (count + 1)) )
+        || !( position = (int*)malloc(sizeof(int) * ((size_t)count * threads + 1)) )
+    )
+    {
+        printf("[aggregate_community_level()] ERROR: Memory allocation was unsuccessful\n");
+        next = delete_community_level(next);
+    }
+    else
+    {
+        next->node_count = count;
+        next->total = level->total;
+
+        /* Members grouped by community, and the region of every row */
+        for (u = 0; u < level->node_count; u++)
+        {
+            first[community[u] + 1]++;
+            next->offsets[community[u] + 1] += level->offsets[u + 1] - level->offsets[u];
+        }
+
+        for (c = 0; c < count; c++)
+        {
+            first[c + 1] += first[c];
+            next->offsets[c + 1] += next->offsets[c];
+            lengths[c] = first[c];
+        }
+
+        for (u = 0; u < level->node_count; u++)
+        {
+            members[lengths[community[u]]++] = u;
+        }
+
+        for (i = 0; i < count * threads; i++)
+        {
+            position[i] = ERROR_INDEX;
+        }
+
+        #ifdef _OPENMP
+            #pragma omp parallel for schedule(dynamic, 64) private(t, i, u, e, d, length)
+        #endif
+        for (c = 0; c < count; c++)
+        {
+            t = get_thread_id();
+            length = 0;
+
+            for (i = first[c]; i < first[c + 1]; i++)
+            {
+                u = members[i];
+                next->strength[c] += level->strength[u];
+
+                for (e = level->offsets[u]; e < level->offsets[u + 1]; e++)
+                {
+                    d = community[level->targets[e]];
+
+                    if (position[(size_t)t * count + d] == ERROR_INDEX)
+                    {
+                        position[(size_t)t * count + d] = next->offsets[c] + length;
+                        next->targets[next->offsets[c] + length] = d;
+                        next->weights[next->offsets[c] + length] = level->weights[e];
+                        length++;
+                    }
+                    else
+                    {
+                        next->weights[position[(size_t)t * count + d]] += level->weights[e];
+                    }
+                }
+            }
+
+            for (i = next->offsets[c]; i < next->offsets[c] + length; i++)
+            {
+                position[(size_t)t * count + next->targets[i]] = ERROR_INDEX;
+            }
+
+            lengths[c] = length;
+        }
+
+        /* Every row moves back, so the compaction never overwrites an unread entry */
+        start = 0;
+
+        for (c = 0; c < count; c++)
+        {
+            for (i = 0; i < lengths[c]; i++)
+            {
+                next->targets[start + i] = next->targets[next->offsets[c] + i];
+                next->weights[start + i] = next->weights[next->offsets[c] + i];
+            }
+
+            next->offsets[c] = (int)start;
+            start += lengths[c];
+        }
+
+        next->offsets[count] = (int)start;
+    }
+
+    free(members);
+    free(first);
+    free(lengths);
+    free(position);
+
+    return next;
+}
+
+
+/*
+ *  Helper function that renumbers the communities of the given nodes as 0, 1, ... in the
+ *  order they first appear, so that the IDs are consecutive
+ * 
+ *  Returns the amount of communities, ERROR_INDEX on error
+ */
+static int renumber_communities(int *community, int n)
+{
+    int *renamed;
+    int u, count;
+
+
+    if (!( renamed = (int*)malloc(sizeof(int) * (n + 1)) ))
+    {
+        printf("[renumber_communities()] ERROR: Memory allocation was unsuccessful\n");
+        return ERROR_INDEX;
+    }
+
+    for (u = 0; u < n; u++)
+    {
+        renamed[u] = ERROR_INDEX;
+    }
+
+    count = 0;
+
+    for (u = 0; u < n; u++)
+    {
+        if (renamed[community[u]] == ERROR_INDEX)
+        {
+            renamed[community[u]] = count;
+            count++;
+        }
+
+        community[u] = renamed[community[u]];
+    }
+
+    free(renamed);
+
+    return count;
+}
+
+
+/*
+ *  Helper function that returns the modularity of the given communities (numbered 0 to
+ *  count - 1) of the level graph:
+ * 
+ *      Q = sum over the communities c of ( inside(c) / total - (strength(c) / total)^2 )
+ * 
+ *  where inside(c) is the sum of the entries between members of c, and total is the sum 
+ *  of all the strengths. Returns 0 if the level graph has no weight, or on error
+ */
+static double community_modularity(graph_community_level_t *level, const int *community, int count)
+{
+    long int *strength;
+    long int inside;
+    double modularity;
+    int u, e, c;
+
+
+    if (level->total <= 0 || !( strength = (long int*)calloc(count + 1, sizeof(long int)) ))
+    {
+        return 0;
+    }
+
+    inside = 0;
+
+    #ifdef _OPENMP
+        #pragma omp parallel for schedule(dynamic, 256) private(e) reduction(+:inside)
+    #endif
+    for (u = 0; u < level->node_count; u++)
+    {
+        for (e = level->offsets[u]; e < level->offsets[u + 1]; e++)
+        {
+            if (community[level->targets[e]] == community[u])
+            {
+                inside += level->weights[e];
+            }
+        }
+    }
+
+    for (u = 0; u < level->node_count; u++)
+    {
+        strength[community[u]] += level->strength[u];
+    }
+
+    modularity = (double)inside / level->total;
+
+    for (c = 0; c < count; c++)
+    {
+        modularity -= ((double)strength[c] / level->total) * ((double)strength[c] / level->total);
+    }
+
+    free(strength);
+
+    return modularity;
+}
+
+
+/*
+ *  Helper function of louvain_communities() that moves the nodes of the level graph between
+ *  communities while the modularity grows (local moving phase): every node goes to the
+ *  community of its neighbours with the largest gain
+ * 
+ *      weight(u, c) - strength(u) * strength(c) / total
+ * 
+ *  or stays where it is if no community is strictly better. The nodes are visited in
+ *  parallel and moved at once (asynchronously), with the strengths of the communities 
+ *  updated atomically: a thread may read a slightly stale community of a neighbour, which
+ *  only makes a move less accurate. With a single thread this is the sequential Louvain
+ *  sweep. 'weight' and 'touched' are per-thread workspaces of node_count entries each, 
+ *  with all the weights set to ERROR_INDEX (and left so). The sweeps stop when no node 
+ *  moves, or after LOUVAIN_MAX_SWEEPS
+ */
+static void louvain_move_nodes(graph_community_level_t *level, int *community, long int *strength, long int *weight, int *touched)
+{
+    long int sweep_moves, gain_weight;
+    double gain, best_gain;
+    int n, t, u, e, c, i, best, current, count;
+
+
+    n = level->node_count;
+
+    for (u = 0; u < n; u++)
+    {
+        community[u] = u;
+        strength[u] = level->strength[u];
+    }
+
+    sweep_moves = 1;
+
+    for (i = 0; i < LOUVAIN_MAX_SWEEPS && sweep_moves > 0; i++)
+    {
+        sweep_moves = 0;
+
+        #ifdef _OPENMP
+            #pragma omp parallel for schedule(dynamic, 256) private(t, e, c, best, current, count, gain, best_gain, gain_weight) reduction(+:sweep_moves)
+        #endif
+        for (u = 0; u < n; u++)
+        {
+            t = get_thread_id();
+            current = community[u];
+            count = 0;
+
+            /* Weight from u to every neighbouring community (self loops excluded) */
+            for (e = level->offsets[u]; e < level->offsets[u + 1]; e++)
+            {
+                if (level->targets[e] != u)
+                {
+                    c = community[level->targets[e]];
+
+                    if (weight[(size_t)t * n + c] == ERROR_INDEX)
+                    {
+                        weight[(size_t)t * n + c] = 0;
+                        touched[(size_t)t * n + count] = c;
+                        count++;
+                    }
+
+                    weight[(size_t)t * n + c] += level->weights[e];
+                }
+            }
+
+            gain_weight = (weight[(size_t)t * n + current] == ERROR_INDEX) ? 0 : weight[(size_t)t * n + current];
+            best = current;
+            best_gain = gain_weight - (double)level->strength[u] * (strength[current] - level->strength[u]) / level->total;
+
+            for (e = 0; e < count; e++)
+            {
+                c = touched[(size_t)t * n + e];
+
+                if (c != current)
+                {
+                    gain = weight[(size_t)t * n + c] - (double)level->strength[u] * strength[c] / level->total;
+
+                    if (gain > best_gain)
+                    {
+                        best_gain = gain;
+                        best = c;
+                    }
+                }
+
+                weight[(size_t)t * n + c] = ERROR_INDEX;
+            }
+
+            if (best != current)
+            {
+                #ifdef _OPENMP
+                    #pragma omp atomic
+                #endif
+                strength[current] -= level->strength[u];
+
+                #ifdef _OPENMP
+                    #pragma omp atomic
+                #endif
+                strength[best] += level->strength[u];
+
+                community[u] = best;
+                sweep_moves++;
+            }
+        }
+
+    }
+}
+
+
+/*
+ *  Helper function that creates the result of a community detection with the given 
+ *  communities of the nodes, renumbering them as 0, 1, ...
+ * 
+ *  Returns the result, NULL on error
+ */
+static graph_communities_t * create_communities_result(int *community, int n, int rounds)
+{
+    graph_communities_t *result;
+
+
+    if (( result = (graph_communities_t*)malloc(sizeof(graph_communities_t)) ))
+    {
+        result->node_count = n;
+        result->rounds = rounds;
+        result->modularity = 0;
+        result->community = community;
+        result->count = renumber_communities(community, n);
+
+        if (result->count == ERROR_INDEX)
+        {
+            free(result);
+            result = NULL;
+        }
+    }
+    else
+    {
+        printf("[create_communities_result()] ERROR: Memory allocation was unsuccessful\n");
+    }
+
+    return result;
+}
+
+
+/*
+ *  Finds communities of the graph, taking the edges without direction, with the Louvain 
+ *  Method (Blondel et al.): each level moves the nodes between communities while the 
+ *  modularity grows (see louvain_move_nodes()), then builds a new compact level graph
+ *  whose nodes are the communities found (see aggregate_community_level()), and starts
+ *  again on it, until a level merges nothing. The community of every original node is
+ *  followed through the levels, and since the aggregation keeps the modularity, it's 
+ *  computed on the last level graph. Every level graph is stored in arrays, and each
+ *  level is smaller than the previous one, so the whole method takes about O(E log V).
+ * 
+ *  The edge weights are the ones of the edges (parallel edges are summed), and must not 
+ *  be negative. The result is the same for every run with a single thread, while with
+ *  more threads it depends on the order the nodes are moved in.
+ * 
+ *  Returns the communities of the nodes, NULL on error
+ */
+graph_communities_t * louvain_communities(graph_csr_t *csr)
+{
+    graph_community_level_t *level, *next;
+    graph_communities_t *result;
+    long int *strength, *weight;
+    int *community, *moved, *touched;
+    int n, u, count, rounds, threads;
+    size_t i;
+    bool_t done;
+
+
+    if (csr == NULL || csr->min_weight < 0)
+    {
+        printf("[louvain_communities()] ERROR: Invalid compact view or negative edge weights\n");
+        return NULL;
+    }
+
+    n = csr->node_count;
+    threads = get_thread_count();
+    result = NULL;
+    level = NULL;
+    strength = NULL;
+    weight = NULL;
+    moved = NULL;
+    touched = NULL;
+
+    if (
+        ( community = (int*)malloc(sizeof(int) * (n + 1)) )
+        && ( moved = (int*)malloc(sizeof(int) * (n + 1)) )
+        && ( strength = (long int*)malloc(sizeof(long int) * (n + 1)) )
+        && ( weight = (long int*)malloc(sizeof(long int) * ((size_t)n * threads + 1)) )
+        && ( touched = (int*)malloc(sizeof(int) * ((size_t)n * threads + 1)) )
+        && ( next = create_community_level(csr) )
+    )
+    {
+        for (u = 0; u < n; u++)
+        {
+            community[u] = u;
+        }
+
+        for (i = 0; i < (size_t)n * threads; i++)
+        {
+            weight[i] = ERROR_INDEX;
+        }
+
+        level = aggregate_community_level(next, community, n);
+        next = delete_community_level(next);
+        rounds = 0;
+        done = (level == NULL || level->total == 0);
+
+        while (!done)
+        {
+            rounds++;
+            louvain_move_nodes(level, moved, strength, weight, touched);
+            count = renumber_communities(moved, level->node_count);
+            done = (count == ERROR_INDEX || count == level->node_count);
+
+            if (count == ERROR_INDEX)
+            {
+                level = delete_community_level(level);
+            }
+
+            for (u = 0; count != ERROR_INDEX && u < n; u++)
+            {
+                community[u] = moved[community[u]];
+            }
+
+            if (!done)
+            {
+                next = aggregate_community_level(level, moved, count);
+                level = delete_community_level(level);
+                level = next;
+                done = (level == NULL);
+            }
+        }
+
+        if (level && ( result = create_communities_result(community, n, rounds) ))
+        {
+            /* Without merges left, the nodes of the last level are the communities */
+            for (u = 0; u < level->node_count; u++)
+            {
+                moved[u] = u;
+            }
+
+            result->modularity = community_modularity(level, moved, level->node_count);
+        }
+    }
+    else
+    {
+        printf("[louvain_communities()] ERROR: Memory allocation was unsuccessful\n");
+    }
+
+    if (result == NULL)
+    {
+        free(community);
+    }
+
+    level = delete_community_level(level);
+    free(moved);
+    free(strength);
+    free(weight);
+    free(touched);
+
+    return result;
+}
+
+
+/*
+ *  Finds communities of the graph, taking the edges without direction, with asynchronous
+ *  Label Propagation (Raghavan et al.): every node starts with its own label, and then 
+ *  repeatedly takes the label with the largest total edge weight among its neighbours, 
+ *  keeping its own if it's one of the best (other ties go to the smallest label). The 
+ *  nodes are visited in a random order (with the given seed) and updated in place by all
+ *  the threads at once, so each sweep already sees most of the new labels. It stops when
+ *  no label changes, or after LABEL_PROPAGATION_MAX_ITERATIONS sweeps of O(E) each.
+ * 
+ *  The edge weights are the ones of the edges (parallel edges are summed), and must not 
+ *  be negative; edges with weight 0 don't spread labels. The modularity of the result is 
+ *  computed as well.
+ * 
+ *  Returns the communities of the nodes, NULL on error
+ */
+graph_communities_t * label_propagation_communities(graph_csr_t *csr, unsigned int seed)
+{
+    graph_community_level_t *level, *raw;
+    graph_communities_t *result;
+    long int *weight;
+    int *label, *order, *touched;
+    int n, t, i, j, u, e, c, best, count, iteration, swap, threads;
+    long int changes, best_weight;
+
+
+    if (csr == NULL || csr->min_weight < 0)
+    {
+        printf("[label_propagation_communities()] ERROR: Invalid compact view or negative edge weights\n");
+        return NULL;
+    }
+
+    n = csr->node_count;
+    threads = get_thread_count();
+    result = NULL;
+    level = NULL;
+    raw = NULL;
+    order = NULL;
+    weight = NULL;
+    touched = NULL;
+
+    if (
+        ( label = (int*)malloc(sizeof(int) * (n + 1)) )
+        && ( order = (int*)malloc(sizeof(int) * (n + 1)) )
+        && ( weight = (long int*)malloc(sizeof(long int) * ((size_t)n * threads + 1)) )
+        && ( touched = (int*)malloc(sizeof(int) * ((size_t)n * threads + 1)) )
+        && ( raw = create_community_level(csr) )
+    )
+    {
+        for (u = 0; u < n; u++)
+        {
+            label[u] = u;
+            order[u] = u;
+        }
+
+        for (i = 0; i < n * threads; i++)
+        {
+            weight[i] = ERROR_INDEX;
+        }
+
+        level = aggregate_community_level(raw, label, n);
+        srand(seed);
+
+        for (i = 0; i + 1 < n; i++)
+        {
+            j = i + (int)(((unsigned long int)rand() * ((unsigned long int)RAND_MAX + 1) + rand()) % (n - i));
+            swap = order[i];
+            order[i] = order[j];
+            order[j] = swap;
+        }
+
+        changes = 1;
+
+        for (iteration = 0; level && iteration < LABEL_PROPAGATION_MAX_ITERATIONS && changes > 0; iteration++)
+        {
+            changes = 0;
+
+            #ifdef _OPENMP
+                #pragma omp parallel for schedule(dynamic, 256) private(t, u, e, c, j, best, best_weight, count) reduction(+:changes)
+            #endif
+            for (i = 0; i < n; i++)
+            {
+                t = get_thread_id();
+                u = order[i];
+                count = 0;
+
+                for (e = level->offsets[u]; e < level->offsets[u + 1]; e++)
+                {
+                    if (level->targets[e] != u && level->weights[e] > 0)
+                    {
+                        c = label[level->targets[e]];
+
+                        if (weight[(size_t)t * n + c] == ERROR_INDEX)
+                        {
+                            weight[(size_t)t * n + c] = 0;
+                            touched[(size_t)t * n + count] = c;
+                            count++;
+                        }
+
+                        weight[(size_t)t * n + c] += level->weights[e];
+                    }
+                }
+
+                best = ERROR_INDEX;
+                best_weight = 0;
+
+                for (j = 0; j < count; j++)
+                {
+                    c = touched[(size_t)t * n + j];
+
+                    if (weight[(size_t)t * n + c] > best_weight || (weight[(size_t)t * n + c] == best_weight && c < best))
+                    {
+                        best_weight = weight[(size_t)t * n + c];
+                        best = c;
+                    }
+                }
+
+                /* The own label is kept when it's one of the best */
+                if (weight[(size_t)t * n + label[u]] == best_weight)
+                {
+                    best = label[u];
+                }
+
+                for (j = 0; j < count; j++)
+                {
+                    weight[(size_t)t * n + touched[(size_t)t * n + j]] = ERROR_INDEX;
+                }
+
+                if (best != ERROR_INDEX && best != label[u])
+                {
+                    label[u] = best;
+                    changes++;
+                }
+            }
+        }
+
+        if (level && ( result = create_communities_result(label, n, iteration) ))
+        {
+            result->modularity = community_modularity(level, label, result->count);
+        }
+    }
+    else
+    {
+        printf("[label_propagation_communities()] ERROR: Memory allocation was unsuccessful\n");
+    }
+
+    if (result == NULL)
+    {
+        free(label);
+    }
+
+    level = delete_community_level(level);
+    raw = delete_community_level(raw);
+    free(order);
+    free(weight);
+    free(touched);
+
+    return result;
+}
+
+
+/*
+ *  Deletes the given communities
+ */
+graph_communities_t * delete_graph_communities(graph_communities_t *communities)
+{
+    if (communities)
+    {
+        free(communities->community);
+        free(communities);
+    }
+
+    return NULL;
+}
+
+
+/*
+ *  Helper function of the clique search that returns the amount of set bits of the 
+ *  first 'words' words of the bitset
+ */
+static int bitset_count(const bitset_word_t *set, int words)
+{
+    bitset_word_t word;
+    int i, count;
+
+
+    count = 0;
+
+    for (i = 0; i < words; i++)
+    {
+        word = set[i];
+
+        while (word)
+        {
+            word &= word - 1;
+            count++;
+        }
+    }
+
+    return count;
+}
+
+
+/*
+ *  Helper function of the clique search that passes the clique found in the workspace
+ *  to the callback, if it has at least the minimum size
+ */
+static void report_clique(graph_clique_search_t *search, int size)
+{
+    if (size >= search->min_size)
+    {
+        search->count++;
+
+        if (search->callback)
+        {
+            search->callback(search->csr, search->clique, size, search->data);
+        }
+    }
+}
+
+
+/*
+ *  Helper function of maximal_cliques() that runs the Bron-Kerbosch Algorithm with Tomita's
+ *  pivot on the local bitsets of the workspace: the candidates (P) and the excluded nodes (X)
+ *  of each depth are stored one after the other, and the adjacency of the local nodes is a 
+ *  bitset matrix, so each step is a few word operations. The pivot is the node of P or X 
+ *  with the most neighbours in P, and only the nodes of P that aren't its neighbours are 
+ *  branched on. The current clique holds 'size' nodes
+ */
+static void clique_search_bitset(graph_clique_search_t *search, int depth, int size)
+{
+    bitset_word_t *candidates, *excluded, *row, *pivot_row, *next_candidates, *next_excluded;
+    bitset_word_t branch;
+    int words, i, j, u, v, best, count, hits, pivot;
+    bool_t empty;
+
+
+    words = search->words;
+    candidates = search->candidates + (size_t)depth * words;
+    excluded = search->excluded + (size_t)depth * words;
+    count = bitset_count(candidates, words);
+
+    if (count == 0)
+    {
+        empty = true;
+
+        for (i = 0; i < words && empty; i++)
+        {
+            empty = (excluded[i] == 0);
+        }
+
+        if (empty)
+        {
+            report_clique(search, size);
+        }
+
+        return;
+    }
+
+    if (size + count < search->min_size)
+    {
+        return;
+    }
+
+    /* Tomita's pivot: the node of P or X with the most neighbours in P */
+    pivot = ERROR_INDEX;
+    best = -1;
+
+    for (i = 0; i < words && best < count; i++)
+    {
+        for (j = 0; j < BITSET_WORD_BITS && ((candidates[i] | excluded[i]) >> j) != 0; j++)
+        {
+            if (((candidates[i] | excluded[i]) >> j) & 1UL)
+            {
+                u = i * BITSET_WORD_BITS + j;
+                row = search->adjacency + (size_t)u * words;
+                hits = 0;
+
+                for (v = 0; v < words; v++)
+                {
+                    branch = candidates[v] & row[v];
+                    hits += bitset_count(&branch, 1);
+                }
+
+                if (hits > best)
+                {
+                    best = hits;
+                    pivot = u;
+                }
+            }
+        }
+    }
+
+    pivot_row = search->adjacency + (size_t)pivot * words;
+    next_candidates = candidates + words;
+    next_excluded = excluded + words;
+
+    for (i = 0; i < words; i++)
+    {
+        branch = candidates[i] & ~pivot_row[i];
+
+        for (j = 0; j < BITSET_WORD_BITS && (branch >> j) != 0; j++)
+        {
+            if ((branch >> j) & 1UL)
+            {
+                v = i * BITSET_WORD_BITS + j;
+                row = search->adjacency + (size_t)v * words;
+
+                for (u = 0; u < words; u++)
+                {
+                    next_candidates[u] = candidates[u] & row[u];
+                    next_excluded[u] = excluded[u] & row[u];
+                }
+
+                search->clique[size] = search->local[v];
+                clique_search_bitset(search, depth + 1, size + 1);
+
+                BITSET_CLEAR(candidates, v);
+                BITSET_SET(excluded, v);
+            }
+        }
+    }
+}
+
+
+/*
+ *  Helper function of the clique search that stores in 'out' (if not NULL) the common 
+ *  elements of two sorted arrays of node indexes, in increasing order
+ * 
+ *  Returns the amount of common elements
+ */
+static int intersect_sorted(const int *a, int a_len, const int *b, int b_len, int *out)
+{
+    int i, j, count;
+
+
+    i = 0;
+    j = 0;
+    count = 0;
+
+    while (i < a_len && j < b_len)
+    {
+        if (a[i] < b[j])
+        {
+            i++;
+        }
+        else if (a[i] > b[j])
+        {
+            j++;
+        }
+        else
+        {
+            if (out)
+            {
+                out[count] = a[i];
+            }
+
+            count++;
+            i++;
+            j++;
+        }
+    }
+
+    return count;
+}
+
+
+/*
+ *  Helper function of maximal_cliques() that runs the Bron-Kerbosch Algorithm with Tomita's
+ *  pivot on sorted arrays of node indexes, for the neighbourhoods too large for the bitsets:
+ *  the sets of every step are intersected with the sorted neighbour arrays by merging them.
+ *  The array of the excluded nodes (X) must have room for the candidates (P) as well, since
+ *  they move there once branched on. The current clique holds 'size' nodes
+ * 
+ *  Returns true if the search ended, false on error
+ */
+static bool_t clique_search_sorted(graph_clique_search_t *search, int *candidates, int candidate_count, int *excluded, int excluded_count, int size)
+{
+    const int *row;
+    int *branch, *next_candidates, *next_excluded;
+    int i, j, u, v, best, count, pivot, branch_count, next_candidate_count, next_excluded_count;
+    bool_t success;
+
+
+    if (candidate_count == 0)
+    {
+        if (excluded_count == 0)
+        {
+            report_clique(search, size);
+        }
+
+        return true;
+    }
+
+    if (size + candidate_count < search->min_size)
+    {
+        return true;
+    }
+
+    /* Tomita's pivot: the node of P or X with the most neighbours in P */
+    pivot = candidates[0];
+    best = -1;
+
+    for (i = 0; i < candidate_count + excluded_count && best < candidate_count; i++)
+    {
+        u = (i < candidate_count) ? candidates[i] : excluded[i - candidate_count];
+        row = search->neighbours + search->offsets[u];
+        count = intersect_sorted(candidates, candidate_count, row, search->offsets[u + 1] - search->offsets[u], NULL);
+
+        if (count > best)
+        {
+            best = count;
+            pivot = u;
+        }
+    }
+
+    next_candidates = NULL;
+    next_excluded = NULL;
+    success = (
+        ( branch = (int*)malloc(sizeof(int) * candidate_count) )
+        && ( next_candidates = (int*)malloc(sizeof(int) * candidate_count) )
+        && ( next_excluded = (int*)malloc(sizeof(int) * (candidate_count + excluded_count)) )
+    );
+
+    if (success)
+    {
+        /* Candidates that aren't neighbours of the pivot */
+        row = search->neighbours + search->offsets[pivot];
+        branch_count = 0;
+        j = 0;
+
+        for (i = 0; i < candidate_count; i++)
+        {
+            while (j < search->offsets[pivot + 1] - search->offsets[pivot] && row[j] < candidates[i])
+            {
+                j++;
+            }
+
+            if (j == search->offsets[pivot + 1] - search->offsets[pivot] || row[j] != candidates[i])
+            {
+                branch[branch_count] = candidates[i];
+                branch_count++;
+            }
+        }
+
+        for (i = 0; i < branch_count && success; i++)
+        {
+            v = branch[i];
+            row = search->neighbours + search->offsets[v];
+            next_candidate_count = intersect_sorted(candidates, candidate_count, row, search->offsets[v + 1] - search->offsets[v], next_candidates);
+            next_excluded_count = intersect_sorted(excluded, excluded_count, row, search->offsets[v + 1] - search->offsets[v], next_excluded);
+
+            search->clique[size] = v;
+            success = clique_search_sorted(search, next_candidates, next_candidate_count, next_excluded, next_excluded_count, size + 1);
+
+            /* v moves from P to X, keeping both sorted */
+            j = 0;
+
+            while (candidates[j] != v)
+            {
+                j++;
+            }
+
+            candidate_count--;
+
+            while (j < candidate_count)
+            {
+                candidates[j] = candidates[j + 1];
+                j++;
+            }
+
+            j = excluded_count;
+
+            while (j > 0 && excluded[j - 1] > v)
+            {
+                excluded[j] = excluded[j - 1];
+                j--;
+            }
+
+            excluded[j] = v;
+            excluded_count++;
+        }
+    }
+    else
+    {
+        printf("[clique_search_sorted()] ERROR: Memory allocation was unsuccessful\n");
+    }
+
+    free(branch);
+    free(next_candidates);
+    free(next_excluded);
+
+    return success;
+}
+
+
+/*
+ *  Enumerates the maximal cliques of the graph (the sets of nodes all linked to each other
+ *  that can't be extended), taking the edges without direction and leaving out the self 
+ *  loops, with the Bron-Kerbosch Algorithm and Tomita's pivot. The nodes are taken in 
+ *  degeneracy order (see peel_min_degree()), as in the algorithm of Eppstein, Löffler and
+ *  Strash: each node v starts a search with the neighbours that come after it as candidates,
+ *  and the ones that come before it as excluded, so every clique is found exactly once and 
+ *  each search only involves the neighbourhood of v. Neighbourhoods with up to 
+ *  CLIQUE_BITSET_MAX_NODES nodes are searched on bitsets (see clique_search_bitset()), the
+ *  larger ones on sorted arrays (see clique_search_sorted()).
+ * 
+ *  Every clique with at least 'min_size' nodes is passed to the callback as soon as it's 
+ *  found (see graph_clique_callback_t), so they are never stored; the callback can be NULL
+ *  to just count them. The searches of the different nodes run in parallel, so with OpenMP
+ *  the callback can be called by several threads at once.
+ * 
+ *  Returns the amount of cliques found, ERROR_INDEX on error
+ */
+long int maximal_cliques(graph_csr_t *csr, int min_size, graph_clique_callback_t callback, void *data)
+{
+    graph_clique_search_t *searches, *search;
+    int *offsets, *neighbours, *degrees, *order, *rank, *local_of;
+    int n, threads, t, i, j, k, v, w, max_degree, candidate_count, excluded_count, words;
+    long int count;
+    bool_t success;
+
+
+    if (csr == NULL)
+    {
+        return ERROR_INDEX;
+    }
+
+    n = csr->node_count;
+    threads = get_thread_count();
+    words = BITSET_WORDS(CLIQUE_BITSET_MAX_NODES);
+    offsets = NULL;
+    neighbours = NULL;
+    degrees = NULL;
+    order = NULL;
+    rank = NULL;
+    local_of = NULL;
+    success = (
+        ( searches = (graph_clique_search_t*)calloc(threads, sizeof(graph_clique_search_t)) )
+        && ( offsets = (int*)malloc(sizeof(int) * (n + 1)) )
+        && ( neighbours = (int*)malloc(sizeof(int) * (2 * csr->edge_count + 1)) )
+        && ( degrees = (int*)malloc(sizeof(int) * (n + 1)) )
+        && ( order = (int*)malloc(sizeof(int) * (n + 1)) )
+        && ( rank = (int*)malloc(sizeof(int) * (n + 1)) )
+        && ( local_of = (int*)malloc(sizeof(int) * ((size_t)n * threads + 1)) )
+        && build_undirected_neighbours(csr, offsets, neighbours, degrees)
+        && peel_min_degree(n, offsets, neighbours, degrees, order)
+    );
+
+    max_degree = 0;
+
+    for (v = 0; success && v < n; v++)
+    {
+        rank[order[v]] = v;
+        max_degree = (offsets[v + 1] - offsets[v] > max_degree) ? offsets[v + 1] - offsets[v] : max_degree;
+    }
+
+    for (t = 0; success && t < threads; t++)
+    {
+        searches[t].csr = csr;
+        searches[t].offsets = offsets;
+        searches[t].neighbours = neighbours;
+        searches[t].min_size = min_size;
+        searches[t].callback = callback;
+        searches[t].data = data;
+        searches[t].words = words;
+        searches[t].local_of = local_of + (size_t)t * n;
+
+        success = (
+            ( searches[t].local = (int*)malloc(sizeof(int) * CLIQUE_BITSET_MAX_NODES) )
+            && ( searches[t].adjacency = (bitset_word_t*)malloc(sizeof(bitset_word_t) * CLIQUE_BITSET_MAX_NODES * words) )
+            && ( searches[t].candidates = (bitset_word_t*)malloc(sizeof(bitset_word_t) * (CLIQUE_BITSET_MAX_NODES + 2) * words) )
+            && ( searches[t].excluded = (bitset_word_t*)malloc(sizeof(bitset_word_t) * (CLIQUE_BITSET_MAX_NODES + 2) * words) )
+            && ( searches[t].clique = (int*)malloc(sizeof(int) * (max_degree + 2)) )
+            && ( searches[t].sorted = (int*)malloc(sizeof(int) * 2 * (max_degree + 1)) )
+        );
+    }
+
+    count = ERROR_INDEX;
+
+    if (success)
+    {
+        for (i = 0; i < n * threads; i++)
+        {
+            local_of[i] = ERROR_INDEX;
+        }
+
+        #ifdef _OPENMP
+            #pragma omp parallel for schedule(dynamic, 1) private(t, j, k, v, w, search, candidate_count, excluded_count)
+        #endif
+        for (i = 0; i < n; i++)
+        {
+            t = get_thread_id();
+            search = &searches[t];
+            v = order[i];
+            search->clique[0] = v;
+
+            if (offsets[v + 1] - offsets[v] <= CLIQUE_BITSET_MAX_NODES)
+            {
+                /* Local nodes: the later neighbours (P) first, then the earlier ones (X) */
+                candidate_count = 0;
+
+                for (j = offsets[v]; j < offsets[v + 1]; j++)
+                {
+                    if (rank[neighbours[j]] > i)
+                    {
+                        search->local[candidate_count] = neighbours[j];
+                        candidate_count++;
+                    }
+                }
+
+                excluded_count = candidate_count;
+
+                for (j = offsets[v]; j < offsets[v + 1]; j++)
+                {
+                    if (rank[neighbours[j]] < i)
+                    {
+                        search->local[excluded_count] = neighbours[j];
+                        excluded_count++;
+                    }
+                }
+
+                memset(search->candidates, 0, sizeof(bitset_word_t) * words);
+                memset(search->excluded, 0, sizeof(bitset_word_t) * words);
+
+                for (j = 0; j < excluded_count; j++)
+                {
+                    search->local_of[search->local[j]] = j;
+
+                    if (j < candidate_count)
+                    {
+                        BITSET_SET(search->candidates, j);
+                    }
+                    else
+                    {
+                        BITSET_SET(search->excluded, j);
+                    }
+                }
+
+                /* Adjacency among the local nodes */
+                for (j = 0; j < excluded_count; j++)
+                {
+                    memset(search->adjacency + (size_t)j * words, 0, sizeof(bitset_word_t) * words);
+                    w = search->local[j];
+
+                    for (k = offsets[w]; k < offsets[w + 1]; k++)
+                    {
+                        if (search->local_of[neighbours[k]] != ERROR_INDEX)
+                        {
+                            BITSET_SET(search->adjacency + (size_t)j * words, search->local_of[neighbours[k]]);
+                        }
+                    }
+                }
+
+                for (j = 0; j < excluded_count; j++)
+                {
+                    search->local_of[search->local[j]] = ERROR_INDEX;
+                }
+
+                clique_search_bitset(search, 0, 1);
+            }
+            else
+            {
+                /* Sorted arrays: P at the beginning of 'sorted', X after the room for the whole neighbourhood */
+                candidate_count = 0;
+                excluded_count = 0;
+
+                for (j = offsets[v]; j < offsets[v + 1]; j++)
+                {
+                    if (rank[neighbours[j]] > i)
+                    {
+                        search->sorted[candidate_count] = neighbours[j];
+                        candidate_count++;
+                    }
+                }
+
+                for (j = offsets[v]; j < offsets[v + 1]; j++)
+                {
+                    if (rank[neighbours[j]] < i)
+                    {
+                        search->sorted[max_degree + 1 + excluded_count] = neighbours[j];
+                        excluded_count++;
+                    }
+                }
+
+                if (!clique_search_sorted(search, search->sorted, candidate_count, search->sorted + max_degree + 1, excluded_count, 1))
+                {
+                    search->failed = true;
+                }
+            }
+        }
+
+        count = 0;
+
+        for (t = 0; t < threads; t++)
+        {
+            count += searches[t].count;
+            success = success && !searches[t].failed;
+        }
+
+        count = success ? count : ERROR_INDEX;
+    }
+    else
+    {
+        printf("[maximal_cliques()] ERROR: Memory allocation was unsuccessful\n");
+    }
+
+    for (t = 0; searches && t < threads; t++)
+    {
+        free(searches[t].local);
+        free(searches[t].adjacency);
+        free(searches[t].candidates);
+        free(searches[t].excluded);
+        free(searches[t].clique);
+        free(searches[t].sorted);
+    }
+
+    free(searches);
+    free(offsets);
+    free(neighbours);
+    free(degrees);
+    free(order);
+    free(rank);
+    free(local_of);
+
+    return count;
+}
+
+
+/*
+ *  Helper function that returns the FNV-1a hash of a label (0 for a NULL label)
+ */
+static unsigned int hash_label(const char *label)
+{
+    unsigned int hash;
+
+
+    if (label == NULL)
+    {
+        return 0;
+    }
+
+    hash = 2166136261u;
+
+    while (*label)
+    {
+        hash = (hash ^ (unsigned char)*label) * 16777619u;
+        label++;
+    }
+
+    return hash;
+}
+
+
+/*
+ *  Helper function that mixes the value into the hash, so that a small change of either
+ *  changes every bit of the result (the finalizer of MurmurHash3 applied to both)
+ */
+static unsigned long int mix_hash(unsigned long int hash, unsigned long int value)
+{
+    hash ^= value + 0x9E3779B9UL + (hash << 6) + (hash >> 2);
+    hash ^= hash >> 16;
+    hash *= 0x85EBCA6BUL;
+    hash ^= hash >> 13;
+    hash *= 0xC2B2AE35UL;
+    hash ^= hash >> 16;
+
+    return hash;
+}
+
+
+/*
+ *  Helper function that gives the same ID (0, 1, ...) to equal labels, so that they can be 
+ *  compared in O(1): the labels are inserted in a hash table with open addressing (FNV-1a
+ *  hash, linear probing), which stores the position of the first label of every group. 
+ *  NULL labels are all equal to each other. The ID of labels[i] is stored in ids[i]
+ * 
+ *  Returns the amount of distinct labels, ERROR_INDEX on error
+ */
+static int intern_labels(char **labels, int count, int *ids)
+{
+    int *table;
+    int size, i, slot, distinct;
+
+
+    size = 1;
+
+    while (size < 2 * count)
+    {
+        size *= 2;
+    }
+
+    if (!( table = (int*)malloc(sizeof(int) * size) ))
+    {
+        printf("[intern_labels()] ERROR: Memory allocation was unsuccessful\n");
+        return ERROR_INDEX;
+    }
+
+    for (slot = 0; slot < size; slot++)
+    {
+        table[slot] = ERROR_INDEX;
+    }
+
+    distinct = 0;
+
+    for (i = 0; i < count; i++)
+    {
+        slot = (int)(hash_label(labels[i]) & (unsigned int)(size - 1));
+
+        while (
+            table[slot] != ERROR_INDEX
+            && !(labels[table[slot]] == labels[i] || (labels[table[slot]] && labels[i] && strcmp(labels[table[slot]], labels[i]) == 0))
+        )
+        {
+            slot = (slot + 1) & (size - 1);
+        }
+
+        if (table[slot] == ERROR_INDEX)
+        {
+            table[slot] = i;
+            ids[i] = distinct;
+            distinct++;
+        }
+        else
+        {
+            ids[i] = ids[table[slot]];
+        }
+    }
+
+    free(table);
+
+    return distinct;
+}
+
+
+/*
+ *  Helper function that gives the same ID (0, 1, ...) to equal pairs of keys, in the same
+ *  way as intern_labels(): the ID of the pair (first[i], second[i]) is stored in ids[i]
+ * 
+ *  Returns the amount of distinct pairs, ERROR_INDEX on error
+ */
+static int intern_keys(const unsigned long int *first, const int *second, int count, int *ids)
+{
+    int *table;
+    int size, i, slot, distinct;
+
+
+    size = 1;
+
+    while (size < 2 * count)
+    {
+        size *= 2;
+    }
+
+    if (!( table = (int*)malloc(sizeof(int) * size) ))
+    {
+        printf("[intern_keys()] ERROR: Memory allocation was unsuccessful\n");
+        return ERROR_INDEX;
+    }
+
+    for (slot = 0; slot < size; slot++)
+    {
+        table[slot] = ERROR_INDEX;
+    }
+
+    distinct = 0;
+
+    for (i = 0; i < count; i++)
+    {
+        slot = (int)(mix_hash(first[i], (unsigned long int)second[i]) & (unsigned long int)(size - 1));
+
+        while (table[slot] != ERROR_INDEX && (first[table[slot]] != first[i] || second[table[slot]] != second[i]))
+        {
+            slot = (slot + 1) & (size - 1);
+        }
+
+        if (table[slot] == ERROR_INDEX)
+        {
+            table[slot] = i;
+            ids[i] = distinct;
+            distinct++;
+        }
+        else
+        {
+            ids[i] = ids[table[slot]];
+        }
+    }
+
+    free(table);
+
+    return distinct;
+}
+
+
+/*
+ *  Helper function of the pattern matching that stably sorts the positions in 'in' (or 
+ *  0 .. count - 1 if NULL) by their key, from 0 to key_count - 1, into 'out', using
+ *  'buckets' (key_count + 1 elements) for the counting sort
+ */
+static void counting_sort_pass(int count, const int *keys, int key_count, const int *in, int *out, int *buckets)
+{
+    int i, k, start, size;
+
+
+    for (k = 0; k <= key_count; k++)
+    {
+        buckets[k] = 0;
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        buckets[keys[in ? in[i] : i]]++;
+    }
+
+    start = 0;
+
+    for (k = 0; k < key_count; k++)
+    {
+        size = buckets[k];
+        buckets[k] = start;
+        start += size;
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        out[buckets[keys[in ? in[i] : i]]++] = in ? in[i] : i;
+    }
+}
+
+
+/*
+ *  Helper function that deletes the given matching view
+ */
+static graph_match_graph_t * delete_match_graph(graph_match_graph_t *graph)
+{
+    if (graph)
+    {
+        free(graph->node_labels);
+        free(graph->out_offsets);
+        free(graph->out_heads);
+        free(graph->out_labels);
+        free(graph->in_offsets);
+        free(graph->in_heads);
+        free(graph->in_labels);
+        free(graph->out_degrees);
+        free(graph->in_degrees);
+        free(graph);
+    }
+
+    return NULL;
+}
+
+
+/*
+ *  Helper function that stores the edges of one direction of a matching view: the entry of
+ *  every edge (its other endpoint and its label) goes in the row of 'rows[e]', and each row
+ *  is sorted by endpoint, then by label, with three stable counting sorts. The amount of 
+ *  distinct endpoints of every row is stored in 'degrees'
+ * 
+ *  Returns true if the rows were built, false otherwise
+ */
+static bool_t sort_match_entries(graph_csr_t *csr, const int *rows, const int *heads, const int *labels, int label_count, int *offsets, int *sorted_heads, int *sorted_labels, int *degrees)
+{
+    int *first, *second, *buckets;
+    int n, i, v, key_count;
+    bool_t success;
+
+
+    n = csr->node_count;
+    key_count = (label_count > n) ? label_count : n;
+    second = NULL;
+    buckets = NULL;
+    success = (
+        ( first = (int*)malloc(sizeof(int) * (csr->edge_count + 1)) )
+        && ( second = (int*)malloc(sizeof(int) * (csr->edge_count + 1)) )
+        && ( buckets = (int*)malloc(sizeof(int) * (key_count + 1)) )
+    );
+
+    if (success)
+    {
+        counting_sort_pass(csr->edge_count, labels, label_count, NULL, first, buckets);
+        counting_sort_pass(csr->edge_count, heads, n, first, second, buckets);
+        counting_sort_pass(csr->edge_count, rows, n, second, first, buckets);
+
+        for (v = 0; v <= n; v++)
+        {
+            offsets[v] = 0;
+        }
+
+        for (i = 0; i < csr->edge_count; i++)
+        {
+            sorted_heads[i] = heads[first[i]];
+            sorted_labels[i] = labels[first[i]];
+            offsets[rows[first[i]] + 1]++;
+        }
+
+        for (v = 0; v < n; v++)
+        {
+            offsets[v + 1] += offsets[v];
+            degrees[v] = 0;
+
+            for (i = offsets[v]; i < offsets[v + 1]; i++)
+            {
+                if (i == offsets[v] || sorted_heads[i] != sorted_heads[i - 1])
+                {
+                    degrees[v]++;
+                }
+            }
+        }
+    }
+
+    free(first);
+    free(second);
+    free(buckets);
+
+    return success;
+}
+
+
+/*
+ *  Helper function that creates the matching view of a compact view, with the given IDs
+ *  of the node labels (by node index) and of the edge labels (by edge index)
+ * 
+ *  Returns the matching view, NULL on error
+ */
+static graph_match_graph_t * create_match_graph(graph_csr_t *csr, const int *node_labels, const int *edge_labels, int edge_label_count)
+{
+    graph_match_graph_t *graph;
+    int n, m;
+
+
+    n = csr->node_count;
+    m = csr->edge_count;
+
+    if (
+        !( graph = (graph_match_graph_t*)calloc(1, sizeof(graph_match_graph_t)) )
+        || !( graph->node_labels = (int*)malloc(sizeof(int) * (n + 1)) )
+        || !( graph->out_offsets = (int*)malloc(sizeof(int) * (n + 1)) )
+        || !( graph->out_heads = (int*)malloc(sizeof(int) * (m + 1)) )
+        || !( graph->out_labels = (int*)malloc(sizeof(int) * (m + 1)) )
+        || !( graph->in_offsets = (int*)malloc(sizeof(int) * (n + 1)) )
+        || !( graph->in_heads = (int*)malloc(sizeof(int) * (m + 1)) )
+        || !( graph->in_labels = (int*)malloc(sizeof(int) * (m + 1)) )
+        || !( graph->out_degrees = (int*)malloc(sizeof(int) * (n + 1)) )
+        || !( graph->in_degrees = (int*)malloc(sizeof(int) * (n + 1)) )
+        || !sort_match_entries(csr, csr->sources, csr->targets, edge_labels, edge_label_count, graph->out_offsets, graph->out_heads, graph->out_labels, graph->out_degrees)
+        || !sort_match_entries(csr, csr->targets, csr->sources, edge_labels, edge_label_count, graph->in_offsets, graph->in_heads, graph->in_labels, graph->in_degrees)
+    )
+    {
+        printf("[create_match_graph()] ERROR: Memory allocation was unsuccessful\n");
+        graph = delete_match_graph(graph);
+    }
+    else
+    {
+        graph->csr = csr;
+        memcpy(graph->node_labels, node_labels, sizeof(int) * n);
+    }
+
+    return graph;
+}
+
+
+/*
+ *  Helper function of the pattern matching that tells if the sorted row entries from 
+ *  'begin' to 'end' - 1 contain the endpoint 'head' with the given label (binary search
+ *  for the endpoint, then a scan of its labels)
+ */
+static bool_t has_match_entry(const int *heads, const int *labels, int begin, int end, int head, int label)
+{
+    int mid, last;
+
+
+    last = end;
+
+    while (begin < end)
+    {
+        mid = begin + (end - begin) / 2;
+
+        if (heads[mid] < head)
+        {
+            begin = mid + 1;
+        }
+        else
+        {
+            end = mid;
+        }
+    }
+
+    while (begin < last && heads[begin] == head && labels[begin] < label)
+    {
+        begin++;
+    }
+
+    return (begin < last && heads[begin] == head && labels[begin] == label);
+}
+
+
+/*
+ *  Helper function of the pattern matching that counts the distinct entries (endpoint and
+ *  label) of a sorted row whose endpoint is 'self' or is marked in 'mapped'
+ */
+static int count_mapped_entries(const int *heads, const int *labels, int begin, int end, const int *mapped, int self)
+{
+    int i, count;
+
+
+    count = 0;
+
+    for (i = begin; i < end; i++)
+    {
+        if (
+            (heads[i] == self || mapped[heads[i]] != ERROR_INDEX)
+            && (i == begin || heads[i] != heads[i - 1] || labels[i] != labels[i - 1])
+        )
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+
+/*
+ *  Helper function of subgraph_isomorphisms() that tells if the pattern node with index u 
+ *  can be mapped to the target node with index x, given the nodes mapped so far: x must 
+ *  be free, with the same label and at least the same distinct in and out degrees, and 
+ *  every edge between u and the mapped pattern nodes (or a self loop) must have a target 
+ *  edge with the same label between the images. For induced matches, the target can't 
+ *  have more of those edges than the pattern
+ */
+static bool_t is_feasible_match(graph_match_graph_t *pattern, graph_match_graph_t *target, const int *mapping, const int *used_by, int u, int x, bool_t induced)
+{
+    int i, w, y, pattern_count;
+
+
+    if (
+        used_by[x] != ERROR_INDEX
+        || pattern->node_labels[u] != target->node_labels[x]
+        || pattern->out_degrees[u] > target->out_degrees[x]
+        || pattern->in_degrees[u] > target->in_degrees[x]
+    )
+    {
+        return false;
+    }
+
+    for (i = pattern->out_offsets[u]; i < pattern->out_offsets[u + 1]; i++)
+    {
+        w = pattern->out_heads[i];
+        y = (w == u) ? x : mapping[w];
+
+        if (y != ERROR_INDEX && !has_match_entry(target->out_heads, target->out_labels, target->out_offsets[x], target->out_offsets[x + 1], y, pattern->out_labels[i]))
+        {
+            return false;
+        }
+    }
+
+    for (i = pattern->in_offsets[u]; i < pattern->in_offsets[u + 1]; i++)
+    {
+        w = pattern->in_heads[i];
+        y = (w == u) ? x : mapping[w];
+
+        if (y != ERROR_INDEX && !has_match_entry(target->in_heads, target->in_labels, target->in_offsets[x], target->in_offsets[x + 1], y, pattern->in_labels[i]))
+        {
+            return false;
+        }
+    }
+
+    if (induced)
+    {
+        pattern_count = count_mapped_entries(pattern->out_heads, pattern->out_labels, pattern->out_offsets[u], pattern->out_offsets[u + 1], mapping, u);
+
+        if (pattern_count != count_mapped_entries(target->out_heads, target->out_labels, target->out_offsets[x], target->out_offsets[x + 1], used_by, x))
+        {
+            return false;
+        }
+
+        pattern_count = count_mapped_entries(pattern->in_heads, pattern->in_labels, pattern->in_offsets[u], pattern->in_offsets[u + 1], mapping, u);
+
+        if (pattern_count != count_mapped_entries(target->in_heads, target->in_labels, target->in_offsets[x], target->in_offsets[x + 1], used_by, x))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+/*
+ *  Helper function of subgraph_isomorphisms() that computes the order in which the pattern
+ *  nodes are matched, in the spirit of VF2++: the next node is always the one with the most
+ *  neighbours already in the order (so that its candidates are constrained the most), then
+ *  the one with the highest degree, then the one whose label is the rarest in the target.
+ *  Every node linked to a previous one gets as 'parent' the first of them, and its 
+ *  candidates will be the neighbours of the image of the parent: 'from_parent' tells if
+ *  the edge goes from the parent to the node (candidates among the outward neighbours) or
+ *  the other way around
+ */
+static void order_pattern_nodes(graph_match_graph_t *pattern, const int *frequency, int *order, int *parent, bool_t *from_parent, int *rank)
+{
+    int n, d, u, i, best, links, best_links;
+
+
+    n = pattern->csr->node_count;
+
+    for (u = 0; u < n; u++)
+    {
+        rank[u] = ERROR_INDEX;
+    }
+
+    for (d = 0; d < n; d++)
+    {
+        best = ERROR_INDEX;
+        best_links = -1;
+
+        for (u = 0; u < n; u++)
+        {
+            if (rank[u] != ERROR_INDEX)
+            {
+                continue;
+            }
+
+            links = 0;
+
+            for (i = pattern->out_offsets[u]; i < pattern->out_offsets[u + 1]; i++)
+            {
+                links += (rank[pattern->out_heads[i]] != ERROR_INDEX);
+            }
+
+            for (i = pattern->in_offsets[u]; i < pattern->in_offsets[u + 1]; i++)
+            {
+                links += (rank[pattern->in_heads[i]] != ERROR_INDEX);
+            }
+
+            if (
+                best == ERROR_INDEX || links > best_links
+                || (links == best_links && pattern->out_degrees[u] + pattern->in_degrees[u] > pattern->out_degrees[best] + pattern->in_degrees[best])
+                || (
+                    links == best_links && pattern->out_degrees[u] + pattern->in_degrees[u] == pattern->out_degrees[best] + pattern->in_degrees[best]
+                    && frequency[pattern->node_labels[u]] < frequency[pattern->node_labels[best]]
+                )
+            )
+            {
+                best = u;
+                best_links = links;
+            }
+        }
+
+        order[d] = best;
+        rank[best] = d;
+        parent[d] = ERROR_INDEX;
+        from_parent[d] = false;
+
+        /* Parent: the neighbour that comes first in the order */
+        for (i = pattern->in_offsets[best]; i < pattern->in_offsets[best + 1]; i++)
+        {
+            u = pattern->in_heads[i];
+
+            if (u != best && rank[u] != ERROR_INDEX && (parent[d] == ERROR_INDEX || rank[u] < rank[parent[d]]))
+            {
+                parent[d] = u;
+                from_parent[d] = true;
+            }
+        }
+
+        for (i = pattern->out_offsets[best]; i < pattern->out_offsets[best + 1]; i++)
+        {
+            u = pattern->out_heads[i];
+
+            if (u != best && rank[u] != ERROR_INDEX && (parent[d] == ERROR_INDEX || rank[u] < rank[parent[d]]))
+            {
+                parent[d] = u;
+                from_parent[d] = false;
+            }
+        }
+    }
+}
+
+
+/*
+ *  Helper function that interns the labels of the nodes and edges of one or two compact 
+ *  views (see intern_labels()), the first view before the second one: 'node_ids' gets the
+ *  IDs of the nodes and 'edge_ids' the ones of the edges. Without MATCH_NODE_LABELS all 
+ *  the nodes get the ID 0, and the edges get the ID of their label with MATCH_EDGE_LABELS,
+ *  of their weight with MATCH_EDGE_WEIGHTS, of both with both flags, and 0 otherwise.
+ *  The amounts of distinct IDs are stored in 'node_id_count' and 'edge_id_count'
+ * 
+ *  Returns true if the labels were interned, false otherwise
+ */
+static bool_t intern_match_labels(graph_csr_t *first, graph_csr_t *second, int flags, int *node_ids, int *edge_ids, int *node_id_count, int *edge_id_count)
+{
+    char **labels;
+    unsigned long int *keys;
+    int *weights;
+    int n, m, i;
+    bool_t success;
+
+
+    n = first->node_count + (second ? second->node_count : 0);
+    m = first->edge_count + (second ? second->edge_count : 0);
+    keys = NULL;
+    weights = NULL;
+    success = (
+        ( labels = (char**)malloc(sizeof(char*) * (n + m + 1)) )
+        && ( keys = (unsigned long int*)malloc(sizeof(unsigned long int) * (m + 1)) )
+        && ( weights = (int*)malloc(sizeof(int) * (m + 1)) )
+    );
+
+    if (success)
+    {
+        for (i = 0; i < n; i++)
+        {
+            labels[i] = (i < first->node_count) ? first->nodes[i]->label : second->nodes[i - first->node_count]->label;
+            node_ids[i] = 0;
+        }
+
+        for (i = 0; i < m; i++)
+        {
+            labels[n + i] = (i < first->edge_count) ? first->edges[i]->label : second->edges[i - first->edge_count]->label;
+            weights[i] = (i < first->edge_count) ? first->weights[i] : second->weights[i - first->edge_count];
+            edge_ids[i] = 0;
+        }
+
+        *node_id_count = (flags & MATCH_NODE_LABELS) ? intern_labels(labels, n, node_ids) : 1;
+        *edge_id_count = (flags & MATCH_EDGE_LABELS) ? intern_labels(labels + n, m, edge_ids) : 1;
+
+        if ((flags & MATCH_EDGE_WEIGHTS) && *edge_id_count != ERROR_INDEX)
+        {
+            for (i = 0; i < m; i++)
+            {
+                keys[i] = (unsigned long int)edge_ids[i];
+            }
+
+            *edge_id_count = intern_keys(keys, weights, m, edge_ids);
+        }
+
+        success = (*node_id_count != ERROR_INDEX && *edge_id_count != ERROR_INDEX);
+    }
+    else
+    {
+        printf("[intern_match_labels()] ERROR: Memory allocation was unsuccessful\n");
+    }
+
+    free(labels);
+    free(keys);
+    free(weights);
+
+    return success;
+}
+
+
+/*
+ *  Helper function that finds the occurrences of the pattern inside the target, given
+ *  their matching views (with 'label_count' distinct node label IDs), as described in
+ *  subgraph_isomorphisms()
+ * 
+ *  Returns the amount of matches found, ERROR_INDEX on error
+ */
+static long int match_graph_views(graph_match_graph_t *pattern, graph_match_graph_t *target, int label_count, bool_t induced, graph_match_callback_t callback, void *data)
+{
+    const int *row;
+    int *frequency, *order, *parent, *rank, *mapping, *used_by, *position, *end;
+    bool_t *from_parent;
+    int np, nt, d, u, x;
+    long int count;
+    bool_t found, stop;
+
+
+    np = pattern->csr->node_count;
+    nt = target->csr->node_count;
+    count = ERROR_INDEX;
+    order = NULL;
+    parent = NULL;
+    rank = NULL;
+    mapping = NULL;
+    used_by = NULL;
+    position = NULL;
+    end = NULL;
+    from_parent = NULL;
+
+    if (
+        ( frequency = (int*)calloc(label_count + 1, sizeof(int)) )
+        && ( order = (int*)malloc(sizeof(int) * (np + 1)) )
+        && ( parent = (int*)malloc(sizeof(int) * (np + 1)) )
+        && ( rank = (int*)malloc(sizeof(int) * (np + 1)) )
+        && ( mapping = (int*)malloc(sizeof(int) * (np + 1)) )
+        && ( position = (int*)malloc(sizeof(int) * (np + 1)) )
+        && ( end = (int*)malloc(sizeof(int) * (np + 1)) )
+        && ( from_parent = (bool_t*)malloc(sizeof(bool_t) * (np + 1)) )
+        && ( used_by = (int*)malloc(sizeof(int) * (nt + 1)) )
+    )
+    {
+        for (x = 0; x < nt; x++)
+        {
+            frequency[target->node_labels[x]]++;
+            used_by[x] = ERROR_INDEX;
+        }
+
+        for (u = 0; u < np; u++)
+        {
+            mapping[u] = ERROR_INDEX;
+        }
+
+        order_pattern_nodes(pattern, frequency, order, parent, from_parent, rank);
+        count = 0;
+        stop = (np == 0 || np > nt);
+        d = 0;
+        position[0] = 0;
+        end[0] = nt;
+
+        while (!stop && d >= 0)
+        {
+            u = order[d];
+            found = false;
+
+            while (!found && position[d] < end[d])
+            {
+                if (parent[d] == ERROR_INDEX)
+                {
+                    x = position[d];
+                    position[d]++;
+                }
+                else
+                {
+                    row = from_parent[d] ? target->out_heads : target->in_heads;
+                    x = row[position[d]];
+
+                    /* The parallel entries of the row give the same candidate */
+                    while (position[d] < end[d] && row[position[d]] == x)
+                    {
+                        position[d]++;
+                    }
+                }
+
+                found = is_feasible_match(pattern, target, mapping, used_by, u, x, induced);
+            }
+
+            if (found)
+            {
+                mapping[u] = x;
+                used_by[x] = u;
+                d++;
+
+                if (d == np)
+                {
+                    count++;
+                    stop = (callback && !callback(pattern->csr, target->csr, mapping, data));
+                    d--;
+                    used_by[mapping[order[d]]] = ERROR_INDEX;
+                    mapping[order[d]] = ERROR_INDEX;
+                }
+                else if (parent[d] == ERROR_INDEX)
+                {
+                    position[d] = 0;
+                    end[d] = nt;
+                }
+                else if (from_parent[d])
+                {
+                    position[d] = target->out_offsets[mapping[parent[d]]];
+                    end[d] = target->out_offsets[mapping[parent[d]] + 1];
+                }
+                else
+                {
+                    position[d] = target->in_offsets[mapping[parent[d]]];
+                    end[d] = target->in_offsets[mapping[parent[d]] + 1];
+                }
+            }
+            else
+            {
+                d--;
+
+                if (d >= 0)
+                {
+                    used_by[mapping[order[d]]] = ERROR_INDEX;
+                    mapping[order[d]] = ERROR_INDEX;
+                }
+            }
+        }
+    }
+    else
+    {
+        printf("[match_graph_views()] ERROR: Memory allocation was unsuccessful\n");
+    }
+
+    free(frequency);
+    free(order);
+    free(parent);
+    free(rank);
+    free(mapping);
+    free(used_by);
+    free(position);
+    free(end);
+    free(from_parent);
+
+    return count;
+}
+
+
+/*
+ *  Finds the occurrences of the pattern graph inside the target graph: every mapping of 
+ *  the pattern nodes to distinct target nodes such that every pattern edge u -> v has a 
+ *  target edge from the image of u to the image of v. The 'flags' can combine:
+ * 
+ *      - MATCH_INDUCED: the target can't have other edges between the images (induced 
+ *        subgraph isomorphism), instead of just containing the pattern edges (monomorphism)
+ *      - MATCH_NODE_LABELS: every node must be mapped to a node with an equal label
+ *      - MATCH_EDGE_LABELS: every edge must be matched by an edge with an equal label
+ *      - MATCH_EDGE_WEIGHTS: every edge must be matched by an edge with an equal weight
+ * 
+ *  The labels are interned first (see intern_match_labels()), so that every label 
+ *  comparison is between integers, and parallel edges with the same label and weight count
+ *  as one. The search is a depth-first search without recursion, in the style of VF2++: 
+ *  the pattern nodes are matched in a fixed order (see order_pattern_nodes()), the 
+ *  candidates of a node are only the neighbours of the image of a previous node, and they 
+ *  are filtered by label and degree before the edges are checked (see is_feasible_match()),
+ *  on rows sorted by endpoint so that each edge is found with a binary search.
+ * 
+ *  Every match is passed to the callback as soon as it's found (see graph_match_callback_t),
+ *  and the search stops if the callback returns false; the callback can be NULL to just 
+ *  count the matches. A pattern with symmetries is found once for every symmetry.
+ * 
+ *  Returns the amount of matches found, ERROR_INDEX on error
+ */
+long int subgraph_isomorphisms(graph_t *pattern_graph, graph_t *target_graph, int flags, graph_match_callback_t callback, void *data)
+{
+    graph_csr_t *pattern_csr, *target_csr;
+    graph_match_graph_t *pattern, *target;
+    int *node_ids, *edge_ids;
+    int np, mp, label_count, edge_label_count;
+    long int count;
+
+
+    count = ERROR_INDEX;
+    pattern_csr = create_graph_csr(pattern_graph);
+    target_csr = create_graph_csr(target_graph);
+    pattern = NULL;
+    target = NULL;
+    node_ids = NULL;
+    edge_ids = NULL;
+
+    if (
+        pattern_csr && target_csr
+        && ( node_ids = (int*)malloc(sizeof(int) * (pattern_csr->node_count + target_csr->node_count + 1)) )
+        && ( edge_ids = (int*)malloc(sizeof(int) * (pattern_csr->edge_count + target_csr->edge_count + 1)) )
+        && intern_match_labels(pattern_csr, target_csr, flags, node_ids, edge_ids, &label_count, &edge_label_count)
+    )
+    {
+        np = pattern_csr->node_count;
+        mp = pattern_csr->edge_count;
+
+        if (
+            ( pattern = create_match_graph(pattern_csr, node_ids, edge_ids, edge_label_count) )
+            && ( target = create_match_graph(target_csr, node_ids + np, edge_ids + mp, edge_label_count) )
+        )
+        {
+            count = match_graph_views(pattern, target, label_count, (flags & MATCH_INDUCED) != 0, callback, data);
+        }
+    }
+
+    pattern = delete_match_graph(pattern);
+    target = delete_match_graph(target);
+    pattern_csr = delete_graph_csr(pattern_csr);
+    target_csr = delete_graph_csr(target_csr);
+    free(node_ids);
+    free(edge_ids);
+
+    return count;
+}
+
+
+/*
+ *  Helper function that refines the colors of the nodes of a matching view with the 
+ *  Weisfeiler-Lehman Algorithm: in every round, the new color of a node is a hash of its
+ *  color and of the multiset of the (color, edge hash, direction) of its distinct entries,
+ *  where 'edge_hash' gives the hash of every edge label ID. The multiset is hashed as the 
+ *  sum of the hashes of its elements, so no sorting is needed. Every round can only split 
+ *  the classes of equal colors, and the rounds stop when the amount of classes stops 
+ *  growing. 'colors' holds the initial colors, and the final ones at the end
+ * 
+ *  Returns the amount of rounds, ERROR_INDEX on error
+ */
+static int refine_colors(graph_match_graph_t *graph, const unsigned long int *edge_hash, unsigned long int *colors)
+{
+    unsigned long int *next, *swap;
+    unsigned long int sum;
+    int *zeros, *ids;
+    int n, v, i, rounds, classes, next_classes;
+
+
+    n = graph->csr->node_count;
+    rounds = ERROR_INDEX;
+    zeros = NULL;
+    ids = NULL;
+
+    if (
+        ( next = (unsigned long int*)malloc(sizeof(unsigned long int) * (n + 1)) )
+        && ( zeros = (int*)calloc(n + 1, sizeof(int)) )
+        && ( ids = (int*)malloc(sizeof(int) * (n + 1)) )
+    )
+    {
+        classes = intern_keys(colors, zeros, n, ids);
+        next_classes = classes + 1;
+        rounds = 0;
+
+        while (classes != ERROR_INDEX && next_classes > classes && rounds < n)
+        {
+            for (v = 0; v < n; v++)
+            {
+                sum = 0;
+
+                for (i = graph->out_offsets[v]; i < graph->out_offsets[v + 1]; i++)
+                {
+                    if (i == graph->out_offsets[v] || graph->out_heads[i] != graph->out_heads[i - 1] || graph->out_labels[i] != graph->out_labels[i - 1])
+                    {
+                        sum += mix_hash(mix_hash(colors[graph->out_heads[i]], edge_hash[graph->out_labels[i]]), 1);
+                    }
+                }
+
+                for (i = graph->in_offsets[v]; i < graph->in_offsets[v + 1]; i++)
+                {
+                    if (i == graph->in_offsets[v] || graph->in_heads[i] != graph->in_heads[i - 1] || graph->in_labels[i] != graph->in_labels[i - 1])
+                    {
+                        sum += mix_hash(mix_hash(colors[graph->in_heads[i]], edge_hash[graph->in_labels[i]]), 2);
+                    }
+                }
+
+                next[v] = mix_hash(colors[v], sum);
+            }
+
+            swap = colors;
+            colors = next;
+            next = swap;
+            rounds++;
+
+            next_classes = intern_keys(colors, zeros, n, ids);
+            classes = (next_classes > classes) ? next_classes : classes;
+        }
+
+        /* After an odd amount of rounds, the final colors are in the other array */
+        if (rounds % 2 == 1)
+        {
+            memcpy(next, colors, sizeof(unsigned long int) * n);
+            swap = colors;
+            colors = next;
+            next = swap;
+        }
+
+        rounds = (classes == ERROR_INDEX || next_classes == ERROR_INDEX) ? ERROR_INDEX : rounds;
+    }
+    else
+    {
+        printf("[refine_colors()] ERROR: Memory allocation was unsuccessful\n");
+    }
+
+    free(next);
+    free(zeros);
+    free(ids);
+
+    return rounds;
+}
+
+
+/*
+ *  Helper function that computes the refined colors of the nodes of a compact view (see
+ *  refine_colors()), given the IDs of its edge labels (see intern_match_labels()), and
+ *  returns the fingerprint of the view in 'fingerprint': the initial colors hash the 
+ *  degrees of the nodes (and their labels with MATCH_NODE_LABELS), the edges hash their 
+ *  labels and weights as given by the flags, and the fingerprint hashes the amount of 
+ *  nodes and entries and the multiset of the final colors. The matching view of the
+ *  compact view is returned as well, so that it can be matched afterwards
+ * 
+ *  Returns the matching view, NULL on error
+ */
+static graph_match_graph_t * fingerprint_graph_view(graph_csr_t *csr, const int *node_ids, const int *edge_ids, int edge_id_count, int flags, unsigned long int *colors, unsigned long int *fingerprint)
+{
+    graph_match_graph_t *view;
+    unsigned long int *edge_hash;
+    unsigned long int sum;
+    int v, e, entries;
+
+
+    edge_hash = NULL;
+
+    if (
+        ( view = create_match_graph(csr, node_ids, edge_ids, edge_id_count) )
+        && ( edge_hash = (unsigned long int*)calloc(edge_id_count + 1, sizeof(unsigned long int)) )
+    )
+    {
+        /* The IDs depend on the order of the labels, the hashes only on their contents */
+        for (e = 0; e < csr->edge_count; e++)
+        {
+            edge_hash[edge_ids[e]] = mix_hash(
+                (flags & MATCH_EDGE_LABELS) ? hash_label(csr->edges[e]->label) : 0, 
+                (flags & MATCH_EDGE_WEIGHTS) ? (unsigned long int)csr->weights[e] : 0
+            );
+        }
+
+        entries = 0;
+
+        for (v = 0; v < csr->node_count; v++)
+        {
+            colors[v] = mix_hash(
+                mix_hash((flags & MATCH_NODE_LABELS) ? hash_label(csr->nodes[v]->label) : 0, (unsigned long int)view->out_degrees[v]), 
+                (unsigned long int)view->in_degrees[v]
+            );
+
+            for (e = view->out_offsets[v]; e < view->out_offsets[v + 1]; e++)
+            {
+                if (e == view->out_offsets[v] || view->out_heads[e] != view->out_heads[e - 1] || view->out_labels[e] != view->out_labels[e - 1])
+                {
+                    entries++;
+                }
+            }
+        }
+
+        if (refine_colors(view, edge_hash, colors) == ERROR_INDEX)
+        {
+            view = delete_match_graph(view);
+        }
+        else
+        {
+            sum = 0;
+
+            for (v = 0; v < csr->node_count; v++)
+            {
+                sum += mix_hash(colors[v], 0);
+            }
+
+            *fingerprint = mix_hash(mix_hash((unsigned long int)csr->node_count, (unsigned long int)entries), sum);
+        }
+    }
+    else
+    {
+        view = delete_match_graph(view);
+    }
+
+    free(edge_hash);
+
+    return view;
+}
+
+
+/*
+ *  Computes a fingerprint of the graph that doesn't depend on the IDs of its nodes and 
+ *  edges, nor on their order: isomorphic graphs always have the same fingerprint, while
+ *  different graphs almost always have different ones (see are_isomorphic() for the exact
+ *  check). The colors of the nodes are refined with the Weisfeiler-Lehman Algorithm (see 
+ *  refine_colors()) until they are stable, and the fingerprint hashes the multiset of the 
+ *  final colors. The 'flags' can combine MATCH_NODE_LABELS, MATCH_EDGE_LABELS and 
+ *  MATCH_EDGE_WEIGHTS to take the labels and weights into account (see 
+ *  subgraph_isomorphisms()); parallel edges that are equal for the flags count as one.
+ *  Each round takes O(V + E), and there are at most V rounds (usually just a few).
+ * 
+ *  NOTE: WL can't tell apart some non isomorphic graphs, e.g. regular graphs with the 
+ *  same degree and size, which get the same fingerprint
+ * 
+ *  Returns the fingerprint (0 for an empty graph or on error)
+ */
+unsigned long int graph_fingerprint(graph_t *graph, int flags)
+{
+    graph_csr_t *csr;
+    graph_match_graph_t *view;
+    unsigned long int *colors;
+    unsigned long int fingerprint;
+    int *node_ids, *edge_ids;
+    int node_id_count, edge_id_count;
+
+
+    fingerprint = 0;
+    csr = create_graph_csr(graph);
+    colors = NULL;
+    node_ids = NULL;
+    edge_ids = NULL;
+
+    if (
+        csr
+        && ( colors = (unsigned long int*)malloc(sizeof(unsigned long int) * (csr->node_count + 1)) )
+        && ( node_ids = (int*)malloc(sizeof(int) * (csr->node_count + 1)) )
+        && ( edge_ids = (int*)malloc(sizeof(int) * (csr->edge_count + 1)) )
+        && intern_match_labels(csr, NULL, flags, node_ids, edge_ids, &node_id_count, &edge_id_count)
+    )
+    {
+        view = fingerprint_graph_view(csr, node_ids, edge_ids, edge_id_count, flags, colors, &fingerprint);
+        view = delete_match_graph(view);
+    }
+
+    csr = delete_graph_csr(csr);
+    free(colors);
+    free(node_ids);
+    free(edge_ids);
+
+    return fingerprint;
+}
+
+
+/*
+ *  Helper function of are_isomorphic() that stops the search at the first match
+ */
+static bool_t stop_at_first_match(graph_csr_t *pattern, graph_csr_t *target, const int *mapping, void *data)
+{
+    (void)pattern;
+    (void)target;
+    (void)mapping;
+    (void)data;
+
+    return false;
+}
+
+
+/*
+ *  Tells if the two graphs are isomorphic, that is if the nodes of the first one can be 
+ *  mapped one to one to the nodes of the second one so that the edges match exactly, 
+ *  with the labels and weights given by the flags (see graph_fingerprint()). The 
+ *  fingerprints of the graphs are compared first, which rejects almost every pair of
+ *  different graphs in O(V + E); only when they are equal, the graphs are matched with
+ *  subgraph_isomorphisms() as induced subgraphs, where every node can only be mapped to a
+ *  node with the same refined color, which makes the search short in most cases.
+ * 
+ *  Returns true if the graphs are isomorphic, false otherwise (or on error)
+ */
+bool_t are_isomorphic(graph_t *first_graph, graph_t *second_graph, int flags)
+{
+    graph_csr_t *first_csr, *second_csr;
+    graph_match_graph_t *first, *second;
+    unsigned long int *colors;
+    unsigned long int first_fingerprint, second_fingerprint;
+    int *node_ids, *edge_ids, *color_ids;
+    int n1, m1, node_id_count, edge_id_count, color_count;
+    bool_t isomorphic;
+
+
+    isomorphic = false;
+    first_csr = create_graph_csr(first_graph);
+    second_csr = create_graph_csr(second_graph);
+    first = NULL;
+    second = NULL;
+    colors = NULL;
+    node_ids = NULL;
+    edge_ids = NULL;
+    color_ids = NULL;
+
+    if (
+        first_csr && second_csr 
+        && first_csr->node_count == second_csr->node_count
+        && ( colors = (unsigned long int*)malloc(sizeof(unsigned long int) * (first_csr->node_count + second_csr->node_count + 1)) )
+        && ( node_ids = (int*)malloc(sizeof(int) * (first_csr->node_count + second_csr->node_count + 1)) )
+        && ( edge_ids = (int*)malloc(sizeof(int) * (first_csr->edge_count + second_csr->edge_count + 1)) )
+        && ( color_ids = (int*)malloc(sizeof(int) * (first_csr->node_count + second_csr->node_count + 1)) )
+        && intern_match_labels(first_csr, second_csr, flags, node_ids, edge_ids, &node_id_count, &edge_id_count)
+    )
+    {
+        n1 = first_csr->node_count;
+        m1 = first_csr->edge_count;
+
+        if (
+            ( first = fingerprint_graph_view(first_csr, node_ids, edge_ids, edge_id_count, flags, colors, &first_fingerprint) )
+            && ( second = fingerprint_graph_view(second_csr, node_ids + n1, edge_ids + m1, edge_id_count, flags, colors + n1, &second_fingerprint) )
+            && first_fingerprint == second_fingerprint
+        )
+        {
+            /* The refined colors, together with the labels, take the place of the node labels */
+            color_count = intern_keys(colors, node_ids, 2 * n1, color_ids);
+
+            if (color_count != ERROR_INDEX)
+            {
+                memcpy(first->node_labels, color_ids, sizeof(int) * n1);
+                memcpy(second->node_labels, color_ids + n1, sizeof(int) * n1);
+                isomorphic = (match_graph_views(first, second, color_count, true, stop_at_first_match, NULL) > 0);
+            }
+        }
+    }
+
+    first = delete_match_graph(first);
+    second = delete_match_graph(second);
+    first_csr = delete_graph_csr(first_csr);
+    second_csr = delete_graph_csr(second_csr);
+    free(colors);
+    free(node_ids);
+    free(edge_ids);
+    free(color_ids);
+
+    return isomorphic;
+}
+
+
+/*
+ *  Finds the strongly connected components of the compact view with Tarjan's Algorithm,
+ *  using an explicit stack so that long paths can't overflow the call stack. The components
+ *  are numbered in topological order: if an edge goes from a node of component a to a node
+ *  of component b, then a <= b.
+ * 
+ *  The component of every node is stored in 'component' (node_count elements).
+ *  Returns the amount of components, ERROR_INDEX on error
+ */
+int strongly_connected_components(graph_csr_t *csr, int *component)
+{
+    int *order, *lowlink, *stack, *calls, *next_edge;
+    int n, count, counter, top, depth, root, v, w, u;
+
+
+    if (csr == NULL || component == NULL)
+    {
+        printf("[strongly_connected_components()] ERROR: Invalid compact view\n");
+        return ERROR_INDEX;
+    }
+
+    n = csr->node_count;
+    count = ERROR_INDEX;
+    order = NULL;
+    lowlink = NULL;
+    stack = NULL;
+    calls = NULL;
+    next_edge = NULL;
+
+    if (
+        ( order = (int*)malloc(sizeof(int) * (n + 1)) )
+        && ( lowlink = (int*)malloc(sizeof(int) * (n + 1)) )
+        && ( stack = (int*)malloc(sizeof(int) * (n + 1)) )
+        && ( calls = (int*)malloc(sizeof(int) * (n + 1)) )
+        && ( next_edge = (int*)malloc(sizeof(int) * (n + 1)) )
+    )
+    {
+        for (v = 0; v < n; v++)
+        {
+            order[v] = ERROR_INDEX;
+            component[v] = ERROR_INDEX;
+        }
+
+        count = 0;
+        counter = 0;
+        top = 0;
+
+        for (root = 0; root < n; root++)
+        {
+            if (order[root] != ERROR_INDEX)
+            {
+                continue;
+            }
+
+            order[root] = lowlink[root] = counter++;
+            next_edge[root] = csr->offsets[root];
+            stack[top++] = root;
+            calls[0] = root;
+            depth = 0;
+
+            while (depth >= 0)
+            {
+                v = calls[depth];
+
+                if (next_edge[v] < csr->offsets[v + 1])
+                {
+                    w = csr->targets[next_edge[v]++];
+
+                    if (order[w] == ERROR_INDEX)
+                    {
+                        order[w] = lowlink[w] = counter++;
+                        next_edge[w] = csr->offsets[w];
+                        stack[top++] = w;
+                        calls[++depth] = w;
+                    }
+                    else if (component[w] == ERROR_INDEX && order[w] < lowlink[v])
+                    {
+                        /* The visited nodes without a component are the ones still on the stack */
+                        lowlink[v] = order[w];
+                    }
+                }
+                else
+                {
+                    if (lowlink[v] == order[v])
+                    {
+                        do
+                        {
+                            w = stack[--top];
+                            component[w] = count;
+                        }
+                        while (w != v);
+
+                        count++;
+                    }
+
+                    depth--;
+
+                    if (depth >= 0)
+                    {
+                        u = calls[depth];
+
+                        if (lowlink[v] < lowlink[u])
+                        {
+                            lowlink[u] = lowlink[v];
+                        }
+                    }
+                }
+            }
+        }
+
+        /* Tarjan's Algorithm completes the components in reverse topological order */
+        for (v = 0; v < n; v++)
+        {
+            component[v] = count - 1 - component[v];
+        }
+    }
+    else
+    {
+        printf("[strongly_connected_components()] ERROR: Memory allocation was unsuccessful\n");
+    }
+
+    free(order);
+    free(lowlink);
+    free(stack);
+    free(calls);
+    free(next_edge);
+
+    return count;
+}
+
+
+/*
+ *  Deletes the given reachability index
+ */
+graph_reachability_t * delete_reachability(graph_reachability_t *reach)
+{
+    if (reach)
+    {
+        free(reach->component);
+        free(reach->closure);
+        free(reach->pre);
+        free(reach->post);
+        free(reach->low);
+        free(reach->out_offsets);
+        free(reach->out_hubs);
+        free(reach->in_offsets);
+        free(reach->in_hubs);
+        free(reach);
+    }
+
+    return NULL;
+}
+
+
+/*
+ *  Helper function of the reachability index that builds the condensation of the compact 
+ *  view, where every component is a node and parallel edges are merged. The edges of 
+ *  component c are stored in 'targets' from offsets[c] to offsets[c + 1] - 1 ('offsets' 
+ *  has count + 1 elements).
+ * 
+ *  Returns the array of the targets, NULL on error
+ */
+static int * condense_components(graph_csr_t *csr, const int *component, int count, int *offsets)
+{
+    int *targets, *position, *seen;
+    int c, e, i, size, start;
+
+
+    targets = NULL;
+    position = NULL;
+    seen = NULL;
+
+    if (
+        ( targets = (int*)malloc(sizeof(int) * (csr->edge_count + 1)) )
+        && ( position = (int*)malloc(sizeof(int) * (count + 1)) )
+        && ( seen = (int*)malloc(sizeof(int) * (count + 1)) )
+    )
+    {
+        for (c = 0; c <= count; c++)
+        {
+            offsets[c] = 0;
+        }
+
+        for (e = 0; e < csr->edge_count; e++)
+        {
+            if (component[csr->sources[e]] != component[csr->targets[e]])
+            {
+                offsets[component[csr->sources[e]] + 1]++;
+            }
+        }
+
+        for (c = 0; c < count; c++)
+        {
+            offsets[c + 1] += offsets[c];
+            position[c] = offsets[c];
+            seen[c] = ERROR_INDEX;
+        }
+
+        for (e = 0; e < csr->edge_count; e++)
+        {
+            if (component[csr->sources[e]] != component[csr->targets[e]])
+            {
+                targets[position[component[csr->sources[e]]]++] = component[csr->targets[e]];
+            }
+        }
+
+        /* Merges the parallel edges of every row, compacting the rows towards the front */
+        size = 0;
+
+        for (c = 0; c < count; c++)
+        {
+            start = offsets[c];
+            offsets[c] = size;
+
+            for (i = start; i < offsets[c + 1]; i++)
+            {
+                if (seen[targets[i]] != c)
+                {
+                    seen[targets[i]] = c;
+                    targets[size++] = targets[i];
+                }
+            }
+        }
+
+        offsets[count] = size;
+    }
+    else
+    {
+        free(targets);
+        targets = NULL;
+    }
+
+    free(position);
+    free(seen);
+
+    return targets;
+}
+
+
+/*
+ *  Helper function of the reachability index that computes the transitive closure of the
+ *  condensation: since the components are in topological order, the successors of a component
+ *  have higher numbers, so scanning the components backwards every row can be built as the 
+ *  union of the (already complete) rows of its successors, one word at a time
+ * 
+ *  Returns true if the closure was built, false otherwise
+ */
+static bool_t build_transitive_closure(graph_reachability_t *reach, const int *offsets, const int *targets)
+{
+    bitset_word_t *row, *other;
+    int words, c, e, i;
+
+
+    words = BITSET_WORDS(reach->component_count);
+
+    if (!( reach->closure = (bitset_word_t*)calloc((size_t)reach->component_count * words + 1, sizeof(bitset_word_t)) ))
+    {
+        return false;
+    }
+
+    for (c = reach->component_count - 1; c >= 0; c--)
+    {
+        row = reach->closure + (size_t)c * words;
+        BITSET_SET(row, c);
+
+        for (e = offsets[c]; e < offsets[c + 1]; e++)
+        {
+            other = reach->closure + (size_t)targets[e] * words;
+
+            /* The successor's row has no bits below its own index, which is above c */
+            for (i = targets[e] / BITSET_WORD_BITS; i < words; i++)
+            {
+                row[i] |= other[i];
+            }
+        }
+    }
+
+    return true;
+}
+
+
+/*
+ *  Helper function of the reachability index that labels the components of the condensation 
+ *  with a depth-first search: 'pre' and 'post' are the preorder and postorder numbers, while 
+ *  'low' is the lowest postorder number among the components reachable from each component.
+ *  If b is reachable from a, then low[a] <= post[b] <= post[a] (the search finishes b before a),
+ *  and if b is a descendant of a in the search forest, then also pre[a] <= pre[b]: the first
+ *  condition proves that most pairs are unreachable, the second one that many are reachable
+ * 
+ *  Returns true if the labels were assigned, false otherwise
+ */
+static bool_t label_intervals(graph_reachability_t *reach, const int *offsets, const int *targets)
+{
+    int *calls, *next_edge;
+    int count, pre_counter, post_counter, depth, root, c, d, e;
+    bool_t success;
+
+
+    count = reach->component_count;
+    calls = NULL;
+    next_edge = NULL;
+    success = false;
+
+    if (
+        ( reach->pre = (int*)malloc(sizeof(int) * (count + 1)) )
+        && ( reach->post = (int*)malloc(sizeof(int) * (count + 1)) )
+        && ( reach->low = (int*)malloc(sizeof(int) * (count + 1)) )
+        && ( calls = (int*)malloc(sizeof(int) * (count + 1)) )
+        && ( next_edge = (int*)malloc(sizeof(int) * (count + 1)) )
+    )
+    {
+        for (c = 0; c < count; c++)
+        {
+            reach->pre[c] = ERROR_INDEX;
+        }
+
+        pre_counter = 0;
+        post_counter = 0;
+
+        for (root = 0; root < count; root++)
+        {
+            if (reach->pre[root] != ERROR_INDEX)
+            {
+                continue;
+            }
+
+            reach->pre[root] = pre_counter++;
+            next_edge[root] = offsets[root];
+            calls[0] = root;
+            depth = 0;
+
+            while (depth >= 0)
+            {
+                c = calls[depth];
+
+                if (next_edge[c] < offsets[c + 1])
+                {
+                    d = targets[next_edge[c]++];
+
+                    if (reach->pre[d] == ERROR_INDEX)
+                    {
+                        reach->pre[d] = pre_counter++;
+                        next_edge[d] = offsets[d];
+                        calls[++depth] = d;
+                    }
+                }
+                else
+                {
+                    /* All the successors are finished, since the condensation is acyclic */
+                    reach->post[c] = post_counter++;
+                    reach->low[c] = reach->post[c];
+
+                    for (e = offsets[c]; e < offsets[c + 1]; e++)
+                    {
+                        if (reach->low[targets[e]] < reach->low[c])
+                        {
+                            reach->low[c] = reach->low[targets[e]];
+                        }
+                    }
+
+                    depth--;
+                }
+            }
+        }
+
+        success = true;
+    }
+
+    free(calls);
+    free(next_edge);
+
+    return success;
+}
+
+
+/*
+ *  Helper function of the hub labeling that appends 'hub' to the given label,
+ *  growing it when it's full. Returns false if the allocation was unsuccessful
+ */
+static bool_t append_hub(int **label, int *size, int *capacity, int hub)
+{
+    int *grown;
+
+
+    if (*size == *capacity)
+    {
+        if (!( grown = (int*)realloc(*label, sizeof(int) * (2 * (*capacity) + 4)) ))
+        {
+            return false;
+        }
+
+        *label = grown;
+        *capacity = 2 * (*capacity) + 4;
+    }
+
+    (*label)[*size] = hub;
+    (*size)++;
+
+    return true;
+}
+
+
+/*
+ *  Helper function of the hub labeling that runs the pruned breadth-first search from the
+ *  component 'root', over the condensation ('offsets' and 'targets') or over its transpose.
+ *  Every component reached gets 'hub' in its 'labels', unless the labels built so far already 
+ *  connect it to the root (the hubs of the root's opposite label are marked with 'stamp' in 
+ *  'marks' beforehand): in that case the search doesn't continue past it, since a hub of 
+ *  higher priority covers those pairs
+ * 
+ *  Returns false if the allocation of a label was unsuccessful
  */
-graph_t * vertex_contraction(graph_t *graph, id_t first_node_id, id_t second_node_id)
+static bool_t pruned_hub_search(int root, int hub, int stamp, const int *offsets, const int *targets, int **labels, int *sizes, int *capacities, const int *marks, int *visited, int *queue)
 {
-    graph_node_t *merge_node, *donor_node;
-    graph_edge_list_t *ptr, *ptr2, *ptr3;
-    graph_t *ptr4;
+    int head, tail, c, e, i;
+    bool_t covered;
 
 
-    merge_node = get_node_from_id(graph, first_node_id);
-    donor_node = get_node_from_id(graph, second_node_id);
+    queue[0] = root;
+    visited[root] = stamp;
+    head = 0;
+    tail = 1;
 
-    if (merge_node && donor_node)
+    while (head < tail)
     {
-        /* If it exists, remove any edges pointing from the merge_node to the donor_node */
-        ptr = merge_node->edges;
+        c = queue[head++];
+        covered = false;
 
-        while (ptr)
+        for (i = 0; i < sizes[c] && !covered; i++)
         {
-            if (ptr->edge.endpoint_ids[1] == second_node_id)
-            {
-                delete_edge_from_node(graph, first_node_id, ptr->edge.id);
-            }
+            covered = (marks[labels[c][i]] == stamp);
+        }
 
-            ptr = ptr->next;
+        if (covered)
+        {
+            continue;
         }
 
-        /* If it exists, remove any edges pointing from the donor_node to the merge_node */
-        ptr = donor_node->edges;
-        
-        while (ptr)
+        if (!append_hub(&(labels[c]), &(sizes[c]), &(capacities[c]), hub))
         {
-            if (ptr->edge.endpoint_ids[1] == first_node_id)
+            return false;
+        }
+
+        for (e = offsets[c]; e < offsets[c + 1]; e++)
+        {
+            if (visited[targets[e]] != stamp)
             {
-                delete_edge_from_node(graph, second_node_id, ptr->edge.id);
+                visited[targets[e]] = stamp;
+                queue[tail++] = targets[e];
             }
+        }
+    }
 
-            ptr = ptr->next;
+    return true;
+}
+
+
+/*
+ *  Helper function of the reachability index that builds a 2-hop labeling of the condensation
+ *  with pruned searches (Yano et al.): the components are taken as hubs by decreasing degree,
+ *  and a search forward and one backward from every hub add it to the in-labels of the
+ *  components it reaches and to the out-labels of the components reaching it. Then b is 
+ *  reachable from a if and only if the out-label of a and the in-label of b share a hub.
+ *  The hubs are stored by rank, so every label is already sorted.
+ * 
+ *  Returns true if the labels were built, false otherwise
+ */
+static bool_t build_hub_labels(graph_reachability_t *reach, const int *offsets, const int *targets, const int *reverse_offsets, const int *reverse_targets)
+{
+    int **out_labels, **in_labels;
+    int *out_sizes, *in_sizes, *out_capacities, *in_capacities, *degrees, *order, *buckets, *marks, *visited, *queue;
+    int count, max_degree, rank, c, i;
+    bool_t success;
+
+
+    count = reach->component_count;
+    out_labels = NULL;
+    in_labels = NULL;
+    out_sizes = NULL;
+    in_sizes = NULL;
+    out_capacities = NULL;
+    in_capacities = NULL;
+    degrees = NULL;
+    order = NULL;
+    buckets = NULL;
+    marks = NULL;
+    visited = NULL;
+    queue = NULL;
+    success = false;
+
+    if (
+        ( out_labels = (int**)calloc(count + 1, sizeof(int*)) )
+        && ( in_labels = (int**)calloc(count + 1, sizeof(int*)) )
+        && ( out_sizes = (int*)calloc(count + 1, sizeof(int)) )
+        && ( in_sizes = (int*)calloc(count + 1, sizeof(int)) )
+        && ( out_capacities = (int*)calloc(count + 1, sizeof(int)) )
+        && ( in_capacities = (int*)calloc(count + 1, sizeof(int)) )
+        && ( degrees = (int*)calloc(count + 1, sizeof(int)) )
+        && ( order = (int*)malloc(sizeof(int) * (count + 1)) )
+        && ( buckets = (int*)malloc(sizeof(int) * (offsets[count] * 2 + 2)) )
+        && ( marks = (int*)malloc(sizeof(int) * (count + 1)) )
+        && ( visited = (int*)malloc(sizeof(int) * (count + 1)) )
+        && ( queue = (int*)malloc(sizeof(int) * (count + 1)) )
+    )
+    {
+        /* Hub order: by decreasing degree, as key (max_degree - degree) of a counting sort */
+        max_degree = 0;
+
+        for (c = 0; c < count; c++)
+        {
+            degrees[c] = (offsets[c + 1] - offsets[c]) + (reverse_offsets[c + 1] - reverse_offsets[c]);
+            max_degree = (degrees[c] > max_degree) ? degrees[c] : max_degree;
+            marks[c] = ERROR_INDEX;
+            visited[c] = ERROR_INDEX;
         }
-        
-        /*
-        *  For each edge that points OUTWARDS from the donor_node, append
-        *  it to the merge_node and then change each new edge's beginning node ID 
-        *  to the merge_node's node ID
-        */
-        ptr = donor_node->edges;
-        ptr2 = merge_node->edges;
 
-        while (ptr)
+        for (c = 0; c < count; c++)
         {
-            ptr2 = append_edge(ptr2, ptr->edge);
-            ptr = ptr->next;
+            degrees[c] = max_degree - degrees[c];
         }
 
-        while (ptr2)
+        counting_sort_pass(count, degrees, max_degree + 1, NULL, order, buckets);
+        success = true;
+
+        for (rank = 0; rank < count && success; rank++)
         {
-            if (ptr2->edge.endpoint_ids[0] != first_node_id)
+            c = order[rank];
+
+            /* Forward search: the hubs reachable from c connect it to the components they reach */
+            for (i = 0; i < out_sizes[c]; i++)
             {
-                if (ptr2->edge.endpoint_ids[0] == ptr2->edge.endpoint_ids[1])
-                {
-                    ptr2->edge.endpoint_ids[1] = first_node_id;
-                }
+                marks[out_labels[c][i]] = 2 * rank;
+            }
 
-                ptr2->edge.endpoint_ids[0] = first_node_id;
+            success = pruned_hub_search(c, rank, 2 * rank, offsets, targets, in_labels, in_sizes, in_capacities, marks, visited, queue);
+
+            if (!success)
+            {
+                break;
             }
 
-            ptr2 = ptr2->next;
-        }
+            /* Backward search: the hubs reaching c connect the components reaching c to it */
+            for (i = 0; i < in_sizes[c]; i++)
+            {
+                marks[in_labels[c][i]] = 2 * rank + 1;
+            }
 
-        /*
-        *  For each node in the graph that has an INWARD edge pointing to the 
-        *  donor_node, change its edge destination node ID to the merge_node's node ID
-        * 
-        *  NOTE:   This is the most processing-intensive part of the operation, since
-        *          due to the assumption that a graph can be either directed or undirected, 
-        *          it's mandatory to check for all edges for each node in the graph.
-        */
-        ptr4 = graph;
+            success = pruned_hub_search(c, rank, 2 * rank + 1, reverse_offsets, reverse_targets, out_labels, out_sizes, out_capacities, marks, visited, queue);
+        }
 
-        while (ptr4)
+        if (
+            success
+            && ( reach->out_offsets = (int*)malloc(sizeof(int) * (count + 1)) )
+            && ( reach->in_offsets = (int*)malloc(sizeof(int) * (count + 1)) )
+        )
         {
-            if (ptr4->node.id != second_node_id)
+            reach->out_offsets[0] = 0;
+            reach->in_offsets[0] = 0;
+
+            for (c = 0; c < count; c++)
             {
-                ptr3 = ptr4->node.edges;
+                reach->out_offsets[c + 1] = reach->out_offsets[c] + out_sizes[c];
+                reach->in_offsets[c + 1] = reach->in_offsets[c] + in_sizes[c];
+            }
 
-                while (ptr3)
+            if (
+                ( reach->out_hubs = (int*)malloc(sizeof(int) * (reach->out_offsets[count] + 1)) )
+                && ( reach->in_hubs = (int*)malloc(sizeof(int) * (reach->in_offsets[count] + 1)) )
+            )
+            {
+                for (c = 0; c < count; c++)
                 {
-                    if (ptr3->edge.endpoint_ids[1] == second_node_id)
+                    for (i = 0; i < out_sizes[c]; i++)
                     {
-                        ptr3->edge.endpoint_ids[1] = first_node_id;
+                        reach->out_hubs[reach->out_offsets[c] + i] = out_labels[c][i];
                     }
 
-                    ptr3 = ptr3->next;
+                    for (i = 0; i < in_sizes[c]; i++)
+                    {
+                        reach->in_hubs[reach->in_offsets[c] + i] = in_labels[c][i];
+                    }
                 }
-
-                /* Resetting the head of the edges list */
-                ptr3 = ptr4->node.edges;
             }
+            else
+            {
+                success = false;
+            }
+        }
+        else
+        {
+            success = false;
+        }
+    }
 
-            ptr4 = ptr4->next;
+    if (out_labels && in_labels)
+    {
+        for (c = 0; c < count; c++)
+        {
+            free(out_labels[c]);
+            free(in_labels[c]);
         }
+    }
 
-        /* Finally, delete the donor_node and complete the merge */
-        graph = delete_node(graph, second_node_id);
+    free(out_labels);
+    free(in_labels);
+    free(out_sizes);
+    free(in_sizes);
+    free(out_capacities);
+    free(in_capacities);
+    free(degrees);
+    free(order);
+    free(buckets);
+    free(marks);
+    free(visited);
+    free(queue);
+
+    return success;
+}
+
+
+/*
+ *  Helper function of the reachability index that builds the transpose of the condensation,
+ *  storing its offsets in 'reverse_offsets' (count + 1 elements).
+ *  Returns the array of the targets, NULL on error
+ */
+static int * transpose_components(int count, const int *offsets, const int *targets, int *reverse_offsets)
+{
+    int *reverse_targets, *position;
+    int c, e;
+
+
+    reverse_targets = NULL;
+    position = NULL;
+
+    if (
+        ( reverse_targets = (int*)malloc(sizeof(int) * (offsets[count] + 1)) )
+        && ( position = (int*)malloc(sizeof(int) * (count + 1)) )
+    )
+    {
+        for (c = 0; c <= count; c++)
+        {
+            reverse_offsets[c] = 0;
+        }
+
+        for (e = 0; e < offsets[count]; e++)
+        {
+            reverse_offsets[targets[e] + 1]++;
+        }
+
+        for (c = 0; c < count; c++)
+        {
+            reverse_offsets[c + 1] += reverse_offsets[c];
+            position[c] = reverse_offsets[c];
+        }
+
+        for (c = 0; c < count; c++)
+        {
+            for (e = offsets[c]; e < offsets[c + 1]; e++)
+            {
+                reverse_targets[position[targets[e]]++] = c;
+            }
+        }
     }
     else
     {
-        printf("[vertex_contraction()] ERROR: The given node IDs are of non-existing nodes\n");
+        free(reverse_targets);
+        reverse_targets = NULL;
     }
 
-    return graph;
+    free(position);
+
+    return reverse_targets;
 }
 
 
-/* 
- *  (1.2) - Performs the vertex contraction operation on an user input provided at runtime
+/*
+ *  Creates the reachability index of the compact view, which answers whether a node can be 
+ *  reached from another one without searching the graph. The nodes are grouped by strongly 
+ *  connected component (all the nodes of a component reach each other), and the index is
+ *  built on the condensation, which is acyclic:
+ * 
+ *      - If there are at most 'closure_limit' components, the transitive closure is stored
+ *        as one bitset per component, and a query reads a single bit.
+ *        Its size grows quadratically: REACHABILITY_CLOSURE_MAX_COMPONENTS components take 2 MB
+ * 
+ *      - Otherwise, the components get the interval labels of a depth-first search, which 
+ *        answer most queries in constant time, and a 2-hop labeling (see build_hub_labels()),
+ *        whose labels are usually a handful of hubs, for the remaining ones
+ * 
+ *  The index only depends on the graph, so it can be saved with save_reachability() and
+ *  loaded again with load_reachability() instead of repeating the preprocessing.
+ * 
+ *  Returns the index, NULL on error
  */
-graph_t * vertex_contraction_input(graph_t *graph)
+graph_reachability_t * create_reachability(graph_csr_t *csr, int closure_limit)
 {
-    id_t nid1, nid2;
+    graph_reachability_t *reach;
+    int *offsets, *targets, *reverse_offsets, *reverse_targets;
+    bool_t success;
 
 
-    nid1 = select_node_id(graph, 
-        "\nAvailable node IDs (NIDs):\n",
-        "Select first node ID: "
-    );
+    if (csr == NULL || csr->node_count == 0)
+    {
+        printf("[create_reachability()] ERROR: Invalid compact view\n");
+        return NULL;
+    }
 
-    nid2 = select_node_id(graph, 
-        "\nAvailable node IDs (NIDs):\n",
-        "Select second node ID: "
-    );
+    offsets = NULL;
+    targets = NULL;
+    reverse_offsets = NULL;
+    reverse_targets = NULL;
+    success = false;
+
+    if (
+        ( reach = (graph_reachability_t*)calloc(1, sizeof(graph_reachability_t)) )
+        && ( reach->component = (int*)malloc(sizeof(int) * csr->node_count) )
+    )
+    {
+        reach->node_count = csr->node_count;
+        reach->component_count = strongly_connected_components(csr, reach->component);
+
+        if (
+            reach->component_count != ERROR_INDEX
+            && ( offsets = (int*)malloc(sizeof(int) * (reach->component_count + 1)) )
+            && ( targets = condense_components(csr, reach->component, reach->component_count, offsets) )
+        )
+        {
+            if (reach->component_count <= closure_limit)
+            {
+                success = build_transitive_closure(reach, offsets, targets);
+            }
+            else
+            {
+                success = (
+                    ( reverse_offsets = (int*)malloc(sizeof(int) * (reach->component_count + 1)) )
+                    && ( reverse_targets = transpose_components(reach->component_count, offsets, targets, reverse_offsets) )
+                    && label_intervals(reach, offsets, targets)
+                    && build_hub_labels(reach, offsets, targets, reverse_offsets, reverse_targets)
+                );
+            }
+        }
+    }
+
+    if (!success)
+    {
+        printf("[create_reachability()] ERROR: Memory allocation was unsuccessful\n");
+        reach = delete_reachability(reach);
+    }
+
+    free(offsets);
+    free(targets);
+    free(reverse_offsets);
+    free(reverse_targets);
+
+    return reach;
+}
+
+
+/*
+ *  Helper function of the reachability index that tells whether the component b can be
+ *  reached from the component a
+ */
+static bool_t components_reachable(graph_reachability_t *reach, int a, int b)
+{
+    int i, j, i_end, j_end;
+
+
+    /* The components are in topological order, so no edge leads to a lower number */
+    if (a == b || a > b)
+    {
+        return (a == b);
+    }
+
+    if (reach->closure)
+    {
+        return (bool_t)BITSET_GET(reach->closure + (size_t)a * BITSET_WORDS(reach->component_count), b);
+    }
+
+    if (reach->post[b] > reach->post[a] || reach->post[b] < reach->low[a])
+    {
+        return false;
+    }
+
+    if (reach->pre[a] <= reach->pre[b])
+    {
+        return true;
+    }
+
+    i = reach->out_offsets[a];
+    i_end = reach->out_offsets[a + 1];
+    j = reach->in_offsets[b];
+    j_end = reach->in_offsets[b + 1];
+
+    while (i < i_end && j < j_end)
+    {
+        if (reach->out_hubs[i] == reach->in_hubs[j])
+        {
+            return true;
+        }
+        else if (reach->out_hubs[i] < reach->in_hubs[j])
+        {
+            i++;
+        }
+        else
+        {
+            j++;
+        }
+    }
+
+    return false;
+}
+
+
+/*
+ *  Tells whether the node with ID 'dest_nid' can be reached from the node with ID 'src_nid'
+ *  (every node reaches itself) using the reachability index of the compact view.
+ *  Returns false if the nodes don't belong to the view
+ */
+bool_t is_reachable(graph_csr_t *csr, graph_reachability_t *reach, id_t src_nid, id_t dest_nid)
+{
+    int src, dest;
+
+
+    src = get_csr_index_from_id(csr, src_nid);
+    dest = get_csr_index_from_id(csr, dest_nid);
 
-    return vertex_contraction(graph, nid1, nid2);
+    if (src == ERROR_INDEX || dest == ERROR_INDEX || reach == NULL || reach->node_count != csr->node_count)
+    {
+        printf("[is_reachable()] ERROR: Invalid nodes or reachability index\n");
+        return false;
+    }
+
+    return components_reachable(reach, reach->component[src], reach->component[dest]);
 }
 
 
 /*
- *  In the mathematical field of graph theory, the complement or inverse of 
- *  a graph G is a graph H on the same vertices such that two distinct vertices 
- *  of H are adjacent if and only if they are not adjacent in G. 
+ *  Helper function of the Eulerian paths that pairs every edge u -> v of an undirected graph
+ *  (stored, as usual, as two directed edges) with a reverse edge v -> u, storing the pair of 
+ *  each edge in 'partner'. The edges are grouped by endpoints with two counting sorts, and 
+ *  inside every group the k-th edge of a direction is paired with the k-th one of the other.
+ *  A self-loop is paired with itself.
  * 
- *  That is, to generate the complement of a graph, one fills in all the missing 
- *  edges required to form a complete graph, and removes all the edges that were 
- *  previously there.
- * 
- *  The complement is not the set complement of the graph; only the edges are complemented.
+ *  Returns true if all the edges were paired, false otherwise (or on error)
  */
-graph_t * complement_graph(graph_t *graph)
+static bool_t pair_reverse_edges(graph_csr_t *csr, int *partner)
 {
-    graph_t *ptr, *ptr2;
-    graph_edge_list_t *template, *edges, *template_ptr;
-    id_t endpoints[2];
+    int *low, *high, *first, *second, *buckets;
+    int m, i, start, f, b;
+    bool_t paired;
 
 
-    ptr = graph;
+    m = csr->edge_count;
+    low = NULL;
+    high = NULL;
+    first = NULL;
+    second = NULL;
+    buckets = NULL;
+    paired = false;
 
-    while (ptr)
+    if (
+        ( low = (int*)calloc(m + 1, sizeof(int)) )
+        && ( high = (int*)calloc(m + 1, sizeof(int)) )
+        && ( first = (int*)malloc(sizeof(int) * (m + 1)) )
+        && ( second = (int*)malloc(sizeof(int) * (m + 1)) )
+        && ( buckets = (int*)malloc(sizeof(int) * (csr->node_count + 1)) )
+    )
     {
-        /* 
-         *  Creating the template of all possible edges for each node by
-         *  iterating for all possible destinations reachable by a single node
-         *  which corresponds to all the nodes in the graph, including itself
-         */
-        template = NULL;
-        ptr2 = graph;
-        endpoints[0] = ptr->node.id;
-
-        while (ptr2)
-        {   
-            endpoints[1] = ptr2->node.id;
-
-            template = append_edge(
-                template,
-                create_new_edge(
-                    COMPLEMENTED_EDGE_DEFAULT_WEIGHT,
-                    COMPLEMENTED_EDGE_DEFAULT_LABEL,
-                    endpoints
-                )
-            );
-            
-            ptr2 = ptr2->next;
+        for (i = 0; i < m; i++)
+        {
+            low[i] = (csr->sources[i] < csr->targets[i]) ? csr->sources[i] : csr->targets[i];
+            high[i] = (csr->sources[i] < csr->targets[i]) ? csr->targets[i] : csr->sources[i];
         }
 
-        /* 
-         *  Iterating through all the old edges so that they are removed 
-         *  from the template, thus leaving only the complementary edges list 
-         *  that contains all the node's possible destinations except the old ones
-         */
-        edges = ptr->node.edges;
+        counting_sort_pass(m, high, csr->node_count, NULL, first, buckets);
+        counting_sort_pass(m, low, csr->node_count, first, second, buckets);
+        paired = true;
 
-        while (edges)
+        for (start = 0; start < m && paired; start = i)
         {
-            template_ptr = template;
-
-            while (template_ptr)
+            for (i = start; i < m && low[second[i]] == low[second[start]] && high[second[i]] == high[second[start]]; i++)
             {
-                if (
-                    edges->edge.endpoint_ids[0] == template_ptr->edge.endpoint_ids[0]
-                    && edges->edge.endpoint_ids[1] == template_ptr->edge.endpoint_ids[1]
-                )
+                if (low[second[i]] == high[second[i]])
                 {
-                    template = delete_edge(template, template_ptr->edge.id);
+                    partner[second[i]] = second[i];
                 }
+            }
 
-                template_ptr = template_ptr->next;
+            if (low[second[start]] == high[second[start]])
+            {
+                continue;
             }
 
-            edges = edges->next;
-        }
+            /* Pairs the edges leaving the lower endpoint with the ones leaving the higher one */
+            f = start;
+            b = start;
 
-        /* 
-         *  Now that the template contains only the complementary edges, substitute 
-         *  the pointer reference of the node's edges to the template
-         */
-        ptr->node.edges = delete_edge_list(ptr->node.edges);
-        ptr->node.edges = template;
+            while (paired)
+            {
+                while (f < i && csr->sources[second[f]] != low[second[start]])
+                {
+                    f++;
+                }
 
-        ptr = ptr->next;
+                while (b < i && csr->sources[second[b]] != high[second[start]])
+                {
+                    b++;
+                }
+
+                if (f == i || b == i)
+                {
+                    paired = (f == i && b == i);
+                    break;
+                }
+
+                partner[second[f]] = second[b];
+                partner[second[b]] = second[f];
+                f++;
+                b++;
+            }
+        }
     }
 
-    return graph;
+    free(low);
+    free(high);
+    free(first);
+    free(second);
+    free(buckets);
+
+    return paired;
 }
 
 
 /*
- *  Given a graph and a source node, the function returns the Minimum Spanning Tree
- *  (MST) from the given source node, calculated using Dijkstra's Algorithm 
- */
-/* 
- *  (1.1) - Returns the MST from the given source node 
+ *  Helper function of the Eulerian paths that checks the degrees of the nodes, and returns the 
+ *  node where an Eulerian path must begin, ERROR_INDEX if there can't be one (or if there are
+ *  no edges):
+ * 
+ *      - Directed graph: every node must have as many inward as outward edges (circuit), or 
+ *        only one node can have one more outward edge, where the path begins, and only one
+ *        node one more inward edge, where it ends
+ * 
+ *      - Undirected graph: every node must have an even degree (circuit), or exactly two of 
+ *        them an odd degree, where the path begins and ends
+ * 
+ *  The degree checks aren't enough, the edges must also be connected, which is verified by 
+ *  eulerian_path() at the end
  */
-graph_t * dijkstra_mst(graph_t *graph, id_t src_id)
+static int eulerian_start(graph_csr_t *csr, bool_t undirected)
 {
-    graph_t *mst, *src, *ptr;
-    graph_node_t *curr, *ptr2;
-    graph_edge_t *mst_edge;
-    graph_edge_list_t *edges;
-    bool_t found_neg_w, initialized;
-    int min_dist, dim, i;
+    int *balance;
+    int n, v, e, start, first, up, down;
 
 
-    mst = NULL;
+    n = csr->node_count;
+    start = ERROR_INDEX;
 
-    if (graph && (src = find_node(graph, src_id)))
+    if (csr->edge_count > 0 && ( balance = (int*)calloc(n, sizeof(int)) ))
     {
-        found_neg_w = false;
-        ptr = graph;
-
-        while (ptr && !found_neg_w)
+        for (e = 0; e < csr->edge_count; e++)
         {
-            edges = ptr->node.edges;
-
-            while (edges && !found_neg_w)
+            if (undirected)
             {
-                if (edges->edge.weight < 0)
-                {
-                    found_neg_w = true;
-                }
-
-                edges = edges->next;
+                /* The row of a node lists all its edges once, except the self-loops that count twice */
+                balance[csr->sources[e]] += (csr->sources[e] == csr->targets[e]) ? 2 : 1;
+            }
+            else
+            {
+                balance[csr->sources[e]]++;
+                balance[csr->targets[e]]--;
             }
-
-            ptr = ptr->next;
         }
 
-        if ( !found_neg_w )
-        {
-            /* Initialization */
-            ptr = graph;
+        first = ERROR_INDEX;
+        up = 0;
+        down = 0;
 
-            while (ptr)
+        for (v = 0; v < n; v++)
+        {
+            if (first == ERROR_INDEX && csr->offsets[v + 1] > csr->offsets[v])
             {
-                ptr->node.dist = -1;
-                ptr->node.prev_eid = ERROR_ID;
-                ptr->node.prev_nid = ERROR_ID;
-
-                ptr = ptr->next;
+                first = v;
             }
 
-            src->node.dist = 0;
-
-            /* Beginning of algorithm */
-            /* Debug */
-            #ifdef ENABLE_DIJKSTRA_DEBUG
-                printf("\n<<< [DEBUG LOG START] >>>\n");
-            #endif
-
-            curr = &(src->node);
-            dim = graph_dim(graph);
-            i = 0;
-
-            while (i < dim)
+            if (undirected && balance[v] % 2 != 0)
             {
-                /* Debug */
-                #ifdef ENABLE_DIJKSTRA_DEBUG
-                    printf("\nPREV_MST_NODE_ADDED: %s\n", curr->label);
-                #endif
-
-                mst = append_node(mst, *(curr));
-                ptr = mst;
-                initialized = false;
-
-                while (ptr)
-                {
-                    /* Debug */
-                    #ifdef ENABLE_DIJKSTRA_DEBUG
-                        printf("\t(MST)   NODE: %s | DIST: %lu\n", 
-                            ptr->node.label, 
-                            ptr->node.dist
-                        );
-                    #endif
-                    
-                    edges = ptr->node.edges;
-
-                    while (edges)
-                    {
-                        if (find_node(mst, edges->edge.endpoint_ids[1]) == NULL)
-                        {
-                            ptr2 = get_node_from_id(graph, edges->edge.endpoint_ids[1]);
-
-                            if (ptr2->dist > ptr->node.dist + edges->edge.weight)
-                            {
-                                /* Debug */
-                                #ifdef ENABLE_DIJKSTRA_DEBUG
-                                    printf("\t ==> DIST OF NODE [%s] CHANGED: %lu --> ",
-                                        ptr2->label,
-                                        ptr2->dist
-                                    );
-                                #endif
+                up++;
+                start = (up == 1) ? v : start;
+            }
+            else if (!undirected && balance[v] == 1)
+            {
+                up++;
+                start = v;
+            }
+            else if (!undirected && balance[v] == -1)
+            {
+                down++;
+            }
+            else if (!undirected && balance[v] != 0)
+            {
+                up = n + 1;
+            }
+        }
 
-                                ptr2->dist = ptr->node.dist + edges->edge.weight;
-                                ptr2->prev_eid = edges->edge.id;
-                                ptr2->prev_nid = ptr->node.id;
-                                
-                                /* Debug */
-                                #ifdef ENABLE_DIJKSTRA_DEBUG
-                                    printf("%lu\n", ptr2->dist);
-                                #endif
-                            }
+        if (up == 0 && down == 0)
+        {
+            start = first;
+        }
+        else if (!( (undirected && up == 2) || (!undirected && up == 1 && down == 1) ))
+        {
+            start = ERROR_INDEX;
+        }
 
-                            if ( !initialized )
-                            {
-                                min_dist = ptr2->dist;
-                                if (ptr2->prev_eid != ERROR_ID && ptr2->prev_nid != ERROR_ID)
-                                {
-                                    mst_edge = &((find_edge((find_node(mst, ptr2->prev_nid))->node.edges, ptr2->prev_eid))->edge);    
-                                }
+        free(balance);
+    }
 
-                                initialized = true;
+    return start;
+}
 
-                                /* Debug */
-                                #ifdef ENABLE_DIJKSTRA_DEBUG
-                                    printf("\t ==> (INIT) mst_edge: [%s] --(%s)--> [%s]\n",
-                                        (get_node_from_id(graph, mst_edge->endpoint_ids[0]))->label,
-                                        mst_edge->label,
-                                        (get_node_from_id(graph, mst_edge->endpoint_ids[1]))->label
-                                    );
-                                #endif
-                            }
 
-                            #ifdef ENABLE_DIJKSTRA_DEBUG
-                                printf("\t(ITER)  [%s] (d=%lu) --(%s, w=%d)--> [%s] (d=%lu)\n", 
-                                    ptr->node.label,
-                                    ptr->node.dist,
-                                    edges->edge.label,
-                                    edges->edge.weight,
-                                    ptr2->label,
-                                    ptr2->dist
-                                );
-                            #endif
+/*
+ *  Finds an Eulerian path of the compact view, which traverses every edge exactly once, with
+ *  Hierholzer's Algorithm: starting from the node given by the degree checks, it follows unused
+ *  edges until it gets stuck, and then backtracks, each edge being added to the front of the 
+ *  path when it's backtracked over. Every node keeps a cursor to its first edge that might be
+ *  unused, and the used edges are marked in a bitset indexed by edge index, so the whole search
+ *  takes linear time; the explicit stack makes it safe on graphs with millions of edges.
+ * 
+ *  If 'undirected' is true, the graph is taken as undirected: every edge must have a reverse
+ *  edge, and the two are traversed once as a single edge (marking both as used).
+ * 
+ *  Returns the list of edge IDs (EIDs) of the path in the order they are traversed, where the
+ *  EID of an undirected edge is the one of the direction taken. If the path ends where it 
+ *  begins, it's an Eulerian circuit. Returns NULL if there is no Eulerian path or on error
+ */
+id_list_t * eulerian_path(graph_csr_t *csr, bool_t undirected)
+{
+    id_list_t *path;
+    bitset_word_t *used;
+    int *partner, *cursor, *nodes, *edges;
+    int m, v, e, top, start, expected, traversed;
 
-                            if (ptr2->dist < min_dist)
-                            {
-                                min_dist = ptr2->dist;
-                                mst_edge = &(edges->edge);
-                                ptr2->prev_eid = mst_edge->id;
-                                ptr2->prev_nid = mst_edge->endpoint_ids[0];
-                                
-                                /* Debug */
-                                #ifdef ENABLE_DIJKSTRA_DEBUG
-                                    printf("\t ==> (FOUND)  mst_edge: [%s] --(%s)--> [%s]\n",
-                                        (get_node_from_id(graph, mst_edge->endpoint_ids[0]))->label,
-                                        mst_edge->label,
-                                        (get_node_from_id(graph, mst_edge->endpoint_ids[1]))->label
-                                    );
-                                #endif
-                            }
-                        }
 
-                        edges = edges->next;
-                    }
+    path = NULL;
 
-                    ptr = ptr->next;
-                }
+    if (csr == NULL)
+    {
+        printf("[eulerian_path()] ERROR: Invalid compact view\n");
+        return NULL;
+    }
 
-                /* Debug */
-                #ifdef ENABLE_DIJKSTRA_DEBUG
-                    printf("\n\t[+] mst_edge: [%s] --(%s)--> [%s]\n\n",
-                        (get_node_from_id(graph, mst_edge->endpoint_ids[0]))->label,
-                        mst_edge->label,
-                        (get_node_from_id(graph, mst_edge->endpoint_ids[1]))->label
-                    );
-                #endif
+    m = csr->edge_count;
+    used = NULL;
+    partner = NULL;
+    cursor = NULL;
+    nodes = NULL;
+    edges = NULL;
 
-                mst_edge->is_in_mst = true;
+    if (
+        ( used = (bitset_word_t*)calloc(BITSET_WORDS(m) + 1, sizeof(bitset_word_t)) )
+        && ( partner = (int*)malloc(sizeof(int) * (m + 1)) )
+        && ( cursor = (int*)malloc(sizeof(int) * (csr->node_count + 1)) )
+        && ( nodes = (int*)malloc(sizeof(int) * (m + 1)) )
+        && ( edges = (int*)malloc(sizeof(int) * (m + 1)) )
+    )
+    {
+        expected = m;
 
-                curr = get_node_from_id(graph, mst_edge->endpoint_ids[1]);
-                i++;
+        if (undirected)
+        {
+            if (!pair_reverse_edges(csr, partner))
+            {
+                expected = ERROR_INDEX;
             }
 
-            /* Debug */
-            #ifdef ENABLE_DIJKSTRA_DEBUG
-                printf("\n<<< [DEBUG LOG END] >>>\n");
-            #endif
+            for (e = 0; e < m && expected != ERROR_INDEX; e++)
+            {
+                expected -= (partner[e] > e);
+            }
         }
         else
         {
-            printf("[dijkstra_mst()] ERROR: Dijkstra's Algorithm can only be applied on graphs with positive edge weights\n");
+            for (e = 0; e < m; e++)
+            {
+                partner[e] = e;
+            }
+        }
+
+        start = (expected != ERROR_INDEX) ? eulerian_start(csr, undirected) : ERROR_INDEX;
+
+        if (start != ERROR_INDEX)
+        {
+            for (v = 0; v < csr->node_count; v++)
+            {
+                cursor[v] = csr->offsets[v];
+            }
+
+            /* The stack holds the nodes of the current walk and the edges used to reach them */
+            nodes[0] = start;
+            edges[0] = ERROR_INDEX;
+            top = 1;
+            traversed = 0;
+
+            while (top > 0)
+            {
+                v = nodes[top - 1];
+
+                while (cursor[v] < csr->offsets[v + 1] && BITSET_GET(used, cursor[v]))
+                {
+                    cursor[v]++;
+                }
+
+                if (cursor[v] < csr->offsets[v + 1])
+                {
+                    e = cursor[v]++;
+                    BITSET_SET(used, e);
+                    BITSET_SET(used, partner[e]);
+                    nodes[top] = csr->targets[e];
+                    edges[top] = e;
+                    top++;
+                }
+                else
+                {
+                    top--;
+
+                    if (edges[top] != ERROR_INDEX)
+                    {
+                        path = push_id(path, csr->edges[edges[top]]->id);
+                        traversed++;
+                    }
+                }
+            }
+
+            /* Some edges weren't reached: they aren't connected to the others */
+            if (traversed != expected)
+            {
+                path = delete_all_revoked_id(path);
+            }
         }
     }
+    else
+    {
+        printf("[eulerian_path()] ERROR: Memory allocation was unsuccessful\n");
+    }
 
-    return graph;
+    free(used);
+    free(partner);
+    free(cursor);
+    free(nodes);
+    free(edges);
+
+    return path;
 }
 
+
 /*
- *  (1.2) - Returns the MST from the source node selected by the user
+ *  Deletes the given series-parallel decomposition tree
  */
-graph_t * dijkstra_mst_input(graph_t *graph)
+graph_sp_tree_t * delete_sp_tree(graph_sp_tree_t *tree)
 {
-    id_t src_nid;
+    if (tree)
+    {
+        free(tree->types);
+        free(tree->left);
+        free(tree->right);
+        free(tree->edges);
+        free(tree->sources);
+        free(tree->sinks);
+        free(tree);
+    }
 
+    return NULL;
+}
 
-    if (graph)
+
+/*
+ *  Helper function that creates an empty decomposition tree with room for 'capacity' nodes
+ */
+static graph_sp_tree_t * create_sp_tree(int capacity)
+{
+    graph_sp_tree_t *tree;
+
+
+    if (
+        !( tree = (graph_sp_tree_t*)calloc(1, sizeof(graph_sp_tree_t)) )
+        || !( tree->types = (sp_node_type_t*)malloc(sizeof(sp_node_type_t) * capacity) )
+        || !( tree->left = (int*)malloc(sizeof(int) * capacity) )
+        || !( tree->right = (int*)malloc(sizeof(int) * capacity) )
+        || !( tree->edges = (int*)malloc(sizeof(int) * capacity) )
+        || !( tree->sources = (int*)malloc(sizeof(int) * capacity) )
+        || !( tree->sinks = (int*)malloc(sizeof(int) * capacity) )
+    )
     {
-        printf("\n[CURRENT OPERATION]\n - Calculating the Minimum Spanning Tree (MST) using Dijkstra's Algorithm\n");
-        
-        printf("\nAvailable node IDs (NIDs):\n");
-        print_all_node_ids(graph);
+        return delete_sp_tree(tree);
+    }
 
-        do
-        {
-            src_nid = *((id_t*)safe_input(U_INT, STRING_BUFFER_SIZE, "Insert source node ID: "));
-        } 
-        while (find_node(graph, src_nid) == NULL);
+    tree->root = ERROR_INDEX;
 
-        return dijkstra_mst(graph, src_nid);
+    return tree;
+}
+
+
+/*
+ *  Helper function that appends a node to the decomposition tree, returning its number
+ */
+static int add_sp_tree_node(graph_sp_tree_t *tree, sp_node_type_t type, int left, int right, int edge, int source, int sink)
+{
+    tree->types[tree->size] = type;
+    tree->left[tree->size] = left;
+    tree->right[tree->size] = right;
+    tree->edges[tree->size] = edge;
+    tree->sources[tree->size] = source;
+    tree->sinks[tree->size] = sink;
+
+    return tree->size++;
+}
+
+
+/*
+ *  Helper function that deletes the given series-parallel reduction workspace
+ */
+static graph_sp_reduction_t * delete_sp_reduction(graph_sp_reduction_t *reduction)
+{
+    if (reduction)
+    {
+        free(reduction->ends);
+        free(reduction->tree_nodes);
+        free(reduction->next);
+        free(reduction->prev);
+        free(reduction->heads);
+        free(reduction->in_degrees);
+        free(reduction->out_degrees);
+        free(reduction->buckets);
+        free(reduction->chains);
+        free(reduction->queue);
+        free(reduction->queued);
+        free(reduction);
     }
 
     return NULL;
@@ -2848,347 +16950,514 @@ graph_t * dijkstra_mst_input(graph_t *graph)
 
 
 /*
- *  In graph theory, a branch of mathematics, the disjoint union of graphs is an operation 
- *  that combines two or more graphs to form a larger graph. It is analogous to the disjoint 
- *  union of sets, and is constructed by making the vertex set of the result be the disjoint
- *  union of the vertex sets of the given graphs, and by making the edge set of the result be 
- *  the disjoint union of the edge sets of the given graphs. Any disjoint union of two or more 
- *  nonempty graphs is necessarily disconnected.
+ *  Helper function that creates a series-parallel reduction workspace for 'node_count' nodes 
+ *  and at most 'capacity' records, with empty incidence lists and hash table
  */
-graph_t * disjoint_graph_union(graph_t *graph1, graph_t *graph2)
+static graph_sp_reduction_t * create_sp_reduction(int node_count, int capacity, bool_t undirected)
 {
-    graph_t *union_graph;
+    graph_sp_reduction_t *reduction;
+    int size, v;
 
 
-    union_graph = NULL;
+    size = 1;
 
-    while (graph1)
+    while (size < 2 * capacity)
     {
-        union_graph = append_node(union_graph, graph1->node);
-        graph1 = graph1->next;
+        size *= 2;
     }
 
-    while (graph2)
+    if (
+        !( reduction = (graph_sp_reduction_t*)calloc(1, sizeof(graph_sp_reduction_t)) )
+        || !( reduction->ends = (int*)malloc(sizeof(int) * 2 * capacity) )
+        || !( reduction->tree_nodes = (int*)malloc(sizeof(int) * capacity) )
+        || !( reduction->next = (int*)malloc(sizeof(int) * 2 * capacity) )
+        || !( reduction->prev = (int*)malloc(sizeof(int) * 2 * capacity) )
+        || !( reduction->heads = (int*)malloc(sizeof(int) * node_count) )
+        || !( reduction->in_degrees = (int*)calloc(node_count, sizeof(int)) )
+        || !( reduction->out_degrees = (int*)calloc(node_count, sizeof(int)) )
+        || !( reduction->buckets = (int*)malloc(sizeof(int) * size) )
+        || !( reduction->chains = (int*)malloc(sizeof(int) * capacity) )
+        || !( reduction->queue = (int*)malloc(sizeof(int) * node_count) )
+        || !( reduction->queued = (bool_t*)calloc(node_count, sizeof(bool_t)) )
+    )
     {
-        union_graph = append_node(union_graph, graph2->node);
-        graph2 = graph2->next;
+        return delete_sp_reduction(reduction);
     }
 
-    return union_graph;
+    reduction->undirected = undirected;
+    reduction->mask = size - 1;
+
+    for (v = 0; v < node_count; v++)
+    {
+        reduction->heads[v] = ERROR_INDEX;
+    }
+
+    for (v = 0; v < size; v++)
+    {
+        reduction->buckets[v] = ERROR_INDEX;
+    }
+
+    return reduction;
 }
 
 
 /*
- *  In graph theory, the Cartesian product G □ H of graphs G and H is a graph such that:
- *
- *      - the vertex set of G □ H is the Cartesian product V(G) × V(H); and
- *      - two vertices (u,v) and (u' ,v' ) are adjacent in G □ H if and only if either
- *      - u = u' and v is adjacent to v' in H, or
- *      - v = v' and u is adjacent to u' in G.
- * 
- *  The Cartesian product of graphs is sometimes called the box product of graphs [Harary 1969].
+ *  Helper function of the series-parallel reduction that returns the hash table bucket of
+ *  the records from a to b (the order doesn't matter for undirected graphs)
  */
-graph_t * cartesian_graph_product(graph_t *graph1, graph_t *graph2)
+static int sp_bucket(graph_sp_reduction_t *reduction, int a, int b)
 {
-    graph_t *cartesian, *copy, *ptr;
-    graph_t **layers;
-    graph_edge_list_t *ptr2;
-    id_t endpoints[2];
-    id_t *node_ids;
-    int i, j, k, dim1, dim2;
-    bool_t found;
-
+    int swap;
 
-    cartesian = NULL;
 
-    if (graph1 && graph2)
+    if (reduction->undirected && a > b)
     {
-        dim1 = graph_dim(graph1);
-        dim2 = graph_dim(graph2);
+        swap = a;
+        a = b;
+        b = swap;
+    }
+
+    return (int)(((unsigned long int)a * 2654435761UL ^ (unsigned long int)b * 40503UL) & (unsigned long int)reduction->mask);
+}
+
+
+/*
+ *  Helper function of the series-parallel reduction that returns the current record 
+ *  from a to b, ERROR_INDEX if there is none
+ */
+static int sp_find_record(graph_sp_reduction_t *reduction, int a, int b)
+{
+    int r;
 
+
+    for (r = reduction->buckets[sp_bucket(reduction, a, b)]; r != ERROR_INDEX; r = reduction->chains[r])
+    {
         if (
-            ( layers = (graph_t**)malloc(sizeof(graph_t*) * dim1) )
-            && ( node_ids = (id_t*)malloc(sizeof(id_t) * dim1) )
+            (reduction->ends[2 * r] == a && reduction->ends[2 * r + 1] == b)
+            || (reduction->undirected && reduction->ends[2 * r] == b && reduction->ends[2 * r + 1] == a)
         )
         {
-            i = 0;
+            return r;
+        }
+    }
 
-            while (i < dim1)
-            {
-                copy = create_graph_copy(graph2);
-                *(layers + i) = copy;
-                ptr = copy;
+    return ERROR_INDEX;
+}
 
-                while (ptr)
-                {
-                    cartesian = append_node(cartesian, ptr->node);
-                    ptr = ptr->next;
-                }
-                
-                i++;
+
+/*
+ *  Helper function of the series-parallel reduction that adds the record r to the incidence
+ *  lists of its endpoints and to the hash table (link is true), or removes it (link is false)
+ */
+static void sp_link_record(graph_sp_reduction_t *reduction, int r, bool_t link)
+{
+    int side, i, v, *ptr;
+
+
+    for (side = 0; side < 2; side++)
+    {
+        i = 2 * r + side;
+        v = reduction->ends[i];
+
+        if (link)
+        {
+            reduction->next[i] = reduction->heads[v];
+            reduction->prev[i] = ERROR_INDEX;
+
+            if (reduction->heads[v] != ERROR_INDEX)
+            {
+                reduction->prev[reduction->heads[v]] = i;
             }
 
-            i = 0;
+            reduction->heads[v] = i;
+        }
+        else
+        {
+            if (reduction->prev[i] != ERROR_INDEX)
+            {
+                reduction->next[reduction->prev[i]] = reduction->next[i];
+            }
+            else
+            {
+                reduction->heads[v] = reduction->next[i];
+            }
 
-            while (i < dim2)
+            if (reduction->next[i] != ERROR_INDEX)
             {
-                ptr = graph1;
-                j = 0;
-                
-                while (ptr && j < dim1)
-                {
-                    *(node_ids + j) = ptr->node.id;
-                    ptr = ptr->next;
-                    j++;
-                }
+                reduction->prev[reduction->next[i]] = reduction->prev[i];
+            }
+        }
 
-                ptr = graph1;
-                j = 0;
+        if (reduction->undirected || side == 0)
+        {
+            reduction->out_degrees[v] += link ? 1 : -1;
+        }
+        else
+        {
+            reduction->in_degrees[v] += link ? 1 : -1;
+        }
+    }
 
-                while (ptr && j < dim1)
-                {
-                    endpoints[0] = (*(layers + j))->node.id;
-                    ptr2 = ptr->node.edges;
+    ptr = &(reduction->buckets[sp_bucket(reduction, reduction->ends[2 * r], reduction->ends[2 * r + 1])]);
 
-                    while (ptr2)
-                    {
-                        found = false;
-                        k = 0;
+    if (link)
+    {
+        reduction->chains[r] = *ptr;
+        *ptr = r;
+    }
+    else
+    {
+        while (*ptr != r)
+        {
+            ptr = &(reduction->chains[*ptr]);
+        }
 
-                        while (k < dim1 && !found)
-                        {
-                            if (node_ids[k] == ptr2->edge.endpoint_ids[1])
-                            {
-                                found = true;
-                            }
-                            else
-                            {
-                                k++;
-                            }
-                        }
+        *ptr = reduction->chains[r];
+        reduction->tree_nodes[r] = ERROR_INDEX;
+    }
+}
 
-                        if (found)
-                        {
-                            endpoints[1] = (*(layers + k))->node.id;
 
-                            (*(layers + j))->node.edges = append_edge(
-                                (*(layers + j))->node.edges,
-                                create_new_edge(
-                                    DEFAULT_WEIGHT_CARTESIAN_PRODUCT,
-                                    DEFAULT_LABEL_CARTESIAN_PRODUCT,
-                                    endpoints
-                                )
-                            );
-                        }
+/*
+ *  Helper function of the series-parallel reduction that adds an edge from a to b, whose
+ *  subgraph is the given tree node: if there already is one between the same nodes, the 
+ *  two are reduced in parallel instead
+ */
+static void sp_insert_record(graph_sp_reduction_t *reduction, graph_sp_tree_t *tree, int a, int b, int tree_node)
+{
+    int r;
 
-                        ptr2 = ptr2->next;
-                    }                    
 
-                    ptr = ptr->next;
-                    j++;
-                }
+    if (( r = sp_find_record(reduction, a, b) ) != ERROR_INDEX)
+    {
+        reduction->tree_nodes[r] = add_sp_tree_node(
+            tree, SP_PARALLEL, reduction->tree_nodes[r], tree_node, ERROR_INDEX, reduction->ends[2 * r], reduction->ends[2 * r + 1]
+        );
+    }
+    else
+    {
+        r = reduction->record_count++;
+        reduction->ends[2 * r] = a;
+        reduction->ends[2 * r + 1] = b;
+        reduction->tree_nodes[r] = tree_node;
+        sp_link_record(reduction, r, true);
+    }
+}
 
-                j = 0;
 
-                while (j < dim1)
-                {
-                    *(layers + j) = (*(layers + j))->next;
-                    j++;
-                }
+/*
+ *  Helper function of the series-parallel reduction that queues the node v if it can be 
+ *  reduced in series: one inward and one outward edge, or two edges if undirected
+ */
+static void sp_queue_node(graph_sp_reduction_t *reduction, int v)
+{
+    bool_t reducible;
 
-                i++;
-            }
-        }
-        else
-        {
-            printf("[cartesian_graph_product()] ERROR: Memory allocation was unsuccessful\n");
-        }        
+
+    if (reduction->undirected)
+    {
+        reducible = (reduction->out_degrees[v] == 2);
+    }
+    else
+    {
+        reducible = (reduction->in_degrees[v] == 1 && reduction->out_degrees[v] == 1);
     }
 
-    return cartesian;
+    if (reducible && !reduction->queued[v])
+    {
+        reduction->queued[v] = true;
+        reduction->queue[reduction->queue_size++] = v;
+    }
 }
 
 
 /*
- *  A two-terminal graph (TTG) is a graph with two distinguished vertices, s and t called source 
- *  and sink, respectively.
- *  
- *  (1) - The parallel composition Pc = Pc(X,Y) of two TTGs X and Y is a TTG created from the disjoint union 
- *        of graphs X and Y by merging the sources of X and Y to create the source of Pc and merging the 
- *        sinks of X and Y to create the sink of Pc.
+ *  Recognizes a two-terminal series-parallel graph (see parallel_graph_composition()) and
+ *  builds its decomposition tree, by reversing the compositions in linear time:
  * 
- *  (2) - The series composition Sc = Sc(X,Y) of two TTGs X and Y is a TTG created from the disjoint union of 
- *        graphs X and Y by merging the sink of X with the source of Y. The source of X becomes the source 
- *        of Sc and the sink of Y becomes the sink of Sc.
+ *      - Parallel reduction: two edges between the same nodes become a single edge
+ *      - Series reduction: a node with only the edges u - v and v - w is removed, and the 
+ *        two edges become the edge u - w
  * 
- *  A two-terminal series–parallel graph (TTSPG) is a graph that may be constructed by a sequence 
- *  of series and parallel compositions starting from a set of copies of a single-edge graph K2 
- *  with assigned terminals.
+ *  Every reduction adds a node to the tree whose children are the subgraphs of the reduced
+ *  edges, and the graph is series-parallel if and only if the reductions end with one edge.
+ *  Parallel edges are found through a hash table as soon as they're created, and the nodes
+ *  that can be reduced in series are kept in a stack, so every reduction takes constant time.
  * 
- *  Finally, a graph is called series–parallel (SP-graph), if it is a TTSPG when some two 
- *  of its vertices are regarded as source and sink.
- */
-/* 
- *  (1.1) - Only performs the parallel composition operation
+ *  If 'undirected' is false, the graph must be acyclic and the terminals are its only source
+ *  and its only sink. If it's true, every edge must have a reverse edge (the two count as one),
+ *  and the terminals are the endpoints of the last edge left.
+ * 
+ *  Returns the decomposition tree, NULL if the graph isn't series-parallel or on error
  */
-graph_t * parallel_graph_composition(graph_t *graph1, graph_t *graph2, id_t source_1, id_t sink_1, id_t source_2, id_t sink_2)
+graph_sp_tree_t * series_parallel_decomposition(graph_csr_t *csr, bool_t undirected)
 {
-    graph_t *union_graph;
+    graph_sp_tree_t *tree;
+    graph_sp_reduction_t *reduction;
+    int *partner;
+    int n, m, e, v, r, first, second, u, w, reduced, alive;
+    bool_t valid;
 
 
-    union_graph = NULL;
+    if (csr == NULL || csr->edge_count == 0)
+    {
+        printf("[series_parallel_decomposition()] ERROR: Invalid compact view\n");
+        return NULL;
+    }
+
+    n = csr->node_count;
+    m = csr->edge_count;
+    reduction = NULL;
+    partner = NULL;
+    valid = false;
 
     if (
-        find_node(graph1, source_1) != NULL
-        && find_node(graph1, sink_1) != NULL
-        && find_node(graph2, source_2) != NULL
-        && find_node(graph2, sink_2) != NULL
+        ( tree = create_sp_tree(2 * m) )
+        && ( reduction = create_sp_reduction(n, m + n, undirected) )
+        && ( partner = (int*)malloc(sizeof(int) * m) )
     )
     {
-        /* 
-         *  (PARALLEL COMPOSITION)
-         *  After selecting the source and sink node for both graphs, proceed
-         *  to perform a vertex contraction between the two source nodes and
-         *  also between the two sink nodes
-         */
-        union_graph = disjoint_graph_union(graph1, graph2);
-        union_graph = vertex_contraction(union_graph, source_1, source_2);
-        union_graph = vertex_contraction(union_graph, sink_1, sink_2);
+        valid = undirected ? pair_reverse_edges(csr, partner) : true;
+
+        for (e = 0; e < m && valid; e++)
+        {
+            valid = (csr->sources[e] != csr->targets[e]);
+
+            if (valid && !(undirected && partner[e] < e))
+            {
+                sp_insert_record(reduction, tree, csr->sources[e], csr->targets[e], 
+                    add_sp_tree_node(tree, SP_LEAF, ERROR_INDEX, ERROR_INDEX, e, csr->sources[e], csr->targets[e])
+                );
+            }
+        }
+
+        for (v = 0; v < n && valid; v++)
+        {
+            sp_queue_node(reduction, v);
+        }
+
+        reduced = 0;
+
+        while (valid && reduction->queue_size > 0)
+        {
+            v = reduction->queue[--(reduction->queue_size)];
+            reduction->queued[v] = false;
+
+            if (
+                (undirected && reduction->out_degrees[v] != 2)
+                || (!undirected && (reduction->in_degrees[v] != 1 || reduction->out_degrees[v] != 1))
+            )
+            {
+                continue;
+            }
+
+            /* The first record is the one from u to v, the second one the one from v to w */
+            first = reduction->heads[v] / 2;
+            second = reduction->next[reduction->heads[v]] / 2;
+
+            if (!undirected && reduction->ends[2 * first + 1] != v)
+            {
+                r = first;
+                first = second;
+                second = r;
+            }
+
+            u = (reduction->ends[2 * first] == v) ? reduction->ends[2 * first + 1] : reduction->ends[2 * first];
+            w = (reduction->ends[2 * second] == v) ? reduction->ends[2 * second + 1] : reduction->ends[2 * second];
+
+            /* A directed cycle u -> v -> u can't be reduced */
+            if (u == w)
+            {
+                continue;
+            }
+
+            r = add_sp_tree_node(tree, SP_SERIES, reduction->tree_nodes[first], reduction->tree_nodes[second], ERROR_INDEX, u, w);
+            sp_link_record(reduction, first, false);
+            sp_link_record(reduction, second, false);
+            sp_insert_record(reduction, tree, u, w, r);
+            sp_queue_node(reduction, u);
+            sp_queue_node(reduction, w);
+            reduced++;
+        }
+
+        alive = 0;
+
+        for (r = 0; r < reduction->record_count && valid; r++)
+        {
+            if (reduction->tree_nodes[r] != ERROR_INDEX)
+            {
+                tree->root = reduction->tree_nodes[r];
+                alive++;
+            }
+        }
+
+        valid = valid && alive == 1 && reduced == n - 2;
     }
     else
     {
-        printf("[parallel_graph_composition()] ERROR: Some of the given IDs don't belong to any of the nodes in either graph\n");
+        printf("[series_parallel_decomposition()] ERROR: Memory allocation was unsuccessful\n");
     }
-    
-    return union_graph;
-}
 
-/* 
- *  (1.2) - Gets the source and sink IDs for both graphs and then performs 
- *          the parallel composition operation 
- */
-graph_t * parallel_graph_composition_input(graph_t *graph1, graph_t *graph2)
-{
-    id_t source_ids[2], sink_ids[2];
-
-
-    if (graph1 && graph2)
+    if (!valid)
     {
-        printf("\n[CURRENT OPERATION]\n - Parallel Graph Composition\n");
+        tree = delete_sp_tree(tree);
+    }
 
-        /* Source and sink IDs for graph 1 */ 
-        source_ids[0] = select_node_id(graph1, 
-            "\nAvailable node IDs (NIDs) from the first graph:\n", 
-            "Insert the source ID from the first graph: "
-        );
-        sink_ids[0] = select_node_id(graph1, 
-            "\nAvailable node IDs (NIDs) from the first graph:\n", 
-            "Insert the sink ID from the first graph: "
-        );
+    reduction = delete_sp_reduction(reduction);
+    free(partner);
 
-        /* Source and sink IDs for graph2 */ 
-        source_ids[1] = select_node_id(graph2, 
-            "\nAvailable node IDs (NIDs) from the second graph:\n", 
-            "Insert the source ID from the second graph: "
-        );
-        sink_ids[1] = select_node_id(graph2, 
-            "\nAvailable node IDs (NIDs) from the second graph:\n", 
-            "Insert the sink ID from the second graph: "
-        );
+    return tree;
+}
 
-        return parallel_graph_composition(graph1, graph2, source_ids[0], sink_ids[0], source_ids[1], sink_ids[1]);
-    }
 
-    return NULL;
+/*
+ *  Helper function of the tree dynamic programming that returns the value stored for the 
+ *  tree node 'child' (4 values per node, indexed by the states of its source and sink), with
+ *  the node 'a' in the state 'a_state' and its other terminal in the state 'b_state'
+ */
+static int sp_child_value(graph_sp_tree_t *tree, const int *values, int child, int a, int a_state, int b_state)
+{
+    if (tree->sources[child] == a)
+    {
+        return values[4 * child + 2 * a_state + b_state];
+    }
+    else
+    {
+        return values[4 * child + 2 * b_state + a_state];
+    }
 }
 
 
-/* 
- *  (2.1) - Only performs the series composition operation
+/*
+ *  Computes the size of a maximum independent set (the most nodes without edges between 
+ *  them) of a series-parallel graph with a dynamic programming on its decomposition tree, 
+ *  in linear time, while the problem is NP-hard on general graphs. For every subgraph it
+ *  stores the largest set for each of the 4 choices of which terminals belong to it:
+ * 
+ *      - Leaf: 0 or 1 terminal (both terminals are adjacent)
+ *      - Series: the best choice for the middle node, which is counted by both children
+ *      - Parallel: the two children share both terminals, which are counted twice
+ * 
+ *  Returns the size of the set, ERROR_INDEX on error
  */
-graph_t * series_graph_composition(graph_t *graph1, graph_t *graph2, id_t source_id, id_t sink_id)
+int sp_max_independent_set(graph_sp_tree_t *tree)
 {
-    graph_t *union_graph;
-    graph_node_t *left_node, *right_node;
-    id_t endpoints[2];
+    int *values;
+    int t, a, b, c, best, value, middle, child;
 
 
-    union_graph = NULL;
+    if (tree == NULL || tree->root == ERROR_INDEX)
+    {
+        printf("[sp_max_independent_set()] ERROR: Invalid decomposition tree\n");
+        return ERROR_INDEX;
+    }
 
-    /* 
-     *  (SERIES COMPOSITION)
-     *  After selecting the source and sink node for both graphs, proceed
-     *  to add an edge (both ways) between the sink_node of the first
-     *  graph and the source_node of the second graph
-     */
-    left_node = get_node_from_id(graph1, source_id);
-    right_node = get_node_from_id(graph2, sink_id);
+    if (!( values = (int*)malloc(sizeof(int) * 4 * tree->size) ))
+    {
+        printf("[sp_max_independent_set()] ERROR: Memory allocation was unsuccessful\n");
+        return ERROR_INDEX;
+    }
 
-    if (left_node && right_node)
+    /* The children have lower numbers than their parent */
+    for (t = 0; t < tree->size; t++)
     {
-        union_graph = disjoint_graph_union(graph1, graph2);
+        child = tree->left[t];
+        middle = ERROR_INDEX;
 
-        /* left_node --[edge]--> right_node */
-        endpoints[0] = left_node->id;
-        endpoints[1] = right_node->id;
+        if (tree->types[t] == SP_SERIES)
+        {
+            middle = (tree->sources[child] == tree->sources[t]) ? tree->sinks[child] : tree->sources[child];
+        }
 
-        left_node->edges = append_edge(
-            left_node->edges, 
-            create_new_edge(
-                SERIES_EDGE_DEFAULT_WEIGHT,
-                SERIES_EDGE_DEFAULT_LABEL,
-                endpoints
-            )
-        );
+        for (a = 0; a < 2; a++)
+        {
+            for (b = 0; b < 2; b++)
+            {
+                if (tree->types[t] == SP_LEAF)
+                {
+                    best = (a && b) ? INT_MIN / 4 : a + b;
+                }
+                else if (tree->types[t] == SP_PARALLEL)
+                {
+                    best = sp_child_value(tree, values, tree->left[t], tree->sources[t], a, b) 
+                        + sp_child_value(tree, values, tree->right[t], tree->sources[t], a, b) - a - b;
+                }
+                else
+                {
+                    best = INT_MIN / 4;
 
-        /* right_node --[edge]--> left_node */
-        endpoints[0] = right_node->id;
-        endpoints[1] = left_node->id;
+                    for (c = 0; c < 2; c++)
+                    {
+                        value = sp_child_value(tree, values, tree->left[t], tree->sources[t], a, c) 
+                            + sp_child_value(tree, values, tree->right[t], middle, c, b) - c;
+                        best = (value > best) ? value : best;
+                    }
+                }
 
-        right_node->edges = append_edge(
-            right_node->edges, 
-            create_new_edge(
-                SERIES_EDGE_DEFAULT_WEIGHT,
-                SERIES_EDGE_DEFAULT_LABEL,
-                endpoints
-            )
-        );
+                /* Keeps the impossible choices from growing towards an overflow */
+                values[4 * t + 2 * a + b] = (best < INT_MIN / 4) ? INT_MIN / 4 : best;
+            }
+        }
     }
-    else
+
+    best = 0;
+
+    for (c = 0; c < 4; c++)
     {
-        printf("[series_graph_composition()] ERROR: One or both of the given IDs don't belong to any of the nodes in either graph\n");
+        best = (values[4 * tree->root + c] > best) ? values[4 * tree->root + c] : best;
     }
-    
-    return union_graph;
+
+    free(values);
+
+    return best;
 }
 
+
 /*
- *  (2.2) - Gets both the source ID from the first graph and sink ID from the second, then 
- *          the series composition operation 
+ *  Computes the weight of the longest path between the terminals of a series-parallel graph
+ *  with a dynamic programming on its decomposition tree: a path between the terminals of a 
+ *  series composition goes through both children, while one of a parallel composition stays 
+ *  inside one of them (it can't pass from one to the other without going through a terminal).
+ *  The cost is linear, while the longest simple path is NP-hard on general graphs.
+ * 
+ *  Returns the weight of the path, GRAPH_DIST_INF on error
  */
-graph_t * series_graph_composition_input(graph_t *graph1, graph_t *graph2)
+long int sp_longest_path(graph_csr_t *csr, graph_sp_tree_t *tree)
 {
-    id_t source_id, sink_id;
+    long int *lengths, length;
+    int t;
 
 
-    if (graph1 && graph2)
+    if (csr == NULL || tree == NULL || tree->root == ERROR_INDEX)
     {
-        printf("\n[CURRENT OPERATION]\n - Series Graph Composition\n");
-
-        /* Source ID of graph1 */
-        source_id = select_node_id(graph1, 
-            "\nAvailable node IDs (NIDs) from the first graph:\n",
-            "Insert the source ID from the first graph: "
-        );
+        printf("[sp_longest_path()] ERROR: Invalid compact view or decomposition tree\n");
+        return GRAPH_DIST_INF;
+    }
 
-        /* Sink ID of graph2 */
-        sink_id = select_node_id(graph2, 
-            "\nAvailable node IDs (NIDs) from the second graph:\n",
-            "Insert the sink ID from the second graph: "
-        );
+    if (!( lengths = (long int*)malloc(sizeof(long int) * tree->size) ))
+    {
+        printf("[sp_longest_path()] ERROR: Memory allocation was unsuccessful\n");
+        return GRAPH_DIST_INF;
+    }
 
-        return series_graph_composition(graph1, graph2, source_id, sink_id);
+    for (t = 0; t < tree->size; t++)
+    {
+        if (tree->types[t] == SP_LEAF)
+        {
+            lengths[t] = csr->weights[tree->edges[t]];
+        }
+        else if (tree->types[t] == SP_SERIES)
+        {
+            lengths[t] = lengths[tree->left[t]] + lengths[tree->right[t]];
+        }
+        else
+        {
+            lengths[t] = (lengths[tree->left[t]] > lengths[tree->right[t]]) ? lengths[tree->left[t]] : lengths[tree->right[t]];
+        }
     }
 
-    return NULL;
+    length = lengths[tree->root];
+    free(lengths);
+
+    return length;
 }
@@ -38,6 +38,12 @@
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include <limits.h>
+#include <time.h>
+
+#ifdef _OPENMP
+    #include <omp.h>
+#endif
 
 
 #define STRING_BUFFER_SIZE 256
@@ -56,6 +62,47 @@
 #define DUPLICATED_NODE_DEFAULT_LABEL_PREFIX "duplicated_node_"
 #define DEFAULT_LABEL_CARTESIAN_PRODUCT "cartesian_product_edge"
 #define DEFAULT_WEIGHT_CARTESIAN_PRODUCT 0
+#define ERROR_INDEX -1
+#define GRAPH_DIST_INF LONG_MAX
+#define GRAPH_MATRIX_INF (INT_MAX / 2)
+#define FLOYD_WARSHALL_TILE_SIZE 64
+#define LANDMARKS_FILE_HEADER "landmarks"
+#define CH_WITNESS_SETTLE_LIMIT 500
+#define CH_BENCHMARK_CHECK_COUNT 100
+#define DIAL_MAX_WEIGHT 1024
+#define SSSP_BENCHMARK_MST_MAX_NODES 1000
+#define DELTA_STEPPING_BUCKET_SIZE 64
+#define DELTA_STEPPING_MAX_SLOTS 4096
+#define RMAT_MAX_SCALE 30
+#define RMAT_A 0.57
+#define RMAT_B 0.19
+#define RMAT_C 0.19
+#define RMAT_EDGE_DEFAULT_LABEL "rmat_edge"
+#define RADIX_HEAP_BUCKETS ((int)sizeof(long int) * CHAR_BIT + 1)
+#define PAGERANK_DAMPING 0.85f
+#define PAGERANK_TOLERANCE 1e-6f
+#define PAGERANK_MAX_ITERATIONS 100
+#define PPR_EPSILON 1e-6f
+#define BETWEENNESS_BENCHMARK_TOP 10
+#define TRIANGLE_GALLOP_RATIO 32
+#define LAYERED_SOURCE_LABEL "source"
+#define LAYERED_SINK_LABEL "sink"
+#define LAYERED_EDGE_DEFAULT_LABEL "layered_edge"
+#define BIPARTITE_EDGE_DEFAULT_LABEL "bipartite_edge"
+#define ASSIGNMENT_MAX_CELLS (1 << 25)
+#define LOUVAIN_MAX_SWEEPS 32
+#define LABEL_PROPAGATION_MAX_ITERATIONS 100
+#define CLIQUE_BITSET_MAX_NODES 1024
+#define MATCH_INDUCED 1
+#define MATCH_NODE_LABELS 2
+#define MATCH_EDGE_LABELS 4
+#define MATCH_EDGE_WEIGHTS 8
+#define PATTERN_NODE_LABEL "pattern_node"
+#define PATTERN_EDGE_LABEL "pattern_edge"
+#define REACHABILITY_FILE_HEADER "reachability"
+#define REACHABILITY_CLOSURE_MAX_COMPONENTS 4096
+#define REACHABILITY_BENCHMARK_CHECK_COUNT 100
+#define SERIES_PARALLEL_EDGE_DEFAULT_LABEL "series_parallel_edge"
 
 
 /* ==== Type Definitions ==== */
@@ -148,6 +195,444 @@ typedef struct graph
 graph_t;
 
 
+/* 
+ *  Compact Graph Definition (Compressed Sparse Row view)
+ *  
+ *  Nodes are given a dense index (0 .. node_count - 1) following the order of the graph list,
+ *  and the outward edges of the node with index i are stored in the positions
+ *  offsets[i] .. offsets[i + 1] - 1 of the edge arrays
+ */
+typedef struct graph_csr
+{
+    int node_count;
+    int edge_count;
+    id_t max_node_id;
+    id_t *node_ids;             /* Node index -> NID */
+    int *index_of;              /* NID -> node index (ERROR_INDEX if the NID isn't in the graph) */
+    graph_node_t **nodes;       /* Node index -> node stored in the graph list */
+    int *offsets;               /* Node index -> position of its first outward edge */
+    int *sources;               /* Edge index -> beginning node index */
+    int *targets;               /* Edge index -> destination node index */
+    int *weights;               /* Edge index -> edge weight */
+    graph_edge_t **edges;       /* Edge index -> edge stored in the graph list */
+    int min_weight;             /* Lightest edge weight (0 if there are no edges) */
+    int max_weight;             /* Heaviest edge weight (0 if there are no edges) */
+}
+graph_csr_t;
+
+
+/* 
+ *  Single-Source Shortest Paths (SSSP) Workspace Definition
+ * 
+ *  The workspace holds all the state of a search, so the graph and its compact view are 
+ *  only read and many searches can run at the same time, one workspace per thread.
+ *  Each search increases the epoch, and a node's entries are only valid if its stamp is 
+ *  equal to the current epoch: this way a workspace can be reused by another search 
+ *  without resetting the entries of the nodes the previous one has reached
+ */
+typedef struct graph_sssp
+{
+    int node_count;
+    unsigned int epoch;         /* Current search number */
+    unsigned int *stamp;        /* Node index -> epoch of the last search that reached the node */
+    int src;                    /* Index of the source node */
+    int cycle_node;             /* Index of a node reached through a negative cycle (ERROR_INDEX if none) */
+    long int *dist;             /* Node index -> distance from the source (GRAPH_DIST_INF if unreachable) */
+    int *prev_edge;             /* Node index -> edge index used to reach the node (ERROR_INDEX if none) */
+    int *path_len;              /* Node index -> amount of edges in the current shortest path */
+    int *queue;                 /* Scratch: circular node deque (Bellman-Ford), binary heap or next node of a bucket (Dijkstra) */
+    bool_t *in_queue;           /* Scratch: deque, heap or bucket membership flags */
+    int *heap_pos;              /* Scratch: node index -> position inside the binary heap, or previous node of a bucket */
+    long int *heap_key;         /* Scratch: node index -> priority inside the binary heap */
+    int heap_size;
+}
+graph_sssp_t;
+
+
+/* 
+ *  A* Heuristic Definition
+ * 
+ *  Returns an estimate of the distance from the node with index 'node' to the node with 
+ *  index 'dest' of the compact view, which must never be greater than the real one
+ *  (GRAPH_DIST_INF can be returned if 'dest' is certainly unreachable from 'node'). 
+ *  The last parameter is the user data given to astar_search()
+ */
+typedef long int (*graph_heuristic_t)(graph_csr_t*, int, int, void*);
+
+
+/* 
+ *  Landmarks Table Definition (for the ALT heuristic)
+ * 
+ *  Stores the distances from and to each landmark node, grouped by node index so that the 
+ *  distances of a single node are contiguous: the distances of node v with landmark l are 
+ *  stored at position (v * landmark_count + l)
+ */
+typedef struct graph_landmarks
+{
+    int node_count;
+    int landmark_count;
+    int *landmarks;             /* Landmark -> node index */
+    long int *dist_from;        /* Distance from the landmark to the node */
+    long int *dist_to;          /* Distance from the node to the landmark */
+}
+graph_landmarks_t;
+
+
+/* 
+ *  Contraction Hierarchy Definition
+ * 
+ *  Every edge of the hierarchy is either an edge of the compact view or a shortcut, which 
+ *  replaces the path of two edges (children) through a node contracted before its endpoints.
+ *  The upward graph lists for each node the edges leading to higher ranked nodes, while the 
+ *  downward graph lists for each node the edges coming from higher ranked nodes
+ */
+typedef struct graph_ch
+{
+    int node_count;
+    int edge_count;             /* Edges of the compact view + shortcuts */
+    int shortcut_count;
+    int *rank;                  /* Node index -> contraction order */
+    int *sources;               /* Edge -> source node index */
+    int *targets;               /* Edge -> target node index */
+    long int *weights;
+    int *children;              /* Edge -> the two replaced edges (ERROR_INDEX for the edges of the view) */
+    int *csr_edges;             /* Edge -> edge index inside the compact view (ERROR_INDEX for shortcuts) */
+    int *up_offsets;
+    int *up_edges;
+    int *down_offsets;
+    int *down_edges;
+}
+graph_ch_t;
+
+
+/* 
+ *  Bitset Definition
+ * 
+ *  A set of small integers (node or edge indices) stored one bit per element, 
+ *  allocated as an array of BITSET_WORDS(n) words initialized to 0
+ */
+typedef unsigned long int bitset_word_t;
+
+#define BITSET_WORD_BITS ((int)sizeof(bitset_word_t) * CHAR_BIT)
+#define BITSET_WORDS(n) (((n) + BITSET_WORD_BITS - 1) / BITSET_WORD_BITS)
+#define BITSET_GET(set, i) (((set)[(i) / BITSET_WORD_BITS] >> ((i) % BITSET_WORD_BITS)) & 1UL)
+#define BITSET_SET(set, i) ((set)[(i) / BITSET_WORD_BITS] |= (1UL << ((i) % BITSET_WORD_BITS)))
+#define BITSET_CLEAR(set, i) ((set)[(i) / BITSET_WORD_BITS] &= ~(1UL << ((i) % BITSET_WORD_BITS)))
+
+
+/* 
+ *  Path Set Definition
+ * 
+ *  Stores a set of paths between the same two nodes, 
+ *  each one as a list of edge IDs (EIDs) with its length
+ */
+typedef struct graph_paths
+{
+    int count;
+    id_list_t **paths;
+    long int *dists;
+}
+graph_paths_t;
+
+
+/* 
+ *  Triangle Counts Definition
+ * 
+ *  Stores the triangles of a graph whose edges are taken without direction,
+ *  with the per-node values indexed by node index (see count_triangles())
+ */
+typedef struct graph_triangles
+{
+    int node_count;
+    long int total;             /* Amount of triangles of the graph */
+    double transitivity;        /* Global clustering coefficient: 3 * triangles / connected triples */
+    int *degrees;               /* Node index -> amount of distinct neighbours (self loops excluded) */
+    long int *triangles;        /* Node index -> amount of triangles the node belongs to */
+    double *clustering;         /* Node index -> local clustering coefficient */
+}
+graph_triangles_t;
+
+
+/* 
+ *  Flow Network Definition
+ * 
+ *  Residual network used by the maximum flow algorithms: every edge of the compact view
+ *  becomes a forward arc and a reverse arc, and the arcs leaving the node with index u
+ *  are stored in the positions offsets[u] .. offsets[u + 1] - 1 of the arc arrays
+ */
+typedef struct graph_flow_network
+{
+    int node_count;
+    int arc_count;
+    int *offsets;               /* Node index -> position of its first arc */
+    int *heads;                 /* Arc index -> destination node index */
+    int *reverse;               /* Arc index -> index of the opposite arc */
+    int *edge_arc;              /* Edge index -> index of its forward arc */
+    long int *capacity;         /* Arc index -> residual capacity */
+}
+graph_flow_network_t;
+
+
+/* 
+ *  Maximum Flow Definition
+ * 
+ *  Stores a maximum flow between two nodes, with the flow of every edge
+ *  (indexed by edge index) and the corresponding minimum cut
+ */
+typedef struct graph_flow
+{
+    int node_count;
+    int edge_count;
+    long int value;             /* Value of the flow, equal to the capacity of the minimum cut */
+    long int *flow;             /* Edge index -> flow through the edge */
+    bool_t *source_side;        /* Node index -> true if the node is on the source side of the cut */
+    id_list_t *cut;             /* EIDs of the edges from the source side to the sink side */
+}
+graph_flow_t;
+
+
+/* 
+ *  Cut Definition
+ * 
+ *  Stores a cut of a graph whose edges are taken without direction: 
+ *  the nodes on one of its sides (by node index) and the edges crossing it
+ */
+typedef struct graph_cut
+{
+    int node_count;
+    long int value;             /* Total weight of the edges crossing the cut */
+    bool_t *side;               /* Node index -> true if the node is on the side of the cut */
+    id_list_t *cut;             /* EIDs of the edges crossing the cut, in either direction */
+}
+graph_cut_t;
+
+
+/* 
+ *  Matching Definition
+ * 
+ *  Stores a matching of a bipartite graph: the mate of every node (by node index)
+ *  and, for every matched pair, the lightest edge that links the two nodes
+ */
+typedef struct graph_matching
+{
+    int node_count;
+    int size;                   /* Amount of matched pairs */
+    long int cost;              /* Total weight of the matched edges */
+    int *mate;                  /* Node index -> index of its mate (ERROR_INDEX if unmatched) */
+    id_list_t *edges;           /* EIDs of the matched edges */
+}
+graph_matching_t;
+
+
+/* Coloring Order Definition */
+typedef enum coloring_order
+{
+    NATURAL_ORDER,              /* Order of the nodes in the graph */
+    LARGEST_FIRST_ORDER,        /* Decreasing degree */
+    SMALLEST_LAST_ORDER         /* Reverse removal order by smallest degree */
+}
+coloring_order_t;
+
+
+/* 
+ *  Community Level Definition
+ * 
+ *  Stores a weighted graph whose edges are taken without direction, as used by the
+ *  community detection: an edge u - v of weight w is stored as w in the rows of both
+ *  nodes, and a self loop as 2w in the row of its node, so that the strength of a node 
+ *  is the sum of its row. Each level of the Louvain Method has one of these
+ */
+typedef struct graph_community_level
+{
+    int node_count;
+    int *offsets;               /* Node -> position of its first entry */
+    int *targets;               /* Entry -> neighbour node */
+    long int *weights;          /* Entry -> weight */
+    long int *strength;         /* Node -> sum of the weights of its row */
+    long int total;             /* Sum of all the strengths (twice the total edge weight) */
+}
+graph_community_level_t;
+
+
+/* 
+ *  Communities Definition
+ * 
+ *  Stores the community of every node (by node index), numbered from 0 to count - 1
+ */
+typedef struct graph_communities
+{
+    int node_count;
+    int count;                  /* Amount of communities */
+    int rounds;                 /* Levels of the Louvain Method, or sweeps of Label Propagation */
+    double modularity;
+    int *community;             /* Node index -> community */
+}
+graph_communities_t;
+
+
+/* 
+ *  Clique Callback Definition
+ * 
+ *  Receives a maximal clique found by maximal_cliques(): the node indexes of its 'size'
+ *  nodes in the compact view. The array is reused after the call returns. The last 
+ *  parameter is the user data given to maximal_cliques()
+ */
+typedef void (*graph_clique_callback_t)(graph_csr_t*, const int*, int, void*);
+
+
+/* 
+ *  Clique Search Definition
+ * 
+ *  Workspace of a thread of maximal_cliques(): the neighbourhood of the node that starts
+ *  a search is renumbered as local nodes (0, 1, ...), whose adjacency is a bitset matrix
+ *  of 'words' words per row, and the candidate (P) and excluded (X) sets of every depth 
+ *  are stored one after the other
+ */
+typedef struct graph_clique_search
+{
+    graph_csr_t *csr;
+    const int *offsets;         /* Node index -> position of its first distinct neighbour */
+    const int *neighbours;      /* Sorted distinct neighbours of every node */
+    int min_size;
+    graph_clique_callback_t callback;
+    void *data;
+    int words;
+    int *local;                 /* Local node -> node index */
+    int *local_of;              /* Node index -> local node (ERROR_INDEX if not local) */
+    bitset_word_t *adjacency;   /* Local node -> bitset of its local neighbours */
+    bitset_word_t *candidates;  /* Depth -> bitset of P */
+    bitset_word_t *excluded;    /* Depth -> bitset of X */
+    int *clique;                /* Node indexes of the current clique */
+    int *sorted;                /* P and X of the neighbourhoods too large for the bitsets */
+    long int count;             /* Amount of cliques reported */
+    bool_t failed;
+}
+graph_clique_search_t;
+
+
+/* 
+ *  Match Callback Definition
+ * 
+ *  Receives a match found by subgraph_isomorphisms(): the compact views of the pattern 
+ *  and of the target, and the target node index of every pattern node index. The array 
+ *  is reused after the call returns. The last parameter is the user data given to 
+ *  subgraph_isomorphisms(). Returns true to go on with the search, false to stop it
+ */
+typedef bool_t (*graph_match_callback_t)(graph_csr_t*, graph_csr_t*, const int*, void*);
+
+
+/* 
+ *  Matching View Definition
+ * 
+ *  Stores a graph for the pattern matching, with interned labels: the outward and inward
+ *  edges of every node (by node index) are rows of entries (other endpoint and label) 
+ *  sorted by endpoint, then by label, so that an edge can be found with a binary search
+ */
+typedef struct graph_match_graph
+{
+    graph_csr_t *csr;
+    int *node_labels;           /* Node index -> label ID */
+    int *out_offsets;           /* Node index -> position of its first outward entry */
+    int *out_heads;             /* Outward entry -> destination node index */
+    int *out_labels;            /* Outward entry -> edge label ID */
+    int *in_offsets;            /* Node index -> position of its first inward entry */
+    int *in_heads;              /* Inward entry -> beginning node index */
+    int *in_labels;             /* Inward entry -> edge label ID */
+    int *out_degrees;           /* Node index -> amount of distinct outward neighbours */
+    int *in_degrees;            /* Node index -> amount of distinct inward neighbours */
+}
+graph_match_graph_t;
+
+
+/* 
+ *  Reachability Index Definition
+ * 
+ *  Answers whether a node can be reached from another one. The nodes are grouped by strongly
+ *  connected component, numbered in topological order, and the index is built on the acyclic
+ *  condensation: either its transitive closure, one bitset row of component_count bits per
+ *  component (small graphs), or the interval labels of a depth-first search together with a
+ *  2-hop labeling, where b is reachable from a if and only if the out-hubs of a and the
+ *  in-hubs of b (sorted) have a hub in common (large graphs)
+ */
+typedef struct graph_reachability
+{
+    int node_count;
+    int component_count;
+    int *component;             /* Node index -> strongly connected component */
+    bitset_word_t *closure;     /* Component -> bitset of the reachable components (NULL if labeled) */
+    int *pre;                   /* Component -> preorder number in the depth-first search */
+    int *post;                  /* Component -> postorder number in the depth-first search */
+    int *low;                   /* Component -> lowest postorder number among the reachable components */
+    int *out_offsets;
+    int *out_hubs;
+    int *in_offsets;
+    int *in_hubs;
+}
+graph_reachability_t;
+
+
+/* Series-Parallel Decomposition Node Type Definition */
+typedef enum sp_node_type
+{
+    SP_LEAF,                    /* A single edge */
+    SP_SERIES,                  /* The sink of the left child is merged with the source of the right child */
+    SP_PARALLEL                 /* The sources and the sinks of the two children are merged */
+}
+sp_node_type_t;
+
+
+/* 
+ *  Series-Parallel Decomposition Tree Definition
+ * 
+ *  Every tree node is a two-terminal subgraph: a leaf is an edge of the compact view, and
+ *  the other nodes are the series or parallel composition of their two children. The 
+ *  children always have lower numbers than their parent, so the tree can be processed 
+ *  bottom-up with a simple loop. The terminals of an undirected subgraph can be stored in
+ *  either order, and those of the children may be swapped with respect to their parent
+ */
+typedef struct graph_sp_tree
+{
+    int size;                   /* Amount of tree nodes */
+    int root;
+    sp_node_type_t *types;
+    int *left;                  /* Tree node -> first child (ERROR_INDEX for leaves) */
+    int *right;                 /* Tree node -> second child (ERROR_INDEX for leaves) */
+    int *edges;                 /* Tree node -> edge index of a leaf (ERROR_INDEX for the others) */
+    int *sources;               /* Tree node -> node index of its source terminal */
+    int *sinks;                 /* Tree node -> node index of its sink terminal */
+}
+graph_sp_tree_t;
+
+
+/* 
+ *  Series-Parallel Reduction Definition
+ * 
+ *  Workspace of series_parallel_decomposition(): the current edges (records) are kept in
+ *  the doubly linked incidence lists of their endpoints, one incidence per endpoint 
+ *  (2 * record + side), and in a hash table by endpoints, so that parallel edges are 
+ *  found as soon as they're created
+ */
+typedef struct graph_sp_reduction
+{
+    bool_t undirected;
+    int record_count;
+    int *ends;                  /* Record -> its two endpoints (source, sink) */
+    int *tree_nodes;            /* Record -> tree node of its subgraph (ERROR_INDEX once removed) */
+    int *next;                  /* Incidence -> next incidence of the same node */
+    int *prev;                  /* Incidence -> previous incidence of the same node */
+    int *heads;                 /* Node index -> first incidence */
+    int *in_degrees;
+    int *out_degrees;           /* Node index -> outward degree (total degree if undirected) */
+    int *buckets;               /* Hash -> first record of the bucket */
+    int *chains;                /* Record -> next record of the same bucket */
+    int mask;
+    int *queue;                 /* Nodes that can be reduced in series */
+    bool_t *queued;
+    int queue_size;
+}
+graph_sp_reduction_t;
+
+
 /* ==== Global Variables ==== */
 
 
@@ -169,6 +654,42 @@ void                print_dijkstra(graph_t*, id_t);
 void                print_dijkstra_input(graph_t*);
 void                print_graph_matrix(graph_t*);
 void                print_all_node_ids(graph_t*);
+void                print_id_list(id_list_t*);
+void                print_bellman_ford(graph_t*, id_t);
+void                print_bellman_ford_input(graph_t*);
+void                print_bellman_ford_benchmark(graph_t*, id_t);
+void                print_floyd_warshall(graph_t*);
+void                print_apsp_benchmark(graph_t*);
+void                print_shortest_path(graph_t*, id_t, id_t);
+void                print_shortest_path_input(graph_t*);
+void                print_k_shortest_paths(graph_t*, id_t, id_t, int);
+void                print_k_shortest_paths_input(graph_t*);
+void                print_ch_benchmark(graph_t*, int);
+void                print_sssp_benchmark(graph_t*, id_t);
+void                print_delta_stepping_benchmark(graph_t*, id_t, int);
+void                print_pagerank(graph_t*);
+void                print_personalized_pagerank(graph_t*, id_t);
+void                print_personalized_pagerank_input(graph_t*);
+void                print_betweenness(graph_t*, bool_t);
+void                print_betweenness_benchmark(graph_t*, bool_t, int);
+void                print_triangles(graph_t*);
+void                print_core_numbers(graph_t*);
+void                print_max_flow(graph_t*, id_t, id_t);
+void                print_max_flow_input(graph_t*);
+void                print_max_flow_benchmark(graph_t*, id_t, id_t);
+void                print_min_cut(graph_t*);
+void                print_matching(graph_t*, bool_t);
+void                print_matching_benchmark(graph_t*);
+void                print_coloring(graph_t*);
+void                print_communities(graph_t*);
+void                print_maximal_cliques(graph_t*, int);
+void                print_maximal_cliques_input(graph_t*);
+void                print_subgraph_isomorphisms(graph_t*, graph_t*, int);
+void                print_subgraph_benchmark(graph_t*);
+void                print_isomorphism(graph_t*, graph_t*, int);
+void                print_reachability_benchmark(graph_t*, int);
+void                print_eulerian_path(graph_t*, bool_t);
+void                print_series_parallel(graph_t*, bool_t);
 graph_edge_list_t * input_edge_list(id_t);
 graph_node_t        input_node(void);
 graph_t *           input_graph(void);
@@ -176,8 +697,12 @@ void *              safe_input(const type_t, const unsigned long int, char*);
 
 
 /* File Operations */
-graph_t * load_graph(char*);
-void      save_graph(graph_t*, char*);
+graph_t *              load_graph(char*);
+void                   save_graph(graph_t*, char*);
+graph_landmarks_t *    load_landmarks(char*);
+void                   save_landmarks(graph_landmarks_t*, char*);
+graph_reachability_t * load_reachability(char*);
+void                   save_reachability(graph_reachability_t*, char*);
 
 
 /* Actions */
@@ -204,6 +729,11 @@ int    graph_dim_R(graph_t*);
 int    edge_list_dim(graph_edge_list_t*);
 int    edge_list_dim_R(graph_edge_list_t*);
 int *  create_graph_matrix(graph_t*);
+int *  create_graph_weight_matrix(graph_t*);
+int    get_thread_count(void);
+int    get_team_size(void);
+int    get_thread_id(void);
+double get_wall_time(void);
 int    autoloop_count(graph_edge_list_t*);
 char * filter(char*, char);
 char * int_to_string(long int);
@@ -233,6 +763,7 @@ id_list_t * append_revoked_id(id_list_t*, id_t);
 id_list_t * delete_revoked_id(id_list_t*, id_t);
 id_list_t * delete_all_revoked_id(id_list_t*);
 id_list_t * pop_front_revoked_id(id_list_t*, id_t*);
+id_list_t * push_id(id_list_t*, id_t);
 bool_t      find_revoked_id(id_list_t*, id_t);
 bool_t      find_revoked_id_R(id_list_t*, id_t);
 
@@ -254,4 +785,128 @@ graph_t * series_graph_composition(graph_t*, graph_t*, id_t, id_t);
 graph_t * series_graph_composition_input(graph_t*, graph_t*);
 
 
+/* Graph Generators */
+graph_t * create_rmat_graph(int, int, int, unsigned int);
+graph_t * create_layered_graph(int, int, int, int, unsigned int);
+graph_t * create_bipartite_graph(int, int, int, int, unsigned int);
+graph_t * create_series_parallel_graph(int, int, unsigned int);
+
+
+/* Compact Graph Views */
+graph_csr_t * create_graph_csr(graph_t*);
+graph_csr_t * create_graph_csr_transpose(graph_csr_t*);
+graph_csr_t * delete_graph_csr(graph_csr_t*);
+int           get_csr_index_from_id(graph_csr_t*, id_t);
+
+
+/* Shortest Paths */
+graph_sssp_t *  create_sssp(int);
+graph_sssp_t *  delete_sssp(graph_sssp_t*);
+bool_t          bellman_ford_sssp(graph_csr_t*, id_t, graph_sssp_t*);
+id_list_t *     bellman_ford_negative_cycle(graph_csr_t*, graph_sssp_t*);
+id_list_t *     get_sssp_path(graph_csr_t*, graph_sssp_t*, id_t);
+long int        get_sssp_dist(graph_csr_t*, graph_sssp_t*, id_t);
+bool_t          floyd_warshall_apsp(int*, int);
+bool_t          dijkstra_sssp(graph_csr_t*, id_t, graph_sssp_t*);
+bool_t          binary_heap_sssp(graph_csr_t*, id_t, graph_sssp_t*);
+bool_t          dial_sssp(graph_csr_t*, id_t, graph_sssp_t*);
+bool_t          radix_heap_sssp(graph_csr_t*, id_t, graph_sssp_t*);
+bool_t          delta_stepping_sssp(graph_csr_t*, id_t, graph_sssp_t*, int);
+long int *      johnson_apsp(graph_csr_t*);
+id_list_t *     bidirectional_dijkstra(graph_csr_t*, graph_csr_t*, id_t, id_t, graph_sssp_t*, graph_sssp_t*, long int*);
+id_list_t *     astar_search(graph_csr_t*, id_t, id_t, graph_heuristic_t, void*, graph_sssp_t*, long int*);
+graph_paths_t * yen_k_shortest_paths(graph_csr_t*, id_t, id_t, int, graph_sssp_t*);
+graph_paths_t * delete_graph_paths(graph_paths_t*);
+
+
+/* Landmarks (ALT) */
+graph_landmarks_t * create_landmarks(graph_csr_t*, int);
+graph_landmarks_t * delete_landmarks(graph_landmarks_t*);
+long int            landmark_heuristic(graph_csr_t*, int, int, void*);
+
+
+/* Contraction Hierarchies */
+graph_ch_t * create_graph_ch(graph_csr_t*);
+graph_ch_t * delete_graph_ch(graph_ch_t*);
+id_list_t *  ch_query(graph_csr_t*, graph_ch_t*, id_t, id_t, graph_sssp_t*, graph_sssp_t*, long int*);
+
+
+/* Centrality */
+float *  pagerank(graph_csr_t*, float, float, int, bool_t);
+float *  personalized_pagerank(graph_csr_t*, id_t, float, float);
+double * betweenness_centrality(graph_csr_t*, bool_t, int, unsigned int);
+
+
+/* Triangles and Clustering */
+graph_triangles_t * count_triangles(graph_csr_t*);
+graph_triangles_t * delete_graph_triangles(graph_triangles_t*);
+
+
+/* k-Core Decomposition */
+int *     core_numbers(graph_csr_t*);
+graph_t * extract_k_core(graph_t*, int);
+graph_t * extract_k_core_input(graph_t*);
+
+
+/* Maximum Flow */
+graph_flow_t * dinic_max_flow(graph_csr_t*, id_t, id_t);
+graph_flow_t * push_relabel_max_flow(graph_csr_t*, id_t, id_t);
+graph_flow_t * delete_graph_flow(graph_flow_t*);
+
+
+/* Global Minimum Cut */
+graph_cut_t * stoer_wagner_min_cut(graph_csr_t*);
+graph_cut_t * delete_graph_cut(graph_cut_t*);
+
+
+/* Bipartite Matching */
+bool_t             is_bipartite(graph_csr_t*, int*);
+graph_matching_t * hopcroft_karp_matching(graph_csr_t*);
+graph_matching_t * hungarian_assignment(graph_csr_t*);
+graph_matching_t * delete_graph_matching(graph_matching_t*);
+
+
+/* Graph Coloring */
+int * greedy_coloring(graph_csr_t*, coloring_order_t);
+int * dsatur_coloring(graph_csr_t*);
+int * jones_plassmann_coloring(graph_csr_t*, unsigned int);
+
+
+/* Community Detection */
+graph_communities_t * louvain_communities(graph_csr_t*);
+graph_communities_t * label_propagation_communities(graph_csr_t*, unsigned int);
+graph_communities_t * delete_graph_communities(graph_communities_t*);
+
+
+/* Maximal Cliques */
+long int maximal_cliques(graph_csr_t*, int, graph_clique_callback_t, void*);
+
+
+/* Subgraph Isomorphism */
+long int subgraph_isomorphisms(graph_t*, graph_t*, int, graph_match_callback_t, void*);
+
+
+/* Graph Isomorphism */
+unsigned long int graph_fingerprint(graph_t*, int);
+bool_t            are_isomorphic(graph_t*, graph_t*, int);
+
+
+/* Reachability */
+int                    strongly_connected_components(graph_csr_t*, int*);
+graph_reachability_t * create_reachability(graph_csr_t*, int);
+graph_reachability_t * delete_reachability(graph_reachability_t*);
+bool_t                 is_reachable(graph_csr_t*, graph_reachability_t*, id_t, id_t);
+
+
+/* Eulerian Paths */
+id_list_t * eulerian_path(graph_csr_t*, bool_t);
+
+
+/* Series-Parallel Graphs */
+graph_sp_tree_t * series_parallel_decomposition(graph_csr_t*, bool_t);
+graph_sp_tree_t * delete_sp_tree(graph_sp_tree_t*);
+int               sp_max_independent_set(graph_sp_tree_t*);
+long int          sp_longest_path(graph_csr_t*, graph_sp_tree_t*);
+
+
 #endif